@@ -1,29 +1,60 @@
 #include "esp_camera.h"
+#include "esp_timer.h"
 #include <WiFi.h>
 #include "wifi_manager.h"
+#include "web_store.h"
+#include "event_log.h"
+#include "trace.h"
+#include "camera_profile.h"
+#include "boot_timing.h"
 
 #include "board_config.h"
 
 // Instância do gerenciador WiFi
 WiFiManager wifiManager;
 
-boolean ClockBool = false;
-boolean StreamSizeBool = false;
-
 void startCameraServer();
+void stopCameraServer();
 void setupLedFlash();
 
-IPAddress local_IP(192,168,15,200);
-IPAddress gateway(192,168,15,1);    
-IPAddress subnet(255,255,255,0);     
-IPAddress primaryDNS(8,8,8,8);    
-IPAddress secondaryDNS(8,8,4,4);
+bool cameraServerRunning = false;
+
+// Chamado pelo loop() a cada mudança de estado do WiFiManager
+void onWiFiState(wifi_state_t state, wifi_state_t /*previous*/) {
+  if (state == WIFI_STATE_CONNECTED) {
+    if (!cameraServerRunning) {
+      startCameraServer();
+      cameraServerRunning = true;
+    }
+    Serial.print("Camera Ready! Use 'http://");
+    Serial.print(WiFi.localIP());
+    Serial.println("' to connect");
+  } else if (state == WIFI_STATE_PORTAL) {
+    // O portal de configuração ocupa a porta 80
+    if (cameraServerRunning) {
+      stopCameraServer();
+      cameraServerRunning = false;
+    }
+    Serial.println("Modo de configuração ativo!");
+    Serial.println("Conecte-se ao WiFi 'ESP32-CAM-Config' e acesse http://192.168.4.1");
+  }
+}
 
 void setup() {
   Serial.begin(115200);
   Serial.setDebugOutput(true);
   Serial.println();
 
+  // Anel do /trace: alocado antes de tudo para registrar as etapas do boot
+  trace_init(TRACE_DEFAULT_EVENTS);
+
+  // Perfil atual (NVS): XCLK e qualidade entram na inicialização e o resto
+  // vem logo depois, numa passada, antes de qualquer quadro
+  boot_stage("profile", esp_timer_get_time());
+  camera_profile_begin(psramFound());
+  const camera_profile_t *profile = camera_profile_current();
+
+  boot_stage("camera_init", esp_timer_get_time());
   camera_config_t config;
   config.ledc_channel = LEDC_CHANNEL_0;
   config.ledc_timer = LEDC_TIMER_0;
@@ -43,17 +74,18 @@ void setup() {
   config.pin_sccb_scl = SIOC_GPIO_NUM;
   config.pin_pwdn = PWDN_GPIO_NUM;
   config.pin_reset = RESET_GPIO_NUM;
-  config.xclk_freq_hz = 20000000;
+  config.xclk_freq_hz = profile->xclk_mhz * 1000000;
   config.frame_size = FRAMESIZE_UXGA;
   config.pixel_format = PIXFORMAT_JPEG;
   config.grab_mode = CAMERA_GRAB_WHEN_EMPTY;
   config.fb_location = CAMERA_FB_IN_PSRAM;
-  config.jpeg_quality = 12;
+  config.jpeg_quality = profile->quality;
   config.fb_count = 1;
 
+  // Os buffers são dimensionados pela resolução da inicialização: a maior
+  // possível, para a interface poder subir a resolução depois
   if (config.pixel_format == PIXFORMAT_JPEG) {
     if (psramFound()) {
-      config.jpeg_quality = 10;
       config.fb_count = 2;
       config.grab_mode = CAMERA_GRAB_LATEST;
     } else {
@@ -71,111 +103,56 @@ void setup() {
   esp_err_t err = esp_camera_init(&config);
   if (err != ESP_OK) {
     Serial.printf("Camera init failed with error 0x%x", err);
+    boot_stages_done(esp_timer_get_time());
     return;
   }
 
-sensor_t *s = esp_camera_sensor_get();
-if (config.pixel_format == PIXFORMAT_JPEG) {
-    s->set_framesize(s, FRAMESIZE_QVGA);
-}
-
+  // Única passada depois da inicialização, ainda sem nenhum quadro
+  // capturado; a resolução não passa dos buffers (sem PSRAM, só até SVGA)
+  sensor_t *s = esp_camera_sensor_get();
+  camera_profile_apply(s, profile, config.frame_size);
+  Serial.printf("Perfil da câmera '%s': XCLK %u MHz, framesize %d, qualidade %u\n", camera_profile_current_name(),
+                profile->xclk_mhz, profile->framesize, profile->quality);
 
 #if defined(LED_GPIO_NUM)
   setupLedFlash();
 #endif
 
-  // Inicializar gerenciador WiFi
-  bool wifiConnected = wifiManager.begin();
-  // Exemplo: definir o último octeto desejado do IP fixo (opcional)
+  // Páginas da partição "fr" (se gravadas) valem para o portal e a câmera
+  boot_stage("web_store", esp_timer_get_time());
+  web_store_begin();
+
+  // Histórico de eventos na partição "evlog"; a hora vem do SNTP assim que
+  // houver rede (até lá os registros saem marcados como sem relógio)
+  boot_stage("event_log", esp_timer_get_time());
+  event_log_begin();
+  configTime(0, 0, "pool.ntp.org", "time.google.com");
+
+  // Inicializar gerenciador WiFi; a conexão segue em segundo plano
+  boot_stage("wifi_begin", esp_timer_get_time());
+  wifiManager.onStateChange(onWiFiState);
+  WiFi.onEvent([](arduino_event_id_t, arduino_event_info_t) {
+    boot_mark(BOOT_MARK_GOT_IP, esp_timer_get_time());
+  }, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+  // IP fixo: último octeto na rede do gateway real, calculado na primeira
+  // conexão e aplicado antes de associar nas seguintes
   // wifiManager.setDesiredStaticHost(200); // padrão é 200
   
-  if (wifiConnected) {
-    // Configurar IP estático após conexão bem-sucedida
-    wifiManager.setStaticIP(local_IP, gateway, subnet, primaryDNS, secondaryDNS);
-    
-    Serial.println("WiFi conectado com sucesso!");
+  if (wifiManager.begin()) {
+    // Sem esperar o IP: o httpd atende assim que a interface subir
+    boot_stage("camera_server", esp_timer_get_time());
     startCameraServer();
-    
-    Serial.print("Camera Ready! Use 'http://");
-    Serial.print(WiFi.localIP());
-    Serial.println("' to connect");
-  } else {
-    Serial.println("Modo de configuração ativo!");
-    Serial.println("Conecte-se ao WiFi 'ESP32-CAM-Config' e acesse http://192.168.4.1");
+    cameraServerRunning = true;
+    Serial.println("Servidor da câmera iniciado; conectando ao WiFi...");
   }
+  boot_stages_done(esp_timer_get_time());
 }
 
 void loop() {
-  // Verificar status do WiFi
+  // Avançar a máquina de estados do WiFi (não bloqueia); o portal de
+  // configuração é atendido na tarefa dele
   wifiManager.handleWiFiConnection();
-  
-  // Se estiver em modo de configuração, processar servidor
-  if (wifiManager.isConfigModeActive()) {
-    wifiManager.handleConfigServer();
-  }
-  
-  delay(1000);
-
-  if(!ClockBool)
- {
-  set_camera_xclk_simple(40);
-  ClockBool = true;
- }
-
- if(!StreamSizeBool)
- {
-  set_camera_resolution_simple(FRAMESIZE_VGA);
-  StreamSizeBool = true;
- }
- 
-}
-
-bool set_camera_xclk_simple(uint32_t xclk_freq_mhz) {
-    sensor_t *s = esp_camera_sensor_get();
-    if (s == NULL) {
-        log_e("Sensor não inicializado");
-        return false;
-    }
-    
-    log_i("Alterando XCLK para: %u MHz", xclk_freq_mhz);
-    
-    int res = s->set_xclk(s, LEDC_TIMER_0, xclk_freq_mhz);
-    if (res != 0) {
-        log_e("Falha ao alterar XCLK: %d", res);
-        return false;
-    }
-    
-    log_i("XCLK alterado com sucesso para %u MHz", xclk_freq_mhz);
-    return true;
-}
-
-bool set_camera_resolution_simple(framesize_t resolution) {
-    sensor_t *s = esp_camera_sensor_get();
-    if (s == NULL) {
-        log_e("Sensor não inicializado");
-        return false;
-    }
-    
-    if (s->pixformat != PIXFORMAT_JPEG) {
-        log_e("Formato de pixel não é JPEG, não é possível alterar resolução");
-        return false;
-    }
-    
-    const char* resolution_names[] = {
-        "QQVGA", "QCIF", "QVGA", "CIF", "VGA", "SVGA", 
-        "XGA", "SXGA", "UXGA", "QXGA", "QSXGA"
-    };
-    
-    const char* res_name = (resolution <= FRAMESIZE_QSXGA) ? resolution_names[resolution] : "UNKNOWN";
-    
-    log_i("Alterando resolução para: %s (%d)", res_name, resolution);
-    
-    int res = s->set_framesize(s, resolution);
-    if (res != 0) {
-        log_e("Falha ao alterar resolução: %d", res);
-        return false;
-    }
-    
-    log_i("Resolução alterada com sucesso para: %s", res_name);
-    return true;
+  // Grava as mudanças do /control no perfil atual depois de um tempo parado
+  camera_profile_service(esp_timer_get_time());
+  delay(100);
 }
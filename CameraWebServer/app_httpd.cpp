@@ -8,6 +8,24 @@
 #include "camera_index.h"
 #include "board_config.h"
 #include "wifi_manager.h"
+#include "jpeg_delta.h"
+#include "scene_detect.h"
+#include "web_store.h"
+#include "metrics.h"
+#include "trace.h"
+#include "boot_timing.h"
+#include "camera_profile.h"
+#include "day_night.h"
+#include "camera_window.h"
+#include "sensor_regs.h"
+#include "stream_session.h"
+#include "frame_hub.h"
+#include "mjpeg_writer.h"
+#include "rtsp_server.h"
+#include "mqtt_client.h"
+#include "event_log.h"
+#include "esp_heap_caps.h"
+#include "lwip/sockets.h"
 
 // Declaração externa do gerenciador WiFi
 extern WiFiManager wifiManager;
@@ -24,6 +42,53 @@ bool isStreaming = false;
 
 #endif
 
+// Cena estática: sem mudanças o fluxo cai para um quadro de manutenção a
+// cada static_keepalive_ms e volta à taxa cheia no primeiro quadro alterado
+#define STATIC_POLL_MS 200
+static bool static_throttle = true;
+static int static_keepalive_ms = 1000;
+
+// Enlace WiFi caído: o /stream continua recebendo um quadro a cada
+// LINK_POLL_MS e encerra a sessão depois de STREAM_LINK_GRACE_MS sem enlace
+#define LINK_POLL_MS 50
+#define STREAM_LINK_GRACE_MS 15000
+
+// Cada sessão de fluxo roda numa tarefa própria, alimentada pelo frame_hub.
+// Um send() que não anda em stream_send_deadline_ms encerra a sessão.
+#define STREAM_TASK_STACK 6144
+#define STREAM_TASK_PRIORITY 5
+#define STREAM_RECEIVE_MS 1000
+#define STREAM_SEND_DEADLINE_MIN_MS 500
+#define STREAM_SEND_DEADLINE_SLACK_MS portTICK_PERIOD_MS
+static int stream_send_deadline_ms = 3000;
+// /delta: tantos quadros seguidos que o codificador recusa encerram a sessão
+#define DELTA_ENCODE_FAILURES_MAX 5
+
+// Dia/noite: com os perfis "day" e "night" salvos, o /stream amostra a cena
+// a cada DAY_NIGHT_SAMPLE_MS e troca de perfil entre dois quadros
+#define DAY_NIGHT_SAMPLE_MS 500
+#define DAY_NIGHT_PROFILE_DAY "day"
+#define DAY_NIGHT_PROFILE_NIGHT "night"
+static day_night_t *day_night = NULL;
+static int64_t day_night_next_us = 0;
+
+// Eventos (MQTT e histórico na flash), vistos pelo analisador do frame_hub: movimento quando a
+// cena estática muda (até ficar estática de novo) e sabotagem quando a luma
+// cai de uma vez abaixo de 1/TAMPER_LUMA_DIV da média recente (lente tapada,
+// luz cortada); a média só anda fora da sabotagem, e devagar, para o
+// anoitecer não contar
+#define TAMPER_LUMA_MIN 32
+#define TAMPER_LUMA_DIV 4
+static bool scene_was_static = false;
+static bool motion_active = false;
+static bool tamper_active = false;
+static uint32_t luma_avg_x16 = 0;
+
+// Registros por resposta do /events (o buffer é estático: o httpd atende um
+// pedido por vez)
+#define EVENTS_QUERY_DEFAULT 100
+#define EVENTS_QUERY_MAX 256
+
 // Definir o tamanho máximo do buffer se não estiver definido
 #ifndef CONFIG_CAMERA_BUFFER_SIZE
 #define CONFIG_CAMERA_BUFFER_SIZE (1024 * 1024) // 1MB
@@ -38,6 +103,7 @@ typedef struct {
 static const char *_STREAM_CONTENT_TYPE = "multipart/x-mixed-replace;boundary=" PART_BOUNDARY;
 static const char *_STREAM_BOUNDARY = "\r\n--" PART_BOUNDARY "\r\n";
 static const char *_STREAM_PART = "Content-Type: image/jpeg\r\nContent-Length: %u\r\nX-Timestamp: %d.%06d\r\n\r\n";
+static const char *_DELTA_PART = "Content-Type: application/x-mjpeg-delta\r\nContent-Length: %u\r\nX-Timestamp: %d.%06d\r\n\r\n";
 
 httpd_handle_t stream_httpd = NULL;
 httpd_handle_t camera_httpd = NULL;
@@ -51,6 +117,8 @@ typedef struct {
 } ra_filter_t;
 
 static ra_filter_t ra_filter;
+static SemaphoreHandle_t ra_lock = NULL;  // as sessões rodam em paralelo
+static scene_detector_t *hub_scene = NULL;
 
 static ra_filter_t *ra_filter_init(ra_filter_t *filter, size_t sample_size) {
   memset(filter, 0, sizeof(ra_filter_t));
@@ -65,7 +133,6 @@ static ra_filter_t *ra_filter_init(ra_filter_t *filter, size_t sample_size) {
   return filter;
 }
 
-#if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
 static int ra_filter_run(ra_filter_t *filter, int value) {
   if (!filter->values) {
     return value;
@@ -80,7 +147,36 @@ static int ra_filter_run(ra_filter_t *filter, int value) {
   }
   return filter->sum / filter->count;
 }
-#endif
+
+static int ra_filter_avg(const ra_filter_t *filter) {
+  return filter->count ? filter->sum / (int)filter->count : 0;
+}
+
+// "ip:porta" do cliente, usado como rótulo nas métricas por conexão
+static void peer_name(httpd_req_t *req, char *out, size_t len) {
+  struct sockaddr_in6 addr;
+  socklen_t addr_len = sizeof(addr);
+  char ip[INET6_ADDRSTRLEN] = "?";
+  if (getpeername(httpd_req_to_sockfd(req), (struct sockaddr *)&addr, &addr_len) != 0) {
+    snprintf(out, len, "unknown");
+    return;
+  }
+  if (addr.sin6_family == AF_INET) {
+    struct sockaddr_in *in = (struct sockaddr_in *)&addr;
+    inet_ntop(AF_INET, &in->sin_addr, ip, sizeof(ip));
+    snprintf(out, len, "%s:%u", ip, ntohs(in->sin_port));
+  } else {
+    inet_ntop(AF_INET6, &addr.sin6_addr, ip, sizeof(ip));
+    snprintf(out, len, "[%s]:%u", ip, ntohs(addr.sin6_port));
+  }
+}
+
+// Query string do pedido para o registro de sessões ("" sem query)
+static void query_string(httpd_req_t *req, char *out, size_t len) {
+  if (httpd_req_get_url_query_str(req, out, len) != ESP_OK) {
+    out[0] = 0;
+  }
+}
 
 #if defined(LED_GPIO_NUM)
 void enable_led(bool en) {
@@ -106,10 +202,13 @@ void test_camera() {
 static esp_err_t bmp_handler(httpd_req_t *req) {
   camera_fb_t *fb = NULL;
   esp_err_t res = ESP_OK;
+  trace_instant("http /bmp", httpd_req_to_sockfd(req));
 #if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
   uint64_t fr_start = esp_timer_get_time();
 #endif
+  trace_begin("capture", 0);
   fb = esp_camera_fb_get();
+  trace_end("capture");
   if (!fb) {
     log_e("Camera capture failed");
     httpd_resp_send_500(req);
@@ -126,14 +225,18 @@ static esp_err_t bmp_handler(httpd_req_t *req) {
 
   uint8_t *buf = NULL;
   size_t buf_len = 0;
+  trace_begin("bmp convert", fb->len);
   bool converted = frame2bmp(fb, &buf, &buf_len);
+  trace_end("bmp convert");
   esp_camera_fb_return(fb);
   if (!converted) {
     log_e("BMP Conversion failed");
     httpd_resp_send_500(req);
     return ESP_FAIL;
   }
+  trace_begin("send", buf_len);
   res = httpd_resp_send(req, (const char *)buf, buf_len);
+  trace_end("send");
   free(buf);
 #if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
   uint64_t fr_end = esp_timer_get_time();
@@ -161,6 +264,9 @@ static esp_err_t capture_handler(httpd_req_t *req) {
   int64_t fr_start = esp_timer_get_time();
 #endif
 
+  trace_instant("http /capture", httpd_req_to_sockfd(req));
+
+  trace_begin("capture", 0);
 #if defined(LED_GPIO_NUM)
   enable_led(true);
   vTaskDelay(150 / portTICK_PERIOD_MS);
@@ -169,6 +275,7 @@ static esp_err_t capture_handler(httpd_req_t *req) {
 #else
   fb = esp_camera_fb_get();
 #endif
+  trace_end("capture");
 
   if (!fb) {
     log_e("Camera capture failed");
@@ -191,11 +298,15 @@ static esp_err_t capture_handler(httpd_req_t *req) {
 #if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
     fb_len = fb->len;
 #endif
+    trace_begin("send", fb->len);
     res = httpd_resp_send(req, (const char *)fb->buf, fb->len);
+    trace_end("send");
   } else {
     jpg_chunking_t jchunk = {req, 0};
+    trace_begin("encode+send", 0);
     res = frame2jpg_cb(fb, 80, jpg_encode_stream, &jchunk) ? ESP_OK : ESP_FAIL;
     httpd_resp_send_chunk(req, NULL, 0);
+    trace_end("encode+send");
 #if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
     fb_len = jchunk.len;
 #endif
@@ -208,122 +319,332 @@ static esp_err_t capture_handler(httpd_req_t *req) {
   return res;
 }
 
-static esp_err_t stream_handler(httpd_req_t *req) {
-  camera_fb_t *fb = NULL;
-  struct timeval _timestamp;
-  esp_err_t res = ESP_OK;
-  size_t _jpg_buf_len = 0;
-  uint8_t *_jpg_buf = NULL;
-  char part_buf[128];
+// Chamado pela tarefa do frame_hub a cada quadro, antes de publicar; só um
+// quadro por período é amostrado. Fora dos perfis "day" e "night"
+// (escolhidos à mão) o automático fica parado.
+static void day_night_sample(scene_detector_t *scene, size_t jpeg_len, uint32_t pixels, int64_t now) {
+  int64_t due = __atomic_load_n(&day_night_next_us, __ATOMIC_RELAXED);
+  if (!day_night || now < due
+      || !__atomic_compare_exchange_n(&day_night_next_us, &due, now + DAY_NIGHT_SAMPLE_MS * 1000LL, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    return;
+  }
+  const char *current = camera_profile_current_name();
+  bool night = !strcmp(current, DAY_NIGHT_PROFILE_NIGHT);
+  if (!night && strcmp(current, DAY_NIGHT_PROFILE_DAY)) {
+    return;
+  }
+  day_night_state_t state;
+  day_night_get_state(day_night, &state);
+  if (state.mode != (night ? DAY_NIGHT_NIGHT : DAY_NIGHT_DAY)) {
+    day_night_set_mode(day_night, night ? DAY_NIGHT_NIGHT : DAY_NIGHT_DAY);
+  }
 
-  static int64_t last_frame = 0;
-  if (!last_frame) {
-    last_frame = esp_timer_get_time();
+  sensor_t *s = esp_camera_sensor_get();
+  uint16_t gain = 0;
+  if (s->id.PID == OV2640_PID && s->status.agc) {
+    gain = day_night_ov2640_gain_x16(sensor_regs_get(s, 0x100, 0xff));
+  }
+  if (!day_night_update(day_night, scene_detector_luma(scene), gain, jpeg_len, pixels, now)) {
+    return;
   }
+  const char *target = night ? DAY_NIGHT_PROFILE_DAY : DAY_NIGHT_PROFILE_NIGHT;
+  trace_begin("day/night switch", 0);
+  const char *err = camera_profile_select(target, s);
+  trace_end("day/night switch");
+  if (err) {
+    // Perfil que falta: tenta de novo só depois de outro hold
+    log_w("Day/night: cannot select profile '%s': %s", target, err);
+    day_night_set_mode(day_night, night ? DAY_NIGHT_NIGHT : DAY_NIGHT_DAY);
+    return;
+  }
+  day_night_get_state(day_night, &state);
+  log_i("Day/night: %s (luma %u, gain %.1fx)", target, state.luma, state.gain_x16 / 16.0);
+  day_night_set_mode(day_night, night ? DAY_NIGHT_DAY : DAY_NIGHT_NIGHT);
+}
 
-  res = httpd_resp_set_type(req, _STREAM_CONTENT_TYPE);
-  if (res != ESP_OK) {
-    return res;
+// Evento para o MQTT e para o histórico na flash
+static void scene_event(uint8_t type, bool end, int64_t time_ms, const scene_change_t *change, const char *fields, bool snapshot) {
+  event_log_entry_t entry;
+  entry.time_ms = time_ms;
+  entry.type = type;
+  entry.flags = end ? EVENT_LOG_END : 0;
+  entry.score = change ? change->score : 0;
+  // Células da grade -> 1/255 do quadro (x1/y1 inclusivos)
+  entry.box[0] = change ? change->x0 * 255 / SCENE_GRID_W : 0;
+  entry.box[1] = change ? change->y0 * 255 / SCENE_GRID_H : 0;
+  entry.box[2] = change ? (change->x1 + 1) * 255 / SCENE_GRID_W : 255;
+  entry.box[3] = change ? (change->y1 + 1) * 255 / SCENE_GRID_H : 255;
+  event_log_append(&entry);
+  mqtt_client_event(event_log_type_name(type), fields, snapshot);
+}
+
+// Chamado pela tarefa do frame_hub a cada quadro analisado; só enfileira
+static void scene_events_sample(const hub_frame_t *frame, uint8_t luma) {
+  char fields[160];
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  double now = tv.tv_sec + tv.tv_usec / 1e6;
+  int64_t now_ms = (int64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000;
+
+  if (!motion_active && frame->changed && scene_was_static) {
+    scene_change_t change;
+    scene_detector_change(hub_scene, &change);
+    motion_active = true;
+    snprintf(fields, sizeof(fields), "\"state\":\"start\",\"time\":%.3f,\"luma\":%u,\"score\":%u,\"box\":[%u,%u,%u,%u]", now, luma, change.score,
+             change.x0, change.y0, change.x1, change.y1);
+    scene_event(EVENT_LOG_MOTION, false, now_ms, &change, fields, true);
+  } else if (motion_active && frame->is_static) {
+    motion_active = false;
+    snprintf(fields, sizeof(fields), "\"state\":\"end\",\"time\":%.3f,\"luma\":%u", now, luma);
+    scene_event(EVENT_LOG_MOTION, true, now_ms, NULL, fields, false);
   }
+  scene_was_static = frame->is_static;
 
-  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-  httpd_resp_set_hdr(req, "X-Framerate", "60");
+  if (!luma_avg_x16) {
+    luma_avg_x16 = luma * 16;
+  }
+  if (!tamper_active && luma_avg_x16 >= TAMPER_LUMA_MIN * 16 && luma * TAMPER_LUMA_DIV * 16 < luma_avg_x16) {
+    tamper_active = true;
+    snprintf(fields, sizeof(fields), "\"state\":\"start\",\"time\":%.3f,\"luma\":%u,\"luma_avg\":%u", now, luma, luma_avg_x16 / 16);
+    scene_event(EVENT_LOG_TAMPER, false, now_ms, NULL, fields, true);
+  } else if (tamper_active && luma * 2 * 16 >= luma_avg_x16) {
+    tamper_active = false;
+    snprintf(fields, sizeof(fields), "\"state\":\"end\",\"time\":%.3f,\"luma\":%u,\"luma_avg\":%u", now, luma, luma_avg_x16 / 16);
+    scene_event(EVENT_LOG_TAMPER, true, now_ms, NULL, fields, false);
+  }
+  if (!tamper_active) {
+    luma_avg_x16 = luma_avg_x16 + luma - luma_avg_x16 / 16;
+  }
+}
+
+// Membros extras do heartbeat do MQTT (roda na tarefa do publicador)
+static size_t mqtt_status(char *buf, size_t cap) {
+  int n = snprintf(buf, cap, ",\"rssi\":%d,\"heap\":%u,\"clients\":%d,\"luma\":%u,\"profile\":\"%s\",\"motion\":%s,\"tamper\":%s", WiFi.RSSI(),
+                   (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT), frame_hub_subscribers(), hub_scene ? scene_detector_luma(hub_scene) : 0,
+                   camera_profile_current_name(), motion_active ? "true" : "false", tamper_active ? "true" : "false");
+  return n < 0 ? 0 : ((size_t)n < cap ? n : cap - 1);
+}
+
+// Analisador do frame_hub: mudança de cena (para o quadro de manutenção das
+// sessões), amostra de dia/noite e eventos (MQTT e histórico). Retorna o
+// descanso da captura enquanto a cena está parada.
+static uint32_t analyze_frame(hub_frame_t *frame) {
+  if (!hub_scene) {
+    return 0;
+  }
+  frame->changed = scene_detector_update(hub_scene, frame->buf, frame->len);
+  frame->is_static = scene_detector_is_static(hub_scene);
+  day_night_sample(hub_scene, frame->len, (uint32_t)frame->width * frame->height, frame->captured_us);
+  scene_events_sample(frame, scene_detector_luma(hub_scene));
+  return static_throttle && !frame->changed && frame->is_static ? STATIC_POLL_MS : 0;
+}
+
+// Sessão de fluxo servida numa tarefa própria, com os quadros do frame_hub:
+// um cliente lento só atrasa a si mesmo
+typedef struct {
+  httpd_req_t *req;  // cópia assíncrona da requisição
+  int fd;            // a resposta é escrita direto no socket (mjpeg_writer)
+  int sub;           // assinante do frame_hub
+  int client;        // slot nas métricas
+  int session;       // slot no registro de sessões
+  int64_t started_us;
+  char peer[48];
+  jpeg_delta_encoder_t *delta;  // só no /delta
+  bool led;                     // só no /stream
+} stream_ctx_t;
+
+// Envio que esgotou o prazo (o SO_SNDTIMEO do lwIP conta em ticks e pode
+// voltar até um tick antes) ou quadro que levou o prazo inteiro
+static bool send_deadline_hit(int64_t elapsed_us) {
+  return elapsed_us >= ((int64_t)stream_send_deadline_ms - STREAM_SEND_DEADLINE_SLACK_MS) * 1000;
+}
 
 #if defined(LED_GPIO_NUM)
-  isStreaming = true;
-  enable_led(true);
+static int streams_open = 0;
+
+static void stream_led(bool open) {
+  isStreaming = __atomic_add_fetch(&streams_open, open ? 1 : -1, __ATOMIC_RELAXED) > 0;
+  enable_led(isStreaming);
+}
+#endif
+
+static void stream_frame_time(int64_t frame_time_ms, size_t frame_len, const char *kind) {
+  (void)frame_len;  // só no log_i, que pode sumir na compilação
+  (void)kind;
+  xSemaphoreTake(ra_lock, portMAX_DELAY);
+  ra_filter_run(&ra_filter, frame_time_ms);
+  xSemaphoreGive(ra_lock);
+  log_i("%s: %uB %ums (%.1ffps), AVG: %ums (%.1ffps)", kind, (uint32_t)frame_len, (uint32_t)frame_time_ms, 1000.0 / (uint32_t)frame_time_ms,
+        (uint32_t)ra_filter_avg(&ra_filter), 1000.0 / ra_filter_avg(&ra_filter));
+}
+
+// Fim da sessão: devolve a conexão ao servidor, que a fecha
+static void stream_finish(stream_ctx_t *ctx) {
+  frame_hub_unsubscribe(ctx->sub);
+  metrics_client_close(ctx->client);
+  stream_session_close(ctx->session);
+  if (ctx->delta) {
+    jpeg_delta_encoder_free(ctx->delta);
+  }
+  httpd_handle_t server = ctx->req->handle;
+  httpd_req_async_handler_complete(ctx->req);
+  httpd_sess_trigger_close(server, ctx->fd);
+#if defined(LED_GPIO_NUM)
+  if (ctx->led) {
+    stream_led(false);
+  }
 #endif
+  free(ctx);
+  trace_thread_exit();
+}
+
+// Cabeçalho e a primeira fronteira saem aqui, direto no socket; o resto da
+// resposta fica com uma tarefa nova e o servidor do fluxo volta a atender
+static esp_err_t stream_start(httpd_req_t *req, stream_ctx_t *ctx, const char *endpoint, TaskFunction_t task) {
+  char query[48];
+  ctx->sub = frame_hub_subscribe();
+  if (ctx->sub < 0) {
+    log_w("No stream slot left for %s", endpoint);
+    httpd_resp_set_status(req, "503 Service Unavailable");
+    httpd_resp_send(req, "Too many streams", HTTPD_RESP_USE_STRLEN);
+    return ESP_FAIL;
+  }
+
+  // O prazo de envio vale para cada envio desta sessão
+  int fd = httpd_req_to_sockfd(req);
+  struct timeval deadline = {stream_send_deadline_ms / 1000, (stream_send_deadline_ms % 1000) * 1000};
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &deadline, sizeof(deadline));
+  if (mjpeg_writer_begin(fd, _STREAM_CONTENT_TYPE, _STREAM_BOUNDARY) != ESP_OK || httpd_req_async_handler_begin(req, &ctx->req) != ESP_OK) {
+    frame_hub_unsubscribe(ctx->sub);
+    return ESP_FAIL;
+  }
+  ctx->fd = fd;
+
+  ctx->started_us = esp_timer_get_time();
+  peer_name(req, ctx->peer, sizeof(ctx->peer));
+  query_string(req, query, sizeof(query));
+  ctx->client = metrics_client_open(endpoint, ctx->peer);
+  ctx->session = stream_session_open(endpoint, ctx->peer, query, fd, ctx->started_us);
+#if defined(LED_GPIO_NUM)
+  if (ctx->led) {
+    stream_led(true);
+  }
+#endif
+  if (xTaskCreate(task, endpoint, STREAM_TASK_STACK, ctx, STREAM_TASK_PRIORITY, NULL) != pdPASS) {
+    log_e("Stream task creation failed");
+    stream_finish(ctx);
+  }
+  return ESP_OK;
+}
+
+// Taxa limitada pelo nível da sessão: os quadros do intervalo nem entram na
+// fila dela
+static void stream_pace(stream_ctx_t *ctx, uint32_t min_interval_us, int64_t now) {
+  frame_hub_pause(ctx->sub, min_interval_us ? now + min_interval_us : 0);
+}
+
+static void stream_task(void *arg) {
+  stream_ctx_t *ctx = (stream_ctx_t *)arg;
+  char part_buf[128];
+  esp_err_t res = ESP_OK;
+  int64_t last_frame = ctx->started_us;
+  int64_t last_sent = 0;
+  int64_t link_down_since = 0;
+  uint32_t stale = 0;
 
   while (true) {
-    fb = esp_camera_fb_get();
-    if (!fb) {
-      log_e("Camera capture failed");
-      res = ESP_FAIL;
+    if (stream_session_killed(ctx->session)) {
+      log_i("Stream %s closed from /sessions", ctx->peer);
       break;
     }
-    
-    _timestamp.tv_sec = fb->timestamp.tv_sec;
-    _timestamp.tv_usec = fb->timestamp.tv_usec;
-    
-    if (fb->format != PIXFORMAT_JPEG) {
-      bool jpeg_converted = frame2jpg(fb, 80, &_jpg_buf, &_jpg_buf_len);
-      if (!jpeg_converted) {
-        log_e("JPEG compression failed");
-        esp_camera_fb_return(fb);
-        res = ESP_FAIL;
-        break;
-      }
-      esp_camera_fb_return(fb);
-      fb = NULL;
-    } else {
-      // Para formato JPEG, precisamos copiar o buffer
-      _jpg_buf = (uint8_t*)malloc(fb->len);
-      if (_jpg_buf) {
-        memcpy(_jpg_buf, fb->buf, fb->len);
-        _jpg_buf_len = fb->len;
-      } else {
-        log_e("Malloc failed for JPEG buffer");
-        esp_camera_fb_return(fb);
-        res = ESP_FAIL;
+    hub_frame_t *frame = frame_hub_receive(ctx->sub, STREAM_RECEIVE_MS);
+    stale += frame_hub_take_stale(ctx->sub);
+    if (!frame) {
+      continue;
+    }
+    int64_t t_got = esp_timer_get_time();
+
+    // Enlace caído: os quadros seguem chegando (o primeiro depois da volta é
+    // atual, não um antigo parado no socket) e nada é enviado. Com o IP fixo
+    // a conexão TCP pode sobreviver; se a queda passar do limite, a sessão
+    // acaba e libera o servidor para o cliente que reconectar.
+    if (!wifiManager.isConnected()) {
+      frame_hub_release(frame);
+      metrics_drop(METRIC_DROP_LINK);
+      if (!link_down_since) {
+        link_down_since = t_got;
+        trace_instant("stream link down", 0);
+      } else if (t_got - link_down_since > (int64_t)STREAM_LINK_GRACE_MS * 1000) {
+        log_w("Link down for %u ms, closing stream", STREAM_LINK_GRACE_MS);
         break;
       }
-      esp_camera_fb_return(fb);
-      fb = NULL;
-    }
-
-    if (res == ESP_OK) {
-      res = httpd_resp_send_chunk(req, _STREAM_BOUNDARY, strlen(_STREAM_BOUNDARY));
+      frame_hub_pause(ctx->sub, t_got + LINK_POLL_MS * 1000);
+      continue;
     }
-    
-    if (res == ESP_OK) {
-      size_t hlen = snprintf(part_buf, sizeof(part_buf), _STREAM_PART, 
-                           _jpg_buf_len, _timestamp.tv_sec, _timestamp.tv_usec);
-      res = httpd_resp_send_chunk(req, part_buf, hlen);
+    link_down_since = 0;
+
+    // Cena estática (detectada no frame_hub): só um quadro de manutenção a
+    // cada static_keepalive_ms
+    if (static_throttle && !frame->changed && frame->is_static && t_got - last_sent < (int64_t)static_keepalive_ms * 1000) {
+      frame_hub_release(frame);
+      metrics_drop(METRIC_DROP_STATIC);
+      trace_instant("static skip", 0);
+      continue;
     }
-    
-    if (res == ESP_OK) {
-      res = httpd_resp_send_chunk(req, (const char *)_jpg_buf, _jpg_buf_len);
-    }
-    
-    // Liberar memória
-    if (_jpg_buf) {
-      free(_jpg_buf);
-      _jpg_buf = NULL;
-      _jpg_buf_len = 0;
-    }
-    
-    if (res != ESP_OK) {
-      log_e("Send frame failed: %d", res);
+
+    int64_t t_send = esp_timer_get_time();
+    size_t hlen = snprintf(part_buf, sizeof(part_buf), _STREAM_PART, frame->len, frame->timestamp.tv_sec, frame->timestamp.tv_usec);
+    // A fronteira logo depois do quadro: o navegador mostra o quadro sem
+    // esperar o próximo
+    trace_begin("send", frame->len);
+    res = mjpeg_writer_part(ctx->fd, part_buf, hlen, frame->buf, frame->len, _STREAM_BOUNDARY);
+    trace_end("send");
+    size_t frame_len = frame->len;
+    frame_hub_release(frame);
+
+    int64_t fr_end = esp_timer_get_time();
+    if (res != ESP_OK || send_deadline_hit(fr_end - t_send)) {
+      if (send_deadline_hit(fr_end - t_send)) {
+        log_w("Stream %s: send took %u ms, over the %d ms deadline", ctx->peer, (uint32_t)((fr_end - t_send) / 1000), stream_send_deadline_ms);
+        stream_session_deadline(ctx->session);
+      } else {
+        log_e("Send frame failed: %d", res);
+      }
+      metrics_drop(METRIC_DROP_SEND);
       break;
     }
-    
-    int64_t fr_end = esp_timer_get_time();
+
+    size_t sent = hlen + frame_len + strlen(_STREAM_BOUNDARY);
+    metrics_observe(METRIC_SEND, fr_end - t_send);
+    metrics_observe(METRIC_FRAME_SIZE, frame_len);
+    metrics_observe(METRIC_FRAME_INTERVAL, fr_end - last_frame);
+    metrics_client_sent(ctx->client, sent);
+    stream_pace(ctx, stream_session_frame(ctx->session, sent, fr_end - t_send, stale, fr_end), fr_end);
+    stale = 0;
+    metrics_wifi_frame(fr_end);
+    boot_mark(BOOT_MARK_FIRST_FRAME, fr_end);
+    last_sent = fr_end;
     int64_t frame_time = fr_end - last_frame;
     last_frame = fr_end;
-    frame_time /= 1000;
-    
-    log_i("MJPG: %uB %ums (%.1ffps)", 
-          (uint32_t)(_jpg_buf_len), 
-          (uint32_t)frame_time, 
-          1000.0 / (uint32_t)frame_time);
-    
-    // Pequeno delay para evitar sobrecarga
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+    stream_frame_time(frame_time / 1000, frame_len, "MJPG");
   }
 
-#if defined(LED_GPIO_NUM)
-  isStreaming = false;
-  enable_led(false);
-#endif
+  stream_finish(ctx);
+  vTaskDelete(NULL);
+}
 
-  if (fb) {
-    esp_camera_fb_return(fb);
+static esp_err_t stream_handler(httpd_req_t *req) {
+  trace_instant("http /stream", httpd_req_to_sockfd(req));
+
+  stream_ctx_t *ctx = (stream_ctx_t *)calloc(1, sizeof(stream_ctx_t));
+  if (!ctx) {
+    return httpd_resp_send_500(req);
   }
-  
-  if (_jpg_buf) {
-    free(_jpg_buf);
+  ctx->led = true;
+  esp_err_t res = stream_start(req, ctx, "stream", stream_task);
+  if (res != ESP_OK) {
+    free(ctx);
   }
-  
   return res;
 }
 
@@ -353,6 +674,8 @@ static esp_err_t cmd_handler(httpd_req_t *req) {
   char variable[32];
   char value[32];
 
+  trace_instant("http /control", httpd_req_to_sockfd(req));
+
   if (parse_get(req, &buf) != ESP_OK) {
     return ESP_FAIL;
   }
@@ -367,10 +690,19 @@ static esp_err_t cmd_handler(httpd_req_t *req) {
   log_i("%s = %d", variable, val);
   sensor_t *s = esp_camera_sensor_get();
   int res = 0;
+  bool sensor_setting = true;  // entra no perfil atual
 
   if (!strcmp(variable, "framesize")) {
     if (s->pixformat == PIXFORMAT_JPEG) {
+      // O set_framesize volta a janela ao campo inteiro: a ROI é reaplicada
+      // na resolução nova
+      camera_roi_t roi;
+      camera_window_current(s, &roi);
       res = s->set_framesize(s, (framesize_t)val);
+      camera_window_reset();
+      if (!res) {
+        camera_window_apply(s, &roi);
+      }
     }
   } else if (!strcmp(variable, "quality")) {
     res = s->set_quality(s, val);
@@ -418,10 +750,21 @@ static esp_err_t cmd_handler(httpd_req_t *req) {
     res = s->set_wb_mode(s, val);
   } else if (!strcmp(variable, "ae_level")) {
     res = s->set_ae_level(s, val);
+  } else if (!strcmp(variable, "static_throttle")) {
+    static_throttle = val != 0;
+    sensor_setting = false;
+  } else if (!strcmp(variable, "static_keepalive")) {
+    static_keepalive_ms = val < STATIC_POLL_MS ? STATIC_POLL_MS : val;
+    sensor_setting = false;
+  } else if (!strcmp(variable, "send_deadline")) {
+    // Vale para as sessões abertas a partir de agora
+    stream_send_deadline_ms = val < STREAM_SEND_DEADLINE_MIN_MS ? STREAM_SEND_DEADLINE_MIN_MS : val;
+    sensor_setting = false;
   }
 #if defined(LED_GPIO_NUM)
   else if (!strcmp(variable, "led_intensity")) {
     led_duty = val;
+    sensor_setting = false;
     if (isStreaming) {
       enable_led(true);
     }
@@ -430,23 +773,32 @@ static esp_err_t cmd_handler(httpd_req_t *req) {
   else {
     log_i("Unknown command: %s", variable);
     res = -1;
+    sensor_setting = false;  // nenhum setter rodou
   }
 
+  if (sensor_setting) {
+    sensor_regs_invalidate();
+  }
   if (res < 0) {
     return httpd_resp_send_500(req);
   }
+  if (sensor_setting) {
+    camera_profile_touch(esp_timer_get_time());
+  }
 
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
   return httpd_resp_send(req, NULL, 0);
 }
 
 static int print_reg(char *p, sensor_t *s, uint16_t reg, uint32_t mask) {
-  return sprintf(p, "\"0x%x\":%u,", reg, s->get_reg(s, reg, mask));
+  return sprintf(p, "\"0x%x\":%u,", reg, sensor_regs_get(s, reg, mask));
 }
 
 static esp_err_t status_handler(httpd_req_t *req) {
   static char json_response[1024];
 
+  trace_instant("http /status", httpd_req_to_sockfd(req));
+
   sensor_t *s = esp_camera_sensor_get();
   char *p = json_response;
   *p++ = '{';
@@ -481,7 +833,19 @@ static esp_err_t status_handler(httpd_req_t *req) {
   p += sprintf(p, "\"hmirror\":%u,", s->status.hmirror);
   p += sprintf(p, "\"vflip\":%u,", s->status.vflip);
   p += sprintf(p, "\"dcw\":%u,", s->status.dcw);
-  p += sprintf(p, "\"colorbar\":%u", s->status.colorbar);
+  p += sprintf(p, "\"colorbar\":%u,", s->status.colorbar);
+  p += sprintf(p, "\"static_throttle\":%u,", static_throttle);
+  p += sprintf(p, "\"static_keepalive\":%d,", static_keepalive_ms);
+  p += sprintf(p, "\"send_deadline\":%d", stream_send_deadline_ms);
+  p += sprintf(p, ",\"wifi_state\":\"%s\"", WiFiManager::stateName(wifiManager.getState()));
+  p += sprintf(p, ",\"wifi_reconnects\":%u", wifiManager.getReconnectCount());
+  p += sprintf(p, ",\"wifi_downtime_ms\":%lu", wifiManager.getDowntimeMs());
+  p += sprintf(p, ",\"profile\":\"%s\"", camera_profile_current_name());
+  if (day_night) {
+    day_night_state_t dn;
+    day_night_get_state(day_night, &dn);
+    p += sprintf(p, ",\"day_night\":\"%s\",\"scene_luma\":%u,\"scene_gain\":%.1f", day_night_mode_name(dn.mode), dn.luma, dn.gain_x16 / 16.0);
+  }
 #if defined(LED_GPIO_NUM)
   p += sprintf(p, ",\"led_intensity\":%u", led_duty);
 #else
@@ -494,6 +858,213 @@ static esp_err_t status_handler(httpd_req_t *req) {
   return httpd_resp_send(req, json_response, strlen(json_response));
 }
 
+typedef struct {
+  httpd_req_t *req;
+  size_t len;
+  esp_err_t res;
+  char buf[1024];
+} chunk_out_t;
+
+// Junta as linhas em pedaços de 1 KB para não gerar um envio por linha
+static void chunk_write(void *ctx, const char *data, size_t len) {
+  chunk_out_t *out = (chunk_out_t *)ctx;
+  if (out->len + len > sizeof(out->buf)) {
+    if (out->res == ESP_OK) {
+      out->res = httpd_resp_send_chunk(out->req, out->buf, out->len);
+    }
+    out->len = 0;
+  }
+  memcpy(out->buf + out->len, data, len);
+  out->len += len;
+}
+
+static esp_err_t chunk_finish(chunk_out_t *out) {
+  if (out->res == ESP_OK && out->len) {
+    out->res = httpd_resp_send_chunk(out->req, out->buf, out->len);
+  }
+  if (out->res != ESP_OK) {
+    return out->res;
+  }
+  return httpd_resp_send_chunk(out->req, NULL, 0);
+}
+
+static esp_err_t metrics_handler(httpd_req_t *req) {
+  chunk_out_t out;
+  out.req = req;
+  out.len = 0;
+  out.res = ESP_OK;
+
+  trace_instant("http /metrics", httpd_req_to_sockfd(req));
+
+  camera_profile_stats_t profile_stats;
+  camera_profile_get_stats(&profile_stats);
+  day_night_state_t day_night_state = {};
+  if (day_night) {
+    day_night_get_state(day_night, &day_night_state);
+  }
+  sensor_regs_stats_t regs_stats;
+  sensor_regs_get_stats(&regs_stats);
+  stream_session_totals_t stream_totals;
+  stream_session_get_totals(&stream_totals);
+  mjpeg_writer_stats_t writer_stats;
+  mjpeg_writer_get_stats(&writer_stats);
+  rtsp_server_stats_t rtsp_stats;
+  rtsp_server_get_stats(&rtsp_stats);
+  mqtt_client_stats_t mqtt_stats;
+  mqtt_client_get_stats(&mqtt_stats);
+  event_log_stats_t log_stats;
+  event_log_get_stats(&log_stats);
+
+  const metrics_gauge_t gauges[] = {
+    {"camera_heap_free_bytes", "Free internal heap", (double)heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)},
+    {"camera_heap_largest_block_bytes", "Largest free internal heap block", (double)heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)},
+    {"camera_psram_free_bytes", "Free PSRAM", (double)heap_caps_get_free_size(MALLOC_CAP_SPIRAM)},
+    {"camera_psram_largest_block_bytes", "Largest free PSRAM block", (double)heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM)},
+    {"camera_stream_frame_time_avg_seconds", "Moving average of the /stream frame interval", ra_filter_avg(&ra_filter) / 1000.0},
+    {"camera_uptime_seconds", "Time since boot", esp_timer_get_time() / 1000000.0},
+    {"camera_profile_lifetime_writes", "Writes of the current profile since it was created", (double)profile_stats.lifetime_writes},
+    {"camera_scene_luma", "Average scene luminance (0-255) seen by the day/night controller", (double)day_night_state.luma},
+    {"camera_scene_gain", "Average sensor AGC gain seen by the day/night controller", day_night_state.gain_x16 / 16.0},
+    {"camera_scene_bytes_per_kpixel", "Average JPEG bytes per 1000 pixels (rises with sensor noise)", (double)day_night_state.bytes_per_kpixel},
+    {"camera_stream_clients", "Open /stream, /delta and RTSP sessions fed by the frame hub", (double)frame_hub_subscribers()},
+    {"camera_rtsp_playing", "RTSP sessions currently playing", (double)rtsp_stats.playing},
+    {"camera_rtsp_multicast_viewers", "RTSP viewers currently joined to the multicast group", (double)rtsp_stats.multicast_viewers},
+    {"camera_mqtt_connected", "1 while the MQTT broker session is up", (double)mqtt_stats.connected},
+    {"camera_mqtt_backlog", "Events waiting for the MQTT broker", (double)mqtt_stats.backlog},
+    {"camera_event_log_records", "Event records kept in the flash log", (double)log_stats.records},
+  };
+  // Só crescem desde o boot
+  const metrics_gauge_t counters[] = {
+    {"camera_wifi_reconnects_total", "WiFi reconnections since boot", (double)wifiManager.getReconnectCount()},
+    {"camera_wifi_downtime_seconds_total", "Total time without WiFi link since the first connection", wifiManager.getDowntimeMs() / 1000.0},
+    {"camera_profile_changes_total", "Sensor setting changes since boot", (double)profile_stats.changes},
+    {"camera_profile_nvs_writes_total", "Camera profile NVS writes since boot", (double)profile_stats.writes},
+    {"camera_profile_nvs_bytes_total", "Camera profile bytes written to NVS since boot", (double)profile_stats.bytes},
+    {"camera_profile_flushes_skipped_total", "Deferred profile writes skipped because nothing changed", (double)profile_stats.skipped},
+    {"camera_day_night_switches_total", "Day/night profile switches since boot", (double)day_night_state.switches},
+    {"camera_sensor_reg_cache_hits_total", "Sensor register reads answered from the RAM shadow", (double)regs_stats.hits},
+    {"camera_sensor_reg_bus_reads_total", "Sensor register reads that went to the SCCB bus", (double)regs_stats.bus_reads},
+    {"camera_sensor_reg_invalidations_total", "Driver setter calls that invalidated the register shadow", (double)regs_stats.invalidations},
+    {"camera_stream_stale_frames_total", "Frames dropped from a slow session's queue", (double)stream_totals.stale},
+    {"camera_stream_downgrades_total", "Frame rate downgrades of slow stream sessions", (double)stream_totals.downgrades},
+    {"camera_stream_deadline_closes_total", "Stream sessions closed for exceeding the send deadline", (double)stream_totals.deadline_closes},
+    {"camera_stream_socket_writes_total", "sendmsg calls for stream parts (one per frame unless the send was partial)", (double)writer_stats.writes},
+    {"camera_stream_socket_bytes_total", "Bytes written to stream sockets", (double)writer_stats.bytes},
+    {"camera_rtsp_connections_total", "RTSP connections accepted since boot", (double)rtsp_stats.connections},
+    {"camera_rtsp_frames_total", "Frames sent as RTP/JPEG", (double)rtsp_stats.frames},
+    {"camera_rtsp_packets_total", "RTP packets sent", (double)rtsp_stats.packets},
+    {"camera_rtsp_frames_cut_total", "RTP/JPEG frames cut short by a failed send", (double)rtsp_stats.frames_cut},
+    {"camera_rtsp_unsupported_frames_total", "Frames skipped because RFC 2435 cannot carry them", (double)rtsp_stats.unsupported},
+    {"camera_rtsp_sender_reports_total", "RTCP sender reports sent", (double)rtsp_stats.sender_reports},
+    {"camera_rtsp_multicast_frames_total", "Frames sent once to the multicast group", (double)rtsp_stats.multicast_frames},
+    {"camera_mqtt_events_total", "Events queued for MQTT since boot", (double)mqtt_stats.events},
+    {"camera_mqtt_published_total", "Events acknowledged by the MQTT broker", (double)mqtt_stats.published},
+    {"camera_mqtt_dropped_total", "Events dropped because the MQTT queue was full", (double)mqtt_stats.dropped},
+    {"camera_mqtt_connect_failures_total", "Failed MQTT connection attempts", (double)mqtt_stats.connect_failures},
+    {"camera_event_log_appended_total", "Events written to the flash log since boot", (double)log_stats.appended},
+    {"camera_event_log_dropped_total", "Events lost because the flash log queue was full", (double)log_stats.dropped},
+    {"camera_event_log_write_errors_total", "Failed flash log writes", (double)log_stats.write_errors},
+    {"camera_event_log_erases_total", "Flash log sectors erased since boot", (double)log_stats.erases},
+  };
+
+  httpd_resp_set_type(req, "text/plain; version=0.0.4");
+  metrics_render(chunk_write, &out, gauges, sizeof(gauges) / sizeof(gauges[0]), counters, sizeof(counters) / sizeof(counters[0]));
+  return chunk_finish(&out);
+}
+
+// Etapas do boot e perfil aplicado na inicialização da câmera. Com ?save=1
+// a configuração atual do sensor é gravada agora no perfil atual, sem
+// esperar o prazo do /control.
+static esp_err_t boot_handler(httpd_req_t *req) {
+  static char json[1024];
+  char query[32];
+  char save[4];
+  const char *save_err = NULL;
+  bool saved = false;
+
+  trace_instant("http /boot", httpd_req_to_sockfd(req));
+
+  sensor_t *s = esp_camera_sensor_get();
+  if (s && httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK && httpd_query_key_value(query, "save", save, sizeof(save)) == ESP_OK &&
+      atoi(save)) {
+    save_err = camera_profile_save(camera_profile_current_name(), s);
+    saved = !save_err;
+    log_i("Boot profile '%s' saved: %s", camera_profile_current_name(), save_err ? save_err : "ok");
+  }
+
+  const camera_profile_t *profile = camera_profile_current();
+  camera_profile_stats_t stats;
+  camera_profile_get_stats(&stats);
+
+  char *p = json;
+  p += sprintf(p, "{\"timing\":");
+  p += boot_render_json(p, sizeof(json) - 192);
+  p += sprintf(p, ",\"uptime_ms\":%.1f", esp_timer_get_time() / 1000.0);
+  p += sprintf(p, ",\"profile\":{\"name\":\"%s\",\"xclk\":%u,\"framesize\":%u,\"quality\":%u,\"writes\":%u}", camera_profile_current_name(),
+               profile->xclk_mhz, profile->framesize, profile->quality, (unsigned)stats.lifetime_writes);
+  if (saved || save_err) {
+    p += sprintf(p, ",\"saved\":%s", saved ? "true" : "false");
+  }
+  *p++ = '}';
+  *p = 0;
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return httpd_resp_send(req, json, p - json);
+}
+
+// Perfis nomeados da câmera. Sem parâmetros só lista; ?save=<nome> grava a
+// configuração atual do sensor nesse perfil (que passa a ser o atual),
+// ?select=<nome> aplica um perfil salvo e ?delete=<nome> apaga um que não
+// esteja em uso.
+static esp_err_t profile_handler(httpd_req_t *req) {
+  static char json[512];
+  char query[64];
+  char name[CAMERA_PROFILE_NAME_LEN + 1];
+  const char *err = NULL;
+
+  trace_instant("http /profile", httpd_req_to_sockfd(req));
+
+  sensor_t *s = esp_camera_sensor_get();
+  esp_err_t res = httpd_req_get_url_query_str(req, query, sizeof(query));
+  name[0] = 0;
+  if (res == ESP_ERR_HTTPD_RESULT_TRUNC) {
+    err = "query too long";
+  } else if (res == ESP_OK) {
+    // Nome cortado não pode virar outro perfil: TRUNC é erro, não ausência
+    if ((res = httpd_query_key_value(query, "save", name, sizeof(name))) == ESP_OK) {
+      err = camera_profile_save(name, s);
+    } else if (res == ESP_ERR_NOT_FOUND && (res = httpd_query_key_value(query, "select", name, sizeof(name))) == ESP_OK) {
+      err = camera_profile_select(name, s);
+    } else if (res == ESP_ERR_NOT_FOUND && (res = httpd_query_key_value(query, "delete", name, sizeof(name))) == ESP_OK) {
+      err = camera_profile_delete(name);
+    }
+    if (res == ESP_ERR_HTTPD_RESULT_TRUNC) {
+      err = "profile name too long";
+    }
+  }
+  if (err) {
+    log_w("Profile '%s': %s", name, err);
+    return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, err);
+  }
+
+  char names[CAMERA_PROFILE_MAX][CAMERA_PROFILE_NAME_LEN];
+  int count = camera_profile_list(names, CAMERA_PROFILE_MAX);
+  camera_profile_stats_t stats;
+  camera_profile_get_stats(&stats);
+
+  char *p = json;
+  p += sprintf(p, "{\"current\":\"%s\",\"profiles\":[", camera_profile_current_name());
+  for (int i = 0; i < count; i++) {
+    p += sprintf(p, "%s\"%s\"", i ? "," : "", names[i]);
+  }
+  p += sprintf(p, "],\"pending\":%s", stats.pending ? "true" : "false");
+  p += sprintf(p, ",\"changes\":%u,\"nvs_writes\":%u,\"nvs_bytes\":%u,\"skipped\":%u,\"lifetime_writes\":%u}", (unsigned)stats.changes,
+               (unsigned)stats.writes, (unsigned)stats.bytes, (unsigned)stats.skipped, (unsigned)stats.lifetime_writes);
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return httpd_resp_send(req, json, p - json);
+}
+
 static esp_err_t xclk_handler(httpd_req_t *req) {
   char *buf = NULL;
   char _xclk[32];
@@ -513,9 +1084,11 @@ static esp_err_t xclk_handler(httpd_req_t *req) {
 
   sensor_t *s = esp_camera_sensor_get();
   int res = s->set_xclk(s, LEDC_TIMER_0, xclk);
+  sensor_regs_invalidate();
   if (res) {
     return httpd_resp_send_500(req);
   }
+  camera_profile_touch(esp_timer_get_time());
 
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
   return httpd_resp_send(req, NULL, 0);
@@ -544,7 +1117,7 @@ static esp_err_t reg_handler(httpd_req_t *req) {
   log_i("Set Register: reg: 0x%02x, mask: 0x%02x, value: 0x%02x", reg, mask, val);
 
   sensor_t *s = esp_camera_sensor_get();
-  int res = s->set_reg(s, reg, mask, val);
+  int res = sensor_regs_set(s, reg, mask, val);
   if (res) {
     return httpd_resp_send_500(req);
   }
@@ -553,15 +1126,21 @@ static esp_err_t reg_handler(httpd_req_t *req) {
   return httpd_resp_send(req, NULL, 0);
 }
 
+// Valor de um registrador (?reg=&mask=), da cópia em RAM quando ela vale;
+// ?reg=&count= lê do barramento os count registradores a partir de reg e
+// responde em JSON, para diagnóstico
 static esp_err_t greg_handler(httpd_req_t *req) {
   char *buf = NULL;
   char _reg[32];
   char _mask[32];
+  char _count[32];
 
   if (parse_get(req, &buf) != ESP_OK) {
     return ESP_FAIL;
   }
-  if (httpd_query_key_value(buf, "reg", _reg, sizeof(_reg)) != ESP_OK || httpd_query_key_value(buf, "mask", _mask, sizeof(_mask)) != ESP_OK) {
+  bool range = httpd_query_key_value(buf, "count", _count, sizeof(_count)) == ESP_OK;
+  if (httpd_query_key_value(buf, "reg", _reg, sizeof(_reg)) != ESP_OK
+      || (!range && httpd_query_key_value(buf, "mask", _mask, sizeof(_mask)) != ESP_OK)) {
     free(buf);
     httpd_resp_send_404(req);
     return ESP_FAIL;
@@ -569,9 +1148,32 @@ static esp_err_t greg_handler(httpd_req_t *req) {
   free(buf);
 
   int reg = atoi(_reg);
-  int mask = atoi(_mask);
   sensor_t *s = esp_camera_sensor_get();
-  int res = s->get_reg(s, reg, mask);
+  if (range) {
+    static char json[SENSOR_REGS_RANGE_MAX * 16 + 8];
+    int values[SENSOR_REGS_RANGE_MAX];
+    int count = atoi(_count);
+    if (reg < 0 || count < 1 || count > SENSOR_REGS_RANGE_MAX) {
+      return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "invalid count");
+    }
+    int n = sensor_regs_read_range(s, reg, count, values);
+    if (!n) {
+      return httpd_resp_send_500(req);
+    }
+    log_i("Get Registers: reg: 0x%02x, count: %d", reg, n);
+    char *p = json;
+    *p++ = '{';
+    for (int i = 0; i < n; i++) {
+      p += sprintf(p, "%s\"0x%x\":%d", i ? "," : "", reg + i, values[i]);
+    }
+    *p++ = '}';
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+    return httpd_resp_send(req, json, p - json);
+  }
+
+  int mask = atoi(_mask);
+  int res = sensor_regs_get(s, reg, mask);
   if (res < 0) {
     return httpd_resp_send_500(req);
   }
@@ -611,6 +1213,7 @@ static esp_err_t pll_handler(httpd_req_t *req) {
   log_i("Set Pll: bypass: %d, mul: %d, sys: %d, root: %d, pre: %d, seld5: %d, pclken: %d, pclk: %d", bypass, mul, sys, root, pre, seld5, pclken, pclk);
   sensor_t *s = esp_camera_sensor_get();
   int res = s->set_pll(s, bypass, mul, sys, root, pre, seld5, pclken, pclk);
+  sensor_regs_invalidate();
   if (res) {
     return httpd_resp_send_500(req);
   }
@@ -646,6 +1249,7 @@ static esp_err_t win_handler(httpd_req_t *req) {
   );
   sensor_t *s = esp_camera_sensor_get();
   int res = s->set_res_raw(s, startX, startY, endX, endY, offsetX, offsetY, totalX, totalY, outputX, outputY, scale, binning);
+  sensor_regs_invalidate();
   if (res) {
     return httpd_resp_send_500(req);
   }
@@ -654,52 +1258,458 @@ static esp_err_t win_handler(httpd_req_t *req) {
   return httpd_resp_send(req, NULL, 0);
 }
 
-static esp_err_t index_handler(httpd_req_t *req) {
-  httpd_resp_set_type(req, "text/html");
+// Pan/zoom no sensor. Sem parâmetros só mostra a ROI e a janela em uso;
+// ?zoom=<%>&cx=<‰>&cy=<‰> (qualquer um deles) move a janela, ?preset=<nome>
+// aplica um preset, ?save=<nome> guarda a ROI atual como preset e
+// ?delete=<nome> apaga um. A ROI faz parte do perfil atual da câmera.
+static esp_err_t roi_handler(httpd_req_t *req) {
+  static char json[768];
+  char query[96];
+  char name[CAMERA_WINDOW_NAME_LEN + 1];
+  const char *err = NULL;
+  bool moved = false;
+
+  trace_instant("http /roi", httpd_req_to_sockfd(req));
+
+  sensor_t *s = esp_camera_sensor_get();
+  camera_roi_t roi;
+  camera_window_current(s, &roi);
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+    if (httpd_query_key_value(query, "preset", name, sizeof(name)) == ESP_OK) {
+      err = camera_window_preset_get(name, &roi);
+      moved = !err;
+    } else if (httpd_query_key_value(query, "save", name, sizeof(name)) == ESP_OK) {
+      err = camera_window_preset_save(name, &roi);
+    } else if (httpd_query_key_value(query, "delete", name, sizeof(name)) == ESP_OK) {
+      err = camera_window_preset_delete(name);
+    } else {
+      roi.zoom_pct = parse_get_var(query, "zoom", roi.zoom_pct);
+      roi.cx_permille = parse_get_var(query, "cx", roi.cx_permille);
+      roi.cy_permille = parse_get_var(query, "cy", roi.cy_permille);
+      moved = true;
+    }
+    if (moved && s->pixformat != PIXFORMAT_JPEG) {
+      err = "jpeg only";
+    } else if (moved) {
+      err = camera_window_apply(s, &roi);
+    }
+    if (err) {
+      log_w("ROI: %s", err);
+      return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, err);
+    }
+    if (moved) {
+      camera_profile_touch(esp_timer_get_time());
+    }
+  }
+
+  camera_window_current(s, &roi);
+  char names[CAMERA_WINDOW_PRESET_MAX + 3][CAMERA_WINDOW_NAME_LEN];
+  int count = camera_window_preset_list(names, sizeof(names) / sizeof(names[0]));
+
+  char *p = json;
+  p += sprintf(p, "{\"zoom\":%u,\"cx\":%u,\"cy\":%u", roi.zoom_pct, roi.cx_permille, roi.cy_permille);
+  camera_window_t win;
+  if (camera_window_get(s, &win)) {
+    p += sprintf(p, ",\"window\":{\"mode\":\"%s\",\"x\":%u,\"y\":%u,\"w\":%u,\"h\":%u,\"output\":[%u,%u]}", camera_window_mode_name(win.mode),
+                 win.sensor_x, win.sensor_y, win.sensor_w, win.sensor_h, win.output_x, win.output_y);
+  } else {
+    p += sprintf(p, ",\"window\":null");
+  }
+  p += sprintf(p, ",\"presets\":[");
+  for (int i = 0; i < count; i++) {
+    p += sprintf(p, "%s\"%s\"", i ? "," : "", names[i]);
+  }
+  p += sprintf(p, "]}");
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return httpd_resp_send(req, json, p - json);
+}
+
+// Sessões de fluxo abertas, com os números de cada uma; ?kill=<id> encerra
+// uma sessão (no próximo quadro, ou quando o envio travado estourar o prazo)
+static esp_err_t sessions_handler(httpd_req_t *req) {
+  static char json[STREAM_SESSION_MAX * 384 + 16];
+  static stream_session_info_t list[STREAM_SESSION_MAX];
+  char query[32];
+
+  trace_instant("http /sessions", httpd_req_to_sockfd(req));
+
+  if (httpd_req_get_url_query_str(req, query, sizeof(query)) == ESP_OK) {
+    int id = parse_get_var(query, "kill", 0);
+    if (id <= 0 || !stream_session_kill(id)) {
+      return httpd_resp_send_err(req, HTTPD_404_NOT_FOUND, "session not found");
+    }
+    log_i("Session %d: kill requested", id);
+  }
+
+  int64_t now = esp_timer_get_time();
+  int n = stream_session_list(list, STREAM_SESSION_MAX, now);
+  char *p = json;
+  *p++ = '[';
+  for (int i = 0; i < n; i++) {
+    const stream_session_info_t *info = &list[i];
+    p += sprintf(p, "%s{\"id\":%u,\"endpoint\":\"%s\",\"peer\":\"%s\",\"params\":\"", i ? "," : "", info->id, info->endpoint, info->peer);
+    // A query vem do cliente: só o que não quebra o JSON
+    for (const char *c = info->params; *c; c++) {
+      if (*c != '"' && *c != '\\' && (unsigned char)*c >= 0x20) {
+        *p++ = *c;
+      }
+    }
+    p += sprintf(p, "\",\"age_ms\":%u,\"frames\":%u,\"bytes\":%llu,\"fps\":%.1f", info->age_ms, info->frames, (unsigned long long)info->bytes,
+                 info->fps_x10 / 10.0);
+    p += sprintf(p, ",\"send_ms\":{\"p50\":%.1f,\"p95\":%.1f,\"p99\":%.1f}", info->send_p50_us / 1000.0, info->send_p95_us / 1000.0,
+                 info->send_p99_us / 1000.0);
+    p += sprintf(p, ",\"level\":%u,\"stale\":%u,\"downgrades\":%u,\"killed\":%s}", info->level, info->stale, info->downgrades,
+                 info->killed ? "true" : "false");
+  }
+  *p++ = ']';
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return httpd_resp_send(req, json, p - json);
+}
+
+// Publicador MQTT: /mqtt mostra a configuração (sem a senha) e o estado;
+// com host, port, user, pass, prefix, heartbeat ou snapshot na query, troca
+// só o que veio, grava no NVS e reconecta (host vazio desliga). Os valores
+// vão como chegam, sem decodificar %XX.
+static esp_err_t mqtt_handler(httpd_req_t *req) {
+  static char json[512];
+  char value[64];
+  mqtt_config_t cfg;
+
+  trace_instant("http /mqtt", httpd_req_to_sockfd(req));
+
+  mqtt_client_get_config(&cfg);
+  if (httpd_req_get_url_query_len(req)) {
+    char *buf = NULL;
+    if (parse_get(req, &buf) != ESP_OK) {
+      return ESP_FAIL;
+    }
+    bool changed = false;
+    struct {
+      const char *key;
+      char *field;
+      size_t cap;
+    } texts[] = {{"host", cfg.host, sizeof(cfg.host)}, {"user", cfg.user, sizeof(cfg.user)}, {"pass", cfg.pass, sizeof(cfg.pass)},
+                 {"prefix", cfg.prefix, sizeof(cfg.prefix)}};
+    for (size_t i = 0; i < sizeof(texts) / sizeof(texts[0]); i++) {
+      if (httpd_query_key_value(buf, texts[i].key, value, sizeof(value)) == ESP_OK) {
+        snprintf(texts[i].field, texts[i].cap, "%s", value);
+        changed = true;
+      }
+    }
+    if (httpd_query_key_value(buf, "port", value, sizeof(value)) == ESP_OK) {
+      cfg.port = atoi(value);
+      changed = true;
+    }
+    if (httpd_query_key_value(buf, "heartbeat", value, sizeof(value)) == ESP_OK) {
+      cfg.heartbeat_s = atoi(value);
+      changed = true;
+    }
+    if (httpd_query_key_value(buf, "snapshot", value, sizeof(value)) == ESP_OK) {
+      cfg.snapshot = atoi(value) != 0;
+      changed = true;
+    }
+    free(buf);
+    if (changed && !mqtt_client_configure(&cfg)) {
+      return httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "invalid MQTT settings");
+    }
+    if (changed) {
+      log_i("MQTT: settings changed (host '%s')", cfg.host);
+    }
+  }
+
+  mqtt_client_stats_t stats;
+  mqtt_client_get_stats(&stats);
+  char *p = json;
+  p += sprintf(p, "{\"host\":\"%s\",\"port\":%u,\"user\":\"%s\",\"prefix\":\"%s\",\"heartbeat\":%u,\"snapshot\":%s", cfg.host, cfg.port, cfg.user,
+               cfg.prefix, cfg.heartbeat_s, cfg.snapshot ? "true" : "false");
+  p += sprintf(p, ",\"connected\":%s,\"connects\":%u,\"connect_failures\":%u,\"events\":%u,\"published\":%u", stats.connected ? "true" : "false",
+               stats.connects, stats.connect_failures, stats.events, stats.published);
+  p += sprintf(p, ",\"resent\":%u,\"dropped\":%u,\"backlog\":%u,\"heartbeats\":%u,\"snapshots\":%u,\"last_flush_ms\":%u}", stats.resent,
+               stats.dropped, stats.backlog, stats.heartbeats, stats.snapshots, stats.last_flush_ms);
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return httpd_resp_send(req, json, p - json);
+}
+
+// Histórico da flash: /events?from=&to= (unix, em s com fração; sem from,
+// desde o mais antigo; sem to, até o mais novo), limit (até
+// EVENTS_QUERY_MAX) e type=motion|tamper. Com mais registros no intervalo,
+// "next" traz o from da próxima página.
+static esp_err_t events_handler(httpd_req_t *req) {
+  static event_log_entry_t entries[EVENTS_QUERY_MAX];
+  char value[24];
+  int64_t from_ms = 0, to_ms = INT64_MAX, next_ms = 0;
+  int limit = EVENTS_QUERY_DEFAULT;
+  uint8_t type = 0;
+
+  trace_instant("http /events", httpd_req_to_sockfd(req));
+
+  if (httpd_req_get_url_query_len(req)) {
+    char *buf = NULL;
+    if (parse_get(req, &buf) != ESP_OK) {
+      return ESP_FAIL;
+    }
+    if (httpd_query_key_value(buf, "from", value, sizeof(value)) == ESP_OK) {
+      from_ms = (int64_t)(strtod(value, NULL) * 1000);
+    }
+    if (httpd_query_key_value(buf, "to", value, sizeof(value)) == ESP_OK) {
+      to_ms = (int64_t)(strtod(value, NULL) * 1000);
+    }
+    limit = parse_get_var(buf, "limit", EVENTS_QUERY_DEFAULT);
+    if (httpd_query_key_value(buf, "type", value, sizeof(value)) == ESP_OK) {
+      type = !strcmp(value, "motion") ? EVENT_LOG_MOTION : !strcmp(value, "tamper") ? EVENT_LOG_TAMPER : 0xFF;
+    }
+    free(buf);
+  }
+  limit = limit < 1 ? 1 : (limit > EVENTS_QUERY_MAX ? EVENTS_QUERY_MAX : limit);
+
+  int64_t start_us = esp_timer_get_time();
+  int n = event_log_query(from_ms, to_ms, type, entries, limit, &next_ms);
+  uint32_t query_us = esp_timer_get_time() - start_us;
+  event_log_stats_t stats;
+  event_log_get_stats(&stats);
+
+  chunk_out_t out;
+  out.req = req;
+  out.len = 0;
+  out.res = ESP_OK;
+  char line[192];
+  int len = snprintf(line, sizeof(line), "{\"records\":%u,\"oldest\":%.3f,\"newest\":%.3f,\"count\":%d,\"query_us\":%u,\"next\":", stats.records,
+                     stats.oldest_ms / 1000.0, stats.newest_ms / 1000.0, n, query_us);
+  len += next_ms ? snprintf(line + len, sizeof(line) - len, "%.3f", next_ms / 1000.0) : snprintf(line + len, sizeof(line) - len, "null");
+  len += snprintf(line + len, sizeof(line) - len, ",\"events\":[");
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  chunk_write(&out, line, len);
+  for (int i = 0; i < n; i++) {
+    const event_log_entry_t *e = &entries[i];
+    len = snprintf(line, sizeof(line), "%s{\"time\":%.3f,\"type\":\"%s\",\"state\":\"%s\",\"score\":%u,\"box\":[%.3f,%.3f,%.3f,%.3f]%s}",
+                   i ? "," : "", e->time_ms / 1000.0, event_log_type_name(e->type), e->flags & EVENT_LOG_END ? "end" : "start", e->score,
+                   e->box[0] / 255.0, e->box[1] / 255.0, e->box[2] / 255.0, e->box[3] / 255.0,
+                   e->flags & EVENT_LOG_UNSYNCED ? ",\"unsynced\":true" : "");
+    chunk_write(&out, line, len);
+  }
+  chunk_write(&out, "]}", 2);
+  return chunk_finish(&out);
+}
+
+// Dump do anel de eventos no formato do Chrome/Perfetto:
+//   /trace?ms=2000 (últimos 2 s; sem ms = anel inteiro)
+static esp_err_t trace_handler(httpd_req_t *req) {
+  chunk_out_t out;
+  out.req = req;
+  out.len = 0;
+  out.res = ESP_OK;
+  int ms = 0;
+
+  if (httpd_req_get_url_query_len(req)) {
+    char *buf = NULL;
+    if (parse_get(req, &buf) != ESP_OK) {
+      return ESP_FAIL;
+    }
+    ms = parse_get_var(buf, "ms", 0);
+    free(buf);
+  }
+
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=trace.json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  trace_dump(chunk_write, &out, (int64_t)ms * 1000);
+  return chunk_finish(&out);
+}
+
+// Fluxo experimental: apenas as MCUs alteradas + keyframes periódicos.
+// Parâmetros: key (quadros entre keyframes), dc e ac (limiares de mudança).
+static void delta_stream_task(void *arg) {
+  stream_ctx_t *ctx = (stream_ctx_t *)arg;
+  jpeg_delta_encoder_t *enc = ctx->delta;
+  char part_buf[128];
+  esp_err_t res = ESP_OK;
+  uint32_t stale = 0;
+  int encode_failures = 0;
+
+  while (true) {
+    if (stream_session_killed(ctx->session)) {
+      log_i("Delta stream %s closed from /sessions", ctx->peer);
+      break;
+    }
+    hub_frame_t *frame = frame_hub_receive(ctx->sub, STREAM_RECEIVE_MS);
+    stale += frame_hub_take_stale(ctx->sub);
+    if (!frame) {
+      continue;
+    }
+
+    // O pacote fica no buffer do codificador: o quadro volta logo ao hub
+    struct timeval ts = frame->timestamp;
+    const uint8_t *pkt = NULL;
+    size_t pkt_len = jpeg_delta_encode(enc, frame->buf, frame->len, &pkt);
+    frame_hub_release(frame);
+    if (!pkt_len) {
+      metrics_drop(METRIC_DROP_ENCODE);
+      // Quadro que o codificador não entende (outro formato, JPEG truncado)
+      // tende a se repetir: desiste em vez de girar sem enviar nada
+      if (++encode_failures >= DELTA_ENCODE_FAILURES_MAX) {
+        log_e("Delta stream %s: %d frames in a row failed to encode, closing", ctx->peer, encode_failures);
+        break;
+      }
+      log_w("Delta encode failed, retrying with keyframe");
+      continue;
+    }
+    encode_failures = 0;
+
+    int64_t t_send = esp_timer_get_time();
+    size_t hlen = snprintf(part_buf, sizeof(part_buf), _DELTA_PART, pkt_len, ts.tv_sec, ts.tv_usec);
+    res = mjpeg_writer_part(ctx->fd, part_buf, hlen, pkt, pkt_len, _STREAM_BOUNDARY);
+    int64_t t_sent = esp_timer_get_time();
+    if (res != ESP_OK || send_deadline_hit(t_sent - t_send)) {
+      if (send_deadline_hit(t_sent - t_send)) {
+        log_w("Delta stream %s: send over the %d ms deadline", ctx->peer, stream_send_deadline_ms);
+        stream_session_deadline(ctx->session);
+      }
+      metrics_drop(METRIC_DROP_SEND);
+      break;
+    }
+    size_t sent = hlen + pkt_len + strlen(_STREAM_BOUNDARY);
+    metrics_client_sent(ctx->client, sent);
+    stream_pace(ctx, stream_session_frame(ctx->session, sent, t_sent - t_send, stale, t_sent), t_sent);
+    stale = 0;
+
+    log_i("DELTA: %uB, %u MCUs changed", (uint32_t)pkt_len, jpeg_delta_get_stats(enc)->last_changed);
+  }
+
+  log_i("Delta stream closed: %u frames, %llu -> %llu bytes", jpeg_delta_get_stats(enc)->frames, jpeg_delta_get_stats(enc)->bytes_in,
+        jpeg_delta_get_stats(enc)->bytes_out);
+  stream_finish(ctx);
+  vTaskDelete(NULL);
+}
+
+static esp_err_t delta_stream_handler(httpd_req_t *req) {
+  jpeg_delta_params_t params = {30, 2, 24};
+
+  trace_instant("http /delta", httpd_req_to_sockfd(req));
+
+  if (httpd_req_get_url_query_len(req)) {
+    char *buf = NULL;
+    if (parse_get(req, &buf) != ESP_OK) {
+      return ESP_FAIL;
+    }
+    params.keyframe_interval = parse_get_var(buf, "key", params.keyframe_interval);
+    params.dc_threshold = parse_get_var(buf, "dc", params.dc_threshold);
+    params.ac_threshold = parse_get_var(buf, "ac", params.ac_threshold);
+    free(buf);
+  }
+
+  stream_ctx_t *ctx = (stream_ctx_t *)calloc(1, sizeof(stream_ctx_t));
+  if (ctx) {
+    ctx->delta = jpeg_delta_encoder_new(&params);
+  }
+  if (!ctx || !ctx->delta) {
+    log_e("Delta encoder allocation failed");
+    free(ctx);
+    return httpd_resp_send_500(req);
+  }
+  esp_err_t res = stream_start(req, ctx, "delta", delta_stream_task);
+  if (res != ESP_OK) {
+    jpeg_delta_encoder_free(ctx->delta);
+    free(ctx);
+  }
+  return res;
+}
+
+// Páginas vêm pré-comprimidas do build (tools/build_assets.py) ou da
+// partição "fr" (web_store.h), sempre com ETag: recarregamentos recebem 304
+static esp_err_t send_asset(httpd_req_t *req, const web_asset_t *asset) {
+  char etag[32];
+  asset = web_store_get(asset);
+  if (!asset->data) {
+    log_e("Page %s not in flash and not built in", asset->name);
+    httpd_resp_send_404(req);
+    return ESP_FAIL;
+  }
+  httpd_resp_set_hdr(req, "ETag", asset->etag);
+  httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+  if (httpd_req_get_hdr_value_str(req, "If-None-Match", etag, sizeof(etag)) == ESP_OK && !strcmp(etag, asset->etag)) {
+    httpd_resp_set_status(req, "304 Not Modified");
+    return httpd_resp_send(req, NULL, 0);
+  }
+  httpd_resp_set_type(req, asset->content_type);
   httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
-  return httpd_resp_send(req, (const char *)index_ov2640_html_gz, index_ov2640_html_gz_len);
+  return httpd_resp_send(req, (const char *)asset->data, asset->len);
+}
+
+static esp_err_t index_handler(httpd_req_t *req) {
+  trace_instant("http /", httpd_req_to_sockfd(req));
+  sensor_t *s = esp_camera_sensor_get();
+  if (s != NULL) {
+    if (s->id.PID == OV3660_PID) {
+      return send_asset(req, &asset_index_ov3660_html);
+    } else if (s->id.PID == OV5640_PID) {
+      return send_asset(req, &asset_index_ov5640_html);
+    }
+  }
+  return send_asset(req, &asset_index_ov2640_html);
+}
+
+// Lista as páginas da partição "fr"
+static esp_err_t webfs_list_handler(httpd_req_t *req) {
+  httpd_resp_set_type(req, "application/json");
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  httpd_resp_sendstr_chunk(req, "[");
+  for (int i = 0; i < web_store_count(); i++) {
+    const web_asset_t *a = web_store_at(i);
+    char line[128];
+    snprintf(line, sizeof(line), "%s{\"name\":\"%s\",\"size\":%u,\"etag\":%s}", i ? "," : "", a->name, (unsigned)a->len, a->etag);
+    httpd_resp_sendstr_chunk(req, line);
+  }
+  httpd_resp_sendstr_chunk(req, "]");
+  return httpd_resp_sendstr_chunk(req, NULL);
+}
+
+// Recebe um arquivo gerado por tools/mkwebfs e grava na partição "fr":
+//   curl --data-binary @webfs.bin http://<ip>/webfs
+static esp_err_t webfs_upload_handler(httpd_req_t *req) {
+  char buf[1024];
+  size_t remaining = req->content_len;
+
+  esp_err_t err = web_store_update_begin(remaining);
+  if (err != ESP_OK) {
+    log_e("webfs upload of %u bytes refused: %s", (unsigned)remaining, esp_err_to_name(err));
+    httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Invalid size or no 'fr' partition");
+    return ESP_FAIL;
+  }
+  while (remaining > 0 && err == ESP_OK) {
+    int n = httpd_req_recv(req, buf, remaining < sizeof(buf) ? remaining : sizeof(buf));
+    if (n == HTTPD_SOCK_ERR_TIMEOUT) {
+      continue;
+    }
+    if (n <= 0) {
+      err = ESP_FAIL;
+      break;
+    }
+    err = web_store_update_write((const uint8_t *)buf, n);
+    remaining -= n;
+  }
+  const char *msg = web_store_update_end();
+  if (err != ESP_OK || msg) {
+    log_e("webfs upload failed: %s", msg ? msg : esp_err_to_name(err));
+    httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR, msg ? msg : "Flash write failed");
+    return ESP_FAIL;
+  }
+  log_i("webfs updated: %d pages", web_store_count());
+  httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
+  return webfs_list_handler(req);
 }
 
 static esp_err_t wifi_reset_handler(httpd_req_t *req) {
   log_i("WiFi reset requested via HTTP");
   
-  // Resetar WiFi
-  wifiManager.resetWiFi();
-  
-  // Resposta de confirmação
-  String response = "<!DOCTYPE html>";
-  response += "<html>";
-  response += "<head>";
-  response += "<meta charset=\"UTF-8\">";
-  response += "<title>WiFi Resetado - ESP32-CAM</title>";
-  response += "<style>";
-  response += "body { font-family: Arial, sans-serif; max-width: 400px; margin: 50px auto; padding: 20px; background-color: #f5f5f5; }";
-  response += ".container { background: white; padding: 30px; border-radius: 10px; box-shadow: 0 2px 10px rgba(0,0,0,0.1); text-align: center; }";
-  response += ".success { color: #28a745; font-size: 48px; margin-bottom: 20px; }";
-  response += "h1 { color: #333; margin-bottom: 20px; }";
-  response += ".info { background-color: #d4edda; padding: 15px; border-radius: 5px; margin: 20px 0; border-left: 4px solid #28a745; }";
-  response += "</style>";
-  response += "</head>";
-  response += "<body>";
-  response += "<div class=\"container\">";
-  response += "<div class=\"success\">🔄</div>";
-  response += "<h1>WiFi Resetado!</h1>";
-  response += "<div class=\"info\">";
-  response += "<strong>Reiniciando...</strong><br>";
-  response += "O ESP32-CAM será reiniciado e entrará no modo de configuração.";
-  response += "</div>";
-  response += "<p>Conecte-se ao WiFi 'ESP32-CAM-Config' para reconfigurar.</p>";
-  response += "</div>";
-  response += "</body>";
-  response += "</html>";
-  
-  httpd_resp_set_type(req, "text/html");
+  // O loop() apaga as credenciais (a máquina de estados lê as mesmas
+  // Strings) e reinicia depois que a resposta saiu
+  wifiManager.requestReset(2000);
   httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
-  httpd_resp_send(req, response.c_str(), response.length());
-  
-  // Reiniciar após um pequeno delay
-  delay(2000);
-  ESP.restart();
+  send_asset(req, &asset_wifi_reset_html);
   
   return ESP_OK;
 }
@@ -710,7 +1720,11 @@ void startCameraServer() {
   test_camera();
   
   httpd_config_t config = HTTPD_DEFAULT_CONFIG();
-  config.max_uri_handlers = 16;
+  config.max_uri_handlers = 24;
+  // /metrics, /trace e /events montam na pilha da tarefa do httpd o buffer
+  // de 1 KB da resposta em pedaços, além das tabelas de gauges e contadores
+  // (/metrics): os 4096 bytes do padrão não deixam folga para o vsnprintf
+  config.stack_size = 8192;
 
   httpd_uri_t index_uri = {
     .uri = "/",
@@ -778,6 +1792,19 @@ void startCameraServer() {
 #endif
   };
 
+  httpd_uri_t delta_uri = {
+    .uri = "/delta",
+    .method = HTTP_GET,
+    .handler = delta_stream_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    ,
+    .is_websocket = true,
+    .handle_ws_control_frames = false,
+    .supported_subprotocol = NULL
+#endif
+  };
+
   httpd_uri_t bmp_uri = {
     .uri = "/bmp",
     .method = HTTP_GET,
@@ -869,7 +1896,169 @@ void startCameraServer() {
 #endif
   };
 
-  ra_filter_init(&ra_filter, 20);
+  httpd_uri_t metrics_uri = {
+    .uri = "/metrics",
+    .method = HTTP_GET,
+    .handler = metrics_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    ,
+    .is_websocket = true,
+    .handle_ws_control_frames = false,
+    .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t boot_uri = {
+    .uri = "/boot",
+    .method = HTTP_GET,
+    .handler = boot_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    ,
+    .is_websocket = true,
+    .handle_ws_control_frames = false,
+    .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t roi_uri = {
+    .uri = "/roi",
+    .method = HTTP_GET,
+    .handler = roi_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    ,
+    .is_websocket = true,
+    .handle_ws_control_frames = false,
+    .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t events_uri = {
+    .uri = "/events",
+    .method = HTTP_GET,
+    .handler = events_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    ,
+    .is_websocket = true,
+    .handle_ws_control_frames = false,
+    .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t mqtt_uri = {
+    .uri = "/mqtt",
+    .method = HTTP_GET,
+    .handler = mqtt_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    ,
+    .is_websocket = true,
+    .handle_ws_control_frames = false,
+    .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t sessions_uri = {
+    .uri = "/sessions",
+    .method = HTTP_GET,
+    .handler = sessions_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    ,
+    .is_websocket = true,
+    .handle_ws_control_frames = false,
+    .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t profile_uri = {
+    .uri = "/profile",
+    .method = HTTP_GET,
+    .handler = profile_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    ,
+    .is_websocket = true,
+    .handle_ws_control_frames = false,
+    .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t trace_uri = {
+    .uri = "/trace",
+    .method = HTTP_GET,
+    .handler = trace_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    ,
+    .is_websocket = true,
+    .handle_ws_control_frames = false,
+    .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t webfs_uri = {
+    .uri = "/webfs",
+    .method = HTTP_GET,
+    .handler = webfs_list_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    ,
+    .is_websocket = true,
+    .handle_ws_control_frames = false,
+    .supported_subprotocol = NULL
+#endif
+  };
+
+  httpd_uri_t webfs_upload_uri = {
+    .uri = "/webfs",
+    .method = HTTP_POST,
+    .handler = webfs_upload_handler,
+    .user_ctx = NULL
+#ifdef CONFIG_HTTPD_WS_SUPPORT
+    ,
+    .is_websocket = true,
+    .handle_ws_control_frames = false,
+    .supported_subprotocol = NULL
+#endif
+  };
+
+  // O servidor para no portal e volta na reconexão: o filtro, a trava e o
+  // detector são criados uma vez só
+  if (!ra_filter.values) {
+    ra_filter_init(&ra_filter, 20);
+  }
+  if (!ra_lock) {
+    ra_lock = xSemaphoreCreateMutex();
+  }
+  if (!hub_scene) {
+    scene_params_t scene_params = {40, 4, 5};
+    hub_scene = scene_detector_new(&scene_params);
+  }
+  if (!day_night) {
+    // Noite: escuro mesmo com o AGC (luma < 50) ou ganho de 16x; dia: ganho
+    // até 1,5x com luma >= 80; cada troca espera 10 s de condição estável
+    day_night_params_t day_night_params = {50, 80, 16 * 16, 24, 10000};
+    day_night = day_night_new(&day_night_params, DAY_NIGHT_DAY);
+  }
+
+  sensor_regs_begin();
+  stream_session_begin();
+  if (!frame_hub_begin(analyze_frame)) {
+    log_e("Frame hub start failed");
+  }
+  if (!mqtt_client_start(mqtt_status)) {
+    log_e("MQTT publisher start failed");
+  }
+  event_log_stats_t log_stats;
+  event_log_get_stats(&log_stats);
+  if (log_stats.mounted) {
+    // O histórico só tem sentido com o analisador vendo a cena o tempo todo
+    frame_hub_keep_capturing(true);
+  }
 
   log_i("Starting web server on port: '%d'", config.server_port);
   if (httpd_start(&camera_httpd, &config) == ESP_OK) {
@@ -885,6 +2074,16 @@ void startCameraServer() {
     httpd_register_uri_handler(camera_httpd, &pll_uri);
     httpd_register_uri_handler(camera_httpd, &win_uri);
     httpd_register_uri_handler(camera_httpd, &wifi_reset_uri);
+    httpd_register_uri_handler(camera_httpd, &metrics_uri);
+    httpd_register_uri_handler(camera_httpd, &trace_uri);
+    httpd_register_uri_handler(camera_httpd, &boot_uri);
+    httpd_register_uri_handler(camera_httpd, &profile_uri);
+    httpd_register_uri_handler(camera_httpd, &roi_uri);
+    httpd_register_uri_handler(camera_httpd, &sessions_uri);
+    httpd_register_uri_handler(camera_httpd, &mqtt_uri);
+    httpd_register_uri_handler(camera_httpd, &events_uri);
+    httpd_register_uri_handler(camera_httpd, &webfs_uri);
+    httpd_register_uri_handler(camera_httpd, &webfs_upload_uri);
   }
 
   config.server_port += 1;
@@ -892,7 +2091,37 @@ void startCameraServer() {
   log_i("Starting stream server on port: '%d'", config.server_port);
   if (httpd_start(&stream_httpd, &config) == ESP_OK) {
     httpd_register_uri_handler(stream_httpd, &stream_uri);
+    httpd_register_uri_handler(stream_httpd, &delta_uri);
+  }
+
+  log_i("Starting RTSP server on port: '%d'", RTSP_SERVER_PORT);
+  if (!rtsp_server_start(RTSP_SERVER_PORT)) {
+    log_e("RTSP server start failed");
+  }
+}
+
+// Libera as portas 80/81 (o portal de configuração usa a 80). As sessões de
+// fluxo rodam fora do servidor: são encerradas e esperadas antes do stop,
+// que espera os outros handlers em andamento.
+void stopCameraServer() {
+  static stream_session_info_t list[STREAM_SESSION_MAX];
+  int n = stream_session_list(list, STREAM_SESSION_MAX, esp_timer_get_time());
+  for (int i = 0; i < n; i++) {
+    stream_session_kill(list[i].id);
+  }
+  int64_t give_up = esp_timer_get_time() + (int64_t)(stream_send_deadline_ms + STREAM_RECEIVE_MS) * 1000;
+  while (frame_hub_subscribers() && esp_timer_get_time() < give_up) {
+    vTaskDelay(LINK_POLL_MS / portTICK_PERIOD_MS);
+  }
+  if (stream_httpd) {
+    httpd_stop(stream_httpd);
+    stream_httpd = NULL;
+  }
+  if (camera_httpd) {
+    httpd_stop(camera_httpd);
+    camera_httpd = NULL;
   }
+  log_i("Camera server stopped");
 }
 
 void setupLedFlash() {
@@ -0,0 +1,101 @@
+#include "boot_timing.h"
+#include <stdarg.h>
+#include <stdio.h>
+
+#include "trace.h"
+
+typedef struct {
+  const char *name;
+  int64_t start_us;
+  int64_t end_us;  // 0 enquanto aberta
+} stage_t;
+
+static const char *mark_names[BOOT_MARK_COUNT] = {"setup_done", "got_ip", "first_frame"};
+
+static stage_t stages[BOOT_MAX_STAGES];
+static int stage_count;  // publicado com release depois de preencher a etapa
+static int64_t marks[BOOT_MARK_COUNT];
+
+static void close_open_stage(int64_t now_us) {
+  int n = __atomic_load_n(&stage_count, __ATOMIC_RELAXED);
+  if (n && !stages[n - 1].end_us) {
+    __atomic_store_n(&stages[n - 1].end_us, now_us, __ATOMIC_RELEASE);
+    trace_end(stages[n - 1].name);
+  }
+}
+
+void boot_stage(const char *name, int64_t now_us) {
+  close_open_stage(now_us);
+  int n = __atomic_load_n(&stage_count, __ATOMIC_RELAXED);
+  if (n >= BOOT_MAX_STAGES) {
+    return;
+  }
+  stages[n].name = name;
+  stages[n].start_us = now_us;
+  stages[n].end_us = 0;
+  __atomic_store_n(&stage_count, n + 1, __ATOMIC_RELEASE);
+  trace_begin(name, 0);
+}
+
+void boot_stages_done(int64_t now_us) {
+  close_open_stage(now_us);
+  boot_mark(BOOT_MARK_SETUP_DONE, now_us);
+}
+
+void boot_mark(boot_mark_t mark, int64_t now_us) {
+  if (__atomic_load_n(&marks[mark], __ATOMIC_RELAXED)) {
+    return;
+  }
+  int64_t expected = 0;
+  // now_us 0 seria lido como "sem marco"
+  __atomic_compare_exchange_n(&marks[mark], &expected, now_us ? now_us : 1, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+}
+
+int64_t boot_mark_us(boot_mark_t mark) {
+  int64_t t = __atomic_load_n(&marks[mark], __ATOMIC_RELAXED);
+  return t ? t : -1;
+}
+
+__attribute__((format(printf, 4, 5)))
+static void append(char *out, size_t len, size_t *pos, const char *fmt, ...) {
+  if (*pos >= len) {
+    return;
+  }
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(out + *pos, len - *pos, fmt, args);
+  va_end(args);
+  if (n > 0) {
+    *pos += (size_t)n < len - *pos ? (size_t)n : len - *pos - 1;
+  }
+}
+
+size_t boot_render_json(char *out, size_t len) {
+  size_t pos = 0;
+  if (!len) {
+    return 0;
+  }
+  out[0] = 0;
+  append(out, len, &pos, "{\"stages\":[");
+  int n = __atomic_load_n(&stage_count, __ATOMIC_ACQUIRE);
+  for (int i = 0; i < n; i++) {
+    int64_t end = __atomic_load_n(&stages[i].end_us, __ATOMIC_ACQUIRE);
+    append(out, len, &pos, "%s{\"name\":\"%s\",\"start_ms\":%.1f,\"ms\":", i ? "," : "", stages[i].name, stages[i].start_us / 1000.0);
+    if (end) {
+      append(out, len, &pos, "%.1f}", (end - stages[i].start_us) / 1000.0);
+    } else {
+      append(out, len, &pos, "null}");
+    }
+  }
+  append(out, len, &pos, "]");
+  for (int m = 0; m < BOOT_MARK_COUNT; m++) {
+    int64_t t = boot_mark_us((boot_mark_t)m);
+    if (t >= 0) {
+      append(out, len, &pos, ",\"%s_ms\":%.1f", mark_names[m], t / 1000.0);
+    } else {
+      append(out, len, &pos, ",\"%s_ms\":null", mark_names[m]);
+    }
+  }
+  append(out, len, &pos, "}");
+  return pos;
+}
@@ -0,0 +1,36 @@
+#ifndef BOOT_TIMING_H
+#define BOOT_TIMING_H
+
+// Tempo de boot etapa por etapa: as etapas do setup() (abertas em sequência
+// pela tarefa do loop) e os marcos depois dele, como o primeiro IP e o
+// primeiro quadro do /stream. Tempos em µs desde o início da aplicação
+// (esp_timer). Cada etapa também vira um span no /trace. Código portável.
+//
+// Os nomes das etapas precisam ser strings estáticas: só o ponteiro é guardado.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define BOOT_MAX_STAGES 12
+
+typedef enum {
+  BOOT_MARK_SETUP_DONE,
+  BOOT_MARK_GOT_IP,
+  BOOT_MARK_FIRST_FRAME,
+  BOOT_MARK_COUNT
+} boot_mark_t;
+
+// Fecha a etapa aberta (se houver) e abre esta
+void boot_stage(const char *name, int64_t now_us);
+// Fecha a última etapa e marca o fim do setup()
+void boot_stages_done(int64_t now_us);
+// Só o primeiro registro de cada marco conta; seguro em qualquer tarefa
+void boot_mark(boot_mark_t mark, int64_t now_us);
+// Tempo do marco, ou -1 se ainda não aconteceu
+int64_t boot_mark_us(boot_mark_t mark);
+
+// Objeto JSON com as etapas e os marcos, em ms; retorna o tamanho escrito
+// (truncado em len - 1)
+size_t boot_render_json(char *out, size_t len);
+
+#endif
@@ -0,0 +1,486 @@
+#include "camera_profile.h"
+#include <Preferences.h>
+#include <ctype.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include "esp32-hal-ledc.h"
+#include "camera_window.h"
+#include "sensor_regs.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "esp32-hal-log.h"
+
+#define CAMERA_PROFILE_NAMESPACE "camera"
+#define CAMERA_PROFILE_VERSION 2
+#define CAMERA_PROFILE_CURRENT_KEY "current"
+
+// Um perfil por chave ("p0".."p3"), gravado inteiro de uma vez
+typedef struct {
+  uint8_t version;
+  uint8_t reserved[3];
+  uint32_t writes;  // gravações deste perfil desde que foi criado
+  char name[CAMERA_PROFILE_NAME_LEN];
+  camera_profile_t settings;
+} profile_record_t;
+
+// Versão 1: sem a ROI no fim do camera_profile_t
+#define RECORD_V1_SIZE ((offsetof(profile_record_t, settings) + offsetof(camera_profile_t, roi_zoom_pct) + 3) & ~(size_t)3)
+
+// Protege a NVS e o perfil atual entre o httpd (/profile) e o loop()
+static SemaphoreHandle_t lock = NULL;
+static profile_record_t current;
+static int current_slot = -1;  // -1: "default" ainda não gravado
+// false enquanto o perfil atual só tem XCLK, resolução e qualidade (padrão
+// ou chaves da versão anterior): o resto vem do driver no apply
+static bool current_complete = false;
+static camera_profile_stats_t stats;
+// Maior resolução que cabe nos buffers, dada no apply do boot
+static framesize_t max_framesize = FRAMESIZE_VGA;
+
+// Prazo da gravação adiada (µs); 0 = nada pendente
+static int64_t first_change_us = 0;
+static int64_t last_change_us = 0;
+
+static void slot_key(int slot, char *key) {
+  sprintf(key, "p%d", slot);
+}
+
+static bool read_slot(Preferences &prefs, int slot, profile_record_t *record) {
+  char key[4];
+  slot_key(slot, key);
+  size_t len = prefs.getBytesLength(key);
+  if (len != sizeof(*record) && len != RECORD_V1_SIZE) {
+    return false;
+  }
+  memset(record, 0, sizeof(*record));
+  prefs.getBytes(key, record, len);
+  record->name[CAMERA_PROFILE_NAME_LEN - 1] = 0;
+  if (record->version == 1 && len == RECORD_V1_SIZE) {
+    // Sem ROI: campo inteiro; a próxima gravação já sai na versão atual
+    record->settings.roi_zoom_pct = 100;
+    record->settings.roi_cx_permille = 500;
+    record->settings.roi_cy_permille = 500;
+    record->version = CAMERA_PROFILE_VERSION;
+  }
+  return record->version == CAMERA_PROFILE_VERSION && record->name[0];
+}
+
+static int find_slot(Preferences &prefs, const char *name, profile_record_t *record) {
+  for (int i = 0; i < CAMERA_PROFILE_MAX; i++) {
+    if (read_slot(prefs, i, record) && !strcmp(record->name, name)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+static int free_slot(Preferences &prefs) {
+  profile_record_t record;
+  for (int i = 0; i < CAMERA_PROFILE_MAX; i++) {
+    if (!read_slot(prefs, i, &record)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+static bool write_slot(Preferences &prefs, int slot, profile_record_t *record) {
+  char key[4];
+  slot_key(slot, key);
+  record->version = CAMERA_PROFILE_VERSION;
+  record->writes++;
+  if (prefs.putBytes(key, record, sizeof(*record)) != sizeof(*record)) {
+    record->writes--;
+    log_e("Falha ao gravar o perfil '%s' da câmera", record->name);
+    return false;
+  }
+  stats.writes++;
+  stats.bytes += sizeof(*record);
+  return true;
+}
+
+static void write_current_key(Preferences &prefs, int slot) {
+  if (prefs.getUChar(CAMERA_PROFILE_CURRENT_KEY, 0xff) == slot) {
+    return;
+  }
+  if (prefs.putUChar(CAMERA_PROFILE_CURRENT_KEY, slot)) {
+    stats.writes++;
+    stats.bytes++;
+  }
+}
+
+static void clamp_settings(camera_profile_t *p) {
+  if (p->xclk_mhz < 8 || p->xclk_mhz > 40) {
+    p->xclk_mhz = 40;
+  }
+  if (p->framesize >= FRAMESIZE_INVALID) {
+    p->framesize = FRAMESIZE_VGA;
+  }
+  if (p->quality > 63) {
+    p->quality = 12;
+  }
+  if (p->roi_zoom_pct < 100 || p->roi_zoom_pct > CAMERA_WINDOW_MAX_ZOOM_PCT || p->roi_cx_permille > 1000 || p->roi_cy_permille > 1000) {
+    p->roi_zoom_pct = 100;
+    p->roi_cx_permille = 500;
+    p->roi_cy_permille = 500;
+  }
+}
+
+static bool valid_name(const char *name) {
+  size_t len = strlen(name);
+  if (!len || len >= CAMERA_PROFILE_NAME_LEN) {
+    return false;
+  }
+  for (size_t i = 0; i < len; i++) {
+    if (!isalnum((unsigned char)name[i]) && name[i] != '_' && name[i] != '-') {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void cancel_pending() {
+  __atomic_store_n(&first_change_us, 0, __ATOMIC_RELAXED);
+}
+
+void camera_profile_begin(bool psram) {
+  if (!lock) {
+    lock = xSemaphoreCreateMutex();
+  }
+  memset(&current, 0, sizeof(current));
+  strcpy(current.name, "default");
+  current.settings.xclk_mhz = 40;
+  current.settings.framesize = FRAMESIZE_VGA;
+  current.settings.quality = psram ? 10 : 12;
+  current.settings.roi_zoom_pct = 100;
+  current.settings.roi_cx_permille = 500;
+  current.settings.roi_cy_permille = 500;
+  current_slot = -1;
+  current_complete = false;
+
+  Preferences prefs;
+  if (!prefs.begin(CAMERA_PROFILE_NAMESPACE, true)) {
+    return;
+  }
+  uint8_t slot = prefs.getUChar(CAMERA_PROFILE_CURRENT_KEY, 0xff);
+  profile_record_t record;
+  if (slot < CAMERA_PROFILE_MAX && read_slot(prefs, slot, &record)) {
+    current = record;
+    current_slot = slot;
+    current_complete = true;
+  } else if (prefs.isKey("framesize")) {
+    // Perfil da versão anterior (só três chaves): vira o "default" na
+    // primeira gravação
+    current.settings.xclk_mhz = prefs.getUChar("xclk", current.settings.xclk_mhz);
+    current.settings.framesize = prefs.getUChar("framesize", current.settings.framesize);
+    current.settings.quality = prefs.getUChar("quality", current.settings.quality);
+  }
+  prefs.end();
+  clamp_settings(&current.settings);
+  stats.lifetime_writes = current.writes;
+}
+
+const camera_profile_t *camera_profile_current() {
+  return &current.settings;
+}
+
+const char *camera_profile_current_name() {
+  return current.name;
+}
+
+#define APPLY(field, setter)                   \
+  if (s->status.field != p->field) {           \
+    s->setter(s, p->field);                    \
+  }
+
+void camera_profile_apply(sensor_t *s, const camera_profile_t *profile, framesize_t buffer_framesize) {
+  max_framesize = buffer_framesize;
+  camera_profile_t clamped = *profile;
+  camera_profile_t *p = &clamped;
+  if (p->framesize > max_framesize) {
+    p->framesize = max_framesize;
+  }
+  if (s->xclk_freq_hz != p->xclk_mhz * 1000000) {
+    s->set_xclk(s, LEDC_TIMER_0, p->xclk_mhz);
+  }
+  if (s->pixformat == PIXFORMAT_JPEG && s->status.framesize != p->framesize) {
+    s->set_framesize(s, (framesize_t)p->framesize);
+    camera_window_reset();
+  }
+  APPLY(quality, set_quality)
+  if (profile != &current.settings || current_complete) {
+    APPLY(brightness, set_brightness)
+    APPLY(contrast, set_contrast)
+    APPLY(saturation, set_saturation)
+    APPLY(ae_level, set_ae_level)
+    APPLY(special_effect, set_special_effect)
+    APPLY(wb_mode, set_wb_mode)
+    APPLY(awb, set_whitebal)
+    APPLY(awb_gain, set_awb_gain)
+    APPLY(aec, set_exposure_ctrl)
+    APPLY(aec2, set_aec2)
+    APPLY(aec_value, set_aec_value)
+    APPLY(agc, set_gain_ctrl)
+    APPLY(agc_gain, set_agc_gain)
+    if (s->status.gainceiling != p->gainceiling) {
+      s->set_gainceiling(s, (gainceiling_t)p->gainceiling);
+    }
+    APPLY(bpc, set_bpc)
+    APPLY(wpc, set_wpc)
+    APPLY(raw_gma, set_raw_gma)
+    APPLY(lenc, set_lenc)
+    APPLY(hmirror, set_hmirror)
+    APPLY(vflip, set_vflip)
+    APPLY(dcw, set_dcw)
+    APPLY(colorbar, set_colorbar)
+  }
+  // Depois da resolução: o set_framesize volta a janela para o campo inteiro
+  camera_roi_t roi = {p->roi_zoom_pct, p->roi_cx_permille, p->roi_cy_permille};
+  const char *err = camera_window_apply(s, &roi);
+  if (err && p->roi_zoom_pct > 100) {
+    log_w("ROI do perfil não aplicada: %s", err);
+  }
+  sensor_regs_invalidate();
+  if (profile == &current.settings && !current_complete) {
+    // Padrão do driver para o resto, que passa a fazer parte do perfil
+    camera_profile_from_sensor(&current.settings, s);
+    current_complete = true;
+  }
+}
+
+void camera_profile_from_sensor(camera_profile_t *profile, const sensor_t *s) {
+  memset(profile, 0, sizeof(*profile));
+  profile->xclk_mhz = s->xclk_freq_hz / 1000000;
+  profile->framesize = s->status.framesize;
+  profile->quality = s->status.quality;
+  profile->brightness = s->status.brightness;
+  profile->contrast = s->status.contrast;
+  profile->saturation = s->status.saturation;
+  profile->ae_level = s->status.ae_level;
+  profile->special_effect = s->status.special_effect;
+  profile->wb_mode = s->status.wb_mode;
+  profile->awb = s->status.awb;
+  profile->awb_gain = s->status.awb_gain;
+  profile->aec = s->status.aec;
+  profile->aec2 = s->status.aec2;
+  profile->aec_value = s->status.aec_value;
+  profile->agc = s->status.agc;
+  profile->agc_gain = s->status.agc_gain;
+  profile->gainceiling = s->status.gainceiling;
+  profile->bpc = s->status.bpc;
+  profile->wpc = s->status.wpc;
+  profile->raw_gma = s->status.raw_gma;
+  profile->lenc = s->status.lenc;
+  profile->hmirror = s->status.hmirror;
+  profile->vflip = s->status.vflip;
+  profile->dcw = s->status.dcw;
+  profile->colorbar = s->status.colorbar;
+  camera_roi_t roi;
+  camera_window_current(s, &roi);
+  profile->roi_zoom_pct = roi.zoom_pct;
+  profile->roi_cx_permille = roi.cx_permille;
+  profile->roi_cy_permille = roi.cy_permille;
+}
+
+void camera_profile_touch(int64_t now_us) {
+  __atomic_add_fetch(&stats.changes, 1, __ATOMIC_RELAXED);
+  __atomic_store_n(&last_change_us, now_us, __ATOMIC_RELAXED);
+  int64_t expected = 0;
+  __atomic_compare_exchange_n(&first_change_us, &expected, now_us ? now_us : 1, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+}
+
+// Grava o sensor no perfil atual se algo mudou; com o lock
+static void flush_current(Preferences &prefs, const sensor_t *s) {
+  camera_profile_t now;
+  camera_profile_from_sensor(&now, s);
+  if (current_slot >= 0 && !memcmp(&now, &current.settings, sizeof(now))) {
+    stats.skipped++;
+    return;
+  }
+  if (current_slot < 0) {
+    current_slot = free_slot(prefs);
+    if (current_slot < 0) {
+      log_w("Sem espaço para o perfil '%s' da câmera", current.name);
+      return;
+    }
+  }
+  current.settings = now;
+  if (write_slot(prefs, current_slot, &current)) {
+    write_current_key(prefs, current_slot);
+    // Chaves da versão anterior, já migradas
+    if (prefs.isKey("framesize")) {
+      prefs.remove("xclk");
+      prefs.remove("framesize");
+      prefs.remove("quality");
+    }
+    stats.lifetime_writes = current.writes;
+    log_i("Perfil '%s' da câmera gravado (%u gravações)", current.name, (unsigned)current.writes);
+  }
+}
+
+void camera_profile_service(int64_t now_us) {
+  int64_t first = __atomic_load_n(&first_change_us, __ATOMIC_RELAXED);
+  if (!first || !lock) {
+    return;
+  }
+  int64_t last = __atomic_load_n(&last_change_us, __ATOMIC_RELAXED);
+  if (now_us - last < CAMERA_PROFILE_DEBOUNCE_MS * 1000LL && now_us - first < CAMERA_PROFILE_MAX_DELAY_MS * 1000LL) {
+    return;
+  }
+  // Libera antes de ler o sensor: uma mudança que chegue agora reabre o prazo
+  if (!__atomic_compare_exchange_n(&first_change_us, &first, 0, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    return;
+  }
+  sensor_t *s = esp_camera_sensor_get();
+  if (!s) {
+    return;
+  }
+  xSemaphoreTake(lock, portMAX_DELAY);
+  Preferences prefs;
+  if (prefs.begin(CAMERA_PROFILE_NAMESPACE, false)) {
+    flush_current(prefs, s);
+    prefs.end();
+  }
+  xSemaphoreGive(lock);
+}
+
+const char *camera_profile_save(const char *name, const sensor_t *s) {
+  if (!valid_name(name)) {
+    return "invalid name";
+  }
+  if (!lock) {
+    return "not initialized";
+  }
+  const char *err = NULL;
+  xSemaphoreTake(lock, portMAX_DELAY);
+  Preferences prefs;
+  if (!prefs.begin(CAMERA_PROFILE_NAMESPACE, false)) {
+    xSemaphoreGive(lock);
+    return "nvs unavailable";
+  }
+  if (!strcmp(name, current.name)) {
+    cancel_pending();
+    flush_current(prefs, s);
+  } else {
+    profile_record_t record;
+    int slot = find_slot(prefs, name, &record);
+    if (slot < 0) {
+      slot = free_slot(prefs);
+      memset(&record, 0, sizeof(record));
+      strcpy(record.name, name);
+    }
+    if (slot < 0) {
+      err = "no free slot";
+    } else {
+      camera_profile_from_sensor(&record.settings, s);
+      if (write_slot(prefs, slot, &record)) {
+        // Mudanças pendentes já estão no sensor, agora salvas neste perfil
+        cancel_pending();
+        current = record;
+        current_slot = slot;
+        current_complete = true;
+        write_current_key(prefs, slot);
+        stats.lifetime_writes = current.writes;
+      } else {
+        err = "write failed";
+      }
+    }
+  }
+  prefs.end();
+  xSemaphoreGive(lock);
+  return err;
+}
+
+const char *camera_profile_select(const char *name, sensor_t *s) {
+  if (!lock) {
+    return "not initialized";
+  }
+  const char *err = NULL;
+  xSemaphoreTake(lock, portMAX_DELAY);
+  Preferences prefs;
+  if (!prefs.begin(CAMERA_PROFILE_NAMESPACE, false)) {
+    xSemaphoreGive(lock);
+    return "nvs unavailable";
+  }
+  profile_record_t record;
+  int slot = find_slot(prefs, name, &record);
+  if (slot < 0) {
+    err = "not found";
+  } else if (slot != current_slot) {
+    // O que estava pendente fica no perfil de antes
+    if (__atomic_exchange_n(&first_change_us, 0, __ATOMIC_RELAXED)) {
+      flush_current(prefs, s);
+    }
+    clamp_settings(&record.settings);
+    current = record;
+    current_slot = slot;
+    current_complete = true;
+    camera_profile_apply(s, &current.settings, max_framesize);
+    write_current_key(prefs, slot);
+    stats.lifetime_writes = current.writes;
+  }
+  prefs.end();
+  xSemaphoreGive(lock);
+  return err;
+}
+
+const char *camera_profile_delete(const char *name) {
+  if (!lock) {
+    return "not initialized";
+  }
+  const char *err = NULL;
+  xSemaphoreTake(lock, portMAX_DELAY);
+  Preferences prefs;
+  if (!prefs.begin(CAMERA_PROFILE_NAMESPACE, false)) {
+    xSemaphoreGive(lock);
+    return "nvs unavailable";
+  }
+  profile_record_t record;
+  int slot = find_slot(prefs, name, &record);
+  if (slot < 0) {
+    err = "not found";
+  } else if (slot == current_slot) {
+    err = "profile in use";
+  } else {
+    char key[4];
+    slot_key(slot, key);
+    prefs.remove(key);
+  }
+  prefs.end();
+  xSemaphoreGive(lock);
+  return err;
+}
+
+int camera_profile_list(char names[][CAMERA_PROFILE_NAME_LEN], int max) {
+  int n = 0;
+  if (!lock) {
+    return 0;
+  }
+  xSemaphoreTake(lock, portMAX_DELAY);
+  Preferences prefs;
+  if (prefs.begin(CAMERA_PROFILE_NAMESPACE, true)) {
+    profile_record_t record;
+    for (int i = 0; i < CAMERA_PROFILE_MAX && n < max; i++) {
+      if (read_slot(prefs, i, &record)) {
+        strcpy(names[n++], record.name);
+      }
+    }
+    prefs.end();
+  }
+  xSemaphoreGive(lock);
+  return n;
+}
+
+void camera_profile_get_stats(camera_profile_stats_t *out) {
+  if (!lock) {
+    memset(out, 0, sizeof(*out));
+    return;
+  }
+  xSemaphoreTake(lock, portMAX_DELAY);
+  *out = stats;
+  out->changes = __atomic_load_n(&stats.changes, __ATOMIC_RELAXED);
+  out->pending = __atomic_load_n(&first_change_us, __ATOMIC_RELAXED) != 0;
+  xSemaphoreGive(lock);
+}
@@ -0,0 +1,94 @@
+#ifndef CAMERA_PROFILE_H
+#define CAMERA_PROFILE_H
+
+// Perfis nomeados da câmera na NVS (namespace "camera"): toda a
+// configuração do sensor que o /control altera, mais o XCLK e a ROI. O perfil atual
+// é aplicado uma vez no boot: XCLK e qualidade JPEG entram na própria
+// esp_camera_init e o resto logo depois, antes do primeiro quadro.
+//
+// Mudanças pelo /control não vão direto para a flash: cada uma adia a
+// gravação do perfil atual por CAMERA_PROFILE_DEBOUNCE_MS (no máximo
+// CAMERA_PROFILE_MAX_DELAY_MS depois da primeira), e o loop() grava só se o
+// conteúdo mudou. Arrastar um slider vira uma gravação.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_camera.h"
+
+#define CAMERA_PROFILE_MAX 4
+#define CAMERA_PROFILE_NAME_LEN 16  // com o terminador
+#define CAMERA_PROFILE_DEBOUNCE_MS 2000
+#define CAMERA_PROFILE_MAX_DELAY_MS 10000
+
+typedef struct {
+  uint8_t xclk_mhz;
+  uint8_t framesize;
+  uint8_t quality;
+  int8_t brightness;
+  int8_t contrast;
+  int8_t saturation;
+  int8_t ae_level;
+  uint8_t special_effect;
+  uint8_t wb_mode;
+  uint8_t awb;
+  uint8_t awb_gain;
+  uint8_t aec;
+  uint8_t aec2;
+  uint16_t aec_value;
+  uint8_t agc;
+  uint8_t agc_gain;
+  uint8_t gainceiling;
+  uint8_t bpc;
+  uint8_t wpc;
+  uint8_t raw_gma;
+  uint8_t lenc;
+  uint8_t hmirror;
+  uint8_t vflip;
+  uint8_t dcw;
+  uint8_t colorbar;
+  // Pan/zoom no sensor (camera_window)
+  uint16_t roi_zoom_pct;
+  uint16_t roi_cx_permille;
+  uint16_t roi_cy_permille;
+} camera_profile_t;
+
+// Desgaste da flash causado pelos perfis
+typedef struct {
+  uint32_t changes;          // mudanças pelo /control desde o boot
+  uint32_t writes;           // gravações na NVS desde o boot
+  uint32_t bytes;            // bytes gravados desde o boot
+  uint32_t skipped;          // prazos vencidos sem nada diferente para gravar
+  uint32_t lifetime_writes;  // gravações do perfil atual desde que foi criado
+  bool pending;              // gravação adiada esperando o prazo
+} camera_profile_stats_t;
+
+// Lê o perfil atual; sem nenhum salvo, o padrão "default" (40 MHz, VGA,
+// qualidade 10 com PSRAM e 12 sem; o resto com os valores do driver)
+void camera_profile_begin(bool psram);
+const camera_profile_t *camera_profile_current();
+const char *camera_profile_current_name();
+
+// Aplica no sensor só os campos diferentes do estado atual, numa passada;
+// a resolução fica limitada a buffer_framesize (tamanho dos buffers), que
+// também vale para os select seguintes
+void camera_profile_apply(sensor_t *s, const camera_profile_t *profile, framesize_t buffer_framesize);
+void camera_profile_from_sensor(camera_profile_t *profile, const sensor_t *s);
+
+// Chamado a cada mudança pelo /control ou /xclk (qualquer tarefa)
+void camera_profile_touch(int64_t now_us);
+// Chamado pelo loop(): grava o perfil atual se o prazo venceu
+void camera_profile_service(int64_t now_us);
+
+// Operações imediatas. Retornam NULL em caso de sucesso ou o erro.
+// save: configuração atual do sensor no perfil dado, que passa a ser o atual
+const char *camera_profile_save(const char *name, const sensor_t *s);
+// select: aplica o perfil dado e o torna atual
+const char *camera_profile_select(const char *name, sensor_t *s);
+// delete: o perfil atual não pode ser apagado
+const char *camera_profile_delete(const char *name);
+
+// Nomes dos perfis salvos; retorna quantos
+int camera_profile_list(char names[][CAMERA_PROFILE_NAME_LEN], int max);
+void camera_profile_get_stats(camera_profile_stats_t *stats);
+
+#endif
@@ -0,0 +1,314 @@
+#include "camera_window.h"
+#include "sensor_regs.h"
+#include <Preferences.h>
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "esp32-hal-log.h"
+
+#define ROI_NAMESPACE "roi"
+#define ROI_ALIGN 16  // múltiplo de 4 pixels também no modo CIF (1/4)
+
+typedef struct {
+  const char *name;
+  uint16_t mode_w, mode_h;  // área do modo, em pixels do modo
+  uint8_t scale;            // pixels do sensor por pixel do modo
+} sensor_mode_t;
+
+// O CIF do OV2640 só cobre 1184 linhas do sensor
+static const sensor_mode_t modes[] = {
+  {"UXGA", 1600, 1200, 1},
+  {"SVGA", 800, 600, 2},
+  {"CIF", 400, 296, 4},
+};
+
+typedef struct {
+  char name[CAMERA_WINDOW_NAME_LEN];
+  camera_roi_t roi;
+} preset_record_t;
+
+static const preset_record_t builtin_presets[] = {
+  {"full", {100, 500, 500}},
+  {"center2x", {200, 500, 500}},
+  {"center4x", {400, 500, 500}},
+};
+
+// Última janela aplicada e a resolução em que valia
+static camera_window_t applied;
+static framesize_t applied_framesize = FRAMESIZE_INVALID;
+
+static uint16_t align_up(uint32_t v) {
+  return (v + ROI_ALIGN - 1) / ROI_ALIGN * ROI_ALIGN;
+}
+
+static uint16_t align_down(uint32_t v) {
+  return v / ROI_ALIGN * ROI_ALIGN;
+}
+
+const char *camera_window_plan(const camera_roi_t *roi, uint16_t out_w, uint16_t out_h, camera_window_t *win) {
+  if (!out_w || !out_h || out_w > CAMERA_WINDOW_SENSOR_W || out_h > CAMERA_WINDOW_SENSOR_H || out_w % 4 || out_h % 4) {
+    return "invalid output size";
+  }
+  memset(win, 0, sizeof(*win));
+
+  // Campo inteiro na proporção da saída
+  uint32_t full_w = CAMERA_WINDOW_SENSOR_W, full_h = CAMERA_WINDOW_SENSOR_H;
+  if ((uint32_t)out_w * CAMERA_WINDOW_SENSOR_H >= (uint32_t)out_h * CAMERA_WINDOW_SENSOR_W) {
+    full_h = CAMERA_WINDOW_SENSOR_W * out_h / out_w;
+  } else {
+    full_w = CAMERA_WINDOW_SENSOR_H * out_w / out_h;
+  }
+
+  // Zoom até a janela ficar do tamanho da saída
+  uint32_t max_zoom = full_w * 100 / out_w;
+  if (full_h * 100 / out_h < max_zoom) {
+    max_zoom = full_h * 100 / out_h;
+  }
+  if (max_zoom > CAMERA_WINDOW_MAX_ZOOM_PCT) {
+    max_zoom = CAMERA_WINDOW_MAX_ZOOM_PCT;
+  }
+  uint32_t zoom = roi->zoom_pct < 100 ? 100 : roi->zoom_pct;
+  if (zoom > max_zoom) {
+    zoom = max_zoom;
+  }
+  uint32_t w = align_up(full_w * 100 / zoom);
+  uint32_t h = align_up(full_h * 100 / zoom);
+  if (w > CAMERA_WINDOW_SENSOR_W) {
+    w = CAMERA_WINDOW_SENSOR_W;
+  }
+  if (h > CAMERA_WINDOW_SENSOR_H) {
+    h = CAMERA_WINDOW_SENSOR_H;
+  }
+
+  // Centro dentro do sensor
+  uint32_t cx = roi->cx_permille > 1000 ? 1000 : roi->cx_permille;
+  uint32_t cy = roi->cy_permille > 1000 ? 1000 : roi->cy_permille;
+  int32_t x = (int32_t)(cx * CAMERA_WINDOW_SENSOR_W / 1000) - (int32_t)w / 2;
+  int32_t y = (int32_t)(cy * CAMERA_WINDOW_SENSOR_H / 1000) - (int32_t)h / 2;
+  x = x < 0 ? 0 : (x > (int32_t)(CAMERA_WINDOW_SENSOR_W - w) ? CAMERA_WINDOW_SENSOR_W - w : x);
+  y = y < 0 ? 0 : (y > (int32_t)(CAMERA_WINDOW_SENSOR_H - h) ? CAMERA_WINDOW_SENSOR_H - h : y);
+  x = align_down(x);
+  y = align_down(y);
+
+  // Modo mais rápido que ainda tem um pixel por pixel de saída
+  int m = 0;
+  for (int i = sizeof(modes) / sizeof(modes[0]) - 1; i > 0; i--) {
+    const sensor_mode_t *mode = &modes[i];
+    if (w / mode->scale >= out_w && h / mode->scale >= out_h && (y + h) / mode->scale <= mode->mode_h) {
+      m = i;
+      break;
+    }
+  }
+
+  win->mode = m;
+  win->offset_x = x / modes[m].scale;
+  win->offset_y = y / modes[m].scale;
+  win->total_x = w / modes[m].scale;
+  win->total_y = h / modes[m].scale;
+  win->output_x = out_w;
+  win->output_y = out_h;
+  win->sensor_x = x;
+  win->sensor_y = y;
+  win->sensor_w = w;
+  win->sensor_h = h;
+  win->roi.zoom_pct = zoom;
+  win->roi.cx_permille = (x + w / 2) * 1000 / CAMERA_WINDOW_SENSOR_W;
+  win->roi.cy_permille = (y + h / 2) * 1000 / CAMERA_WINDOW_SENSOR_H;
+  return NULL;
+}
+
+const char *camera_window_mode_name(uint8_t mode) {
+  return mode < sizeof(modes) / sizeof(modes[0]) ? modes[mode].name : "?";
+}
+
+static bool is_full(const camera_roi_t *roi) {
+  return roi->zoom_pct <= 100;
+}
+
+const char *camera_window_apply(sensor_t *s, const camera_roi_t *roi) {
+  if (s->id.PID != OV2640_PID) {
+    return "unsupported sensor";
+  }
+  framesize_t framesize = s->status.framesize;
+  camera_window_t win;
+  const char *err = camera_window_plan(roi, resolution[framesize].width, resolution[framesize].height, &win);
+  if (err) {
+    return err;
+  }
+  bool active = applied_framesize == framesize;
+  if (active && !memcmp(&win, &applied, sizeof(win))) {
+    return NULL;
+  }
+  // Campo inteiro sem janela aplicada: é o que o driver já entrega
+  if (!active && is_full(&win.roi) && win.roi.cx_permille == 500 && win.roi.cy_permille == 500) {
+    return NULL;
+  }
+  int res = s->set_res_raw(s, win.mode, 0, 0, 0, win.offset_x, win.offset_y, win.total_x, win.total_y, win.output_x, win.output_y, false, false);
+  sensor_regs_invalidate();
+  if (res) {
+    return "sensor error";
+  }
+  applied = win;
+  applied_framesize = framesize;
+  return NULL;
+}
+
+void camera_window_reset() {
+  applied_framesize = FRAMESIZE_INVALID;
+}
+
+void camera_window_current(const sensor_t *s, camera_roi_t *roi) {
+  if (applied_framesize == s->status.framesize) {
+    *roi = applied.roi;
+  } else {
+    roi->zoom_pct = 100;
+    roi->cx_permille = 500;
+    roi->cy_permille = 500;
+  }
+}
+
+bool camera_window_get(const sensor_t *s, camera_window_t *win) {
+  if (applied_framesize != s->status.framesize) {
+    return false;
+  }
+  *win = applied;
+  return true;
+}
+
+// ---- Presets ----
+
+static bool valid_name(const char *name) {
+  size_t len = strlen(name);
+  if (!len || len >= CAMERA_WINDOW_NAME_LEN) {
+    return false;
+  }
+  for (size_t i = 0; i < len; i++) {
+    if (!isalnum((unsigned char)name[i]) && name[i] != '_' && name[i] != '-') {
+      return false;
+    }
+  }
+  return true;
+}
+
+static const preset_record_t *find_builtin(const char *name) {
+  for (size_t i = 0; i < sizeof(builtin_presets) / sizeof(builtin_presets[0]); i++) {
+    if (!strcmp(builtin_presets[i].name, name)) {
+      return &builtin_presets[i];
+    }
+  }
+  return NULL;
+}
+
+static bool read_slot(Preferences &prefs, int slot, preset_record_t *record) {
+  char key[4];
+  sprintf(key, "r%d", slot);
+  if (prefs.getBytesLength(key) != sizeof(*record)) {
+    return false;
+  }
+  prefs.getBytes(key, record, sizeof(*record));
+  record->name[CAMERA_WINDOW_NAME_LEN - 1] = 0;
+  return record->name[0];
+}
+
+static int find_slot(Preferences &prefs, const char *name, preset_record_t *record) {
+  for (int i = 0; i < CAMERA_WINDOW_PRESET_MAX; i++) {
+    if (read_slot(prefs, i, record) && !strcmp(record->name, name)) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+const char *camera_window_preset_get(const char *name, camera_roi_t *roi) {
+  const preset_record_t *builtin = find_builtin(name);
+  if (builtin) {
+    *roi = builtin->roi;
+    return NULL;
+  }
+  Preferences prefs;
+  if (!prefs.begin(ROI_NAMESPACE, true)) {
+    return "not found";
+  }
+  preset_record_t record;
+  int slot = find_slot(prefs, name, &record);
+  prefs.end();
+  if (slot < 0) {
+    return "not found";
+  }
+  *roi = record.roi;
+  return NULL;
+}
+
+const char *camera_window_preset_save(const char *name, const camera_roi_t *roi) {
+  if (!valid_name(name)) {
+    return "invalid name";
+  }
+  if (find_builtin(name)) {
+    return "built-in preset";
+  }
+  Preferences prefs;
+  if (!prefs.begin(ROI_NAMESPACE, false)) {
+    return "nvs unavailable";
+  }
+  preset_record_t record;
+  int slot = find_slot(prefs, name, &record);
+  for (int i = 0; slot < 0 && i < CAMERA_WINDOW_PRESET_MAX; i++) {
+    if (!read_slot(prefs, i, &record)) {
+      slot = i;
+    }
+  }
+  const char *err = NULL;
+  if (slot < 0) {
+    err = "no free slot";
+  } else {
+    memset(&record, 0, sizeof(record));
+    strcpy(record.name, name);
+    record.roi = *roi;
+    char key[4];
+    sprintf(key, "r%d", slot);
+    if (prefs.putBytes(key, &record, sizeof(record)) != sizeof(record)) {
+      err = "write failed";
+    }
+  }
+  prefs.end();
+  return err;
+}
+
+const char *camera_window_preset_delete(const char *name) {
+  if (find_builtin(name)) {
+    return "built-in preset";
+  }
+  Preferences prefs;
+  if (!prefs.begin(ROI_NAMESPACE, false)) {
+    return "nvs unavailable";
+  }
+  preset_record_t record;
+  int slot = find_slot(prefs, name, &record);
+  if (slot >= 0) {
+    char key[4];
+    sprintf(key, "r%d", slot);
+    prefs.remove(key);
+  }
+  prefs.end();
+  return slot < 0 ? "not found" : NULL;
+}
+
+int camera_window_preset_list(char names[][CAMERA_WINDOW_NAME_LEN], int max) {
+  int n = 0;
+  for (size_t i = 0; i < sizeof(builtin_presets) / sizeof(builtin_presets[0]) && n < max; i++) {
+    strcpy(names[n++], builtin_presets[i].name);
+  }
+  Preferences prefs;
+  if (!prefs.begin(ROI_NAMESPACE, true)) {
+    return n;
+  }
+  preset_record_t record;
+  for (int i = 0; i < CAMERA_WINDOW_PRESET_MAX && n < max; i++) {
+    if (read_slot(prefs, i, &record)) {
+      strcpy(names[n++], record.name);
+    }
+  }
+  prefs.end();
+  return n;
+}
@@ -0,0 +1,63 @@
+#ifndef CAMERA_WINDOW_H
+#define CAMERA_WINDOW_H
+
+// Região de interesse (pan/zoom) recortada no próprio sensor OV2640 com o
+// set_res_raw: a saída continua na resolução escolhida (framesize) e a
+// janela no sensor encolhe com o zoom, então um recorte pequeno sai com o
+// detalhe do sensor inteiro e um JPEG do tamanho da saída. O modo do sensor
+// (UXGA, SVGA ou CIF, cada um lendo o sensor mais rápido que o anterior) é o
+// mais baixo que ainda cobre a janela com pelo menos um pixel por pixel de
+// saída. Nada é reinicializado: os buffers são os do esp_camera_init.
+//
+// Um set_framesize no driver volta a janela para o campo inteiro: quem
+// muda a resolução avisa com camera_window_reset e reaplica a ROI se
+// quiser mantê-la.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_camera.h"
+
+#define CAMERA_WINDOW_SENSOR_W 1600
+#define CAMERA_WINDOW_SENSOR_H 1200
+#define CAMERA_WINDOW_MAX_ZOOM_PCT 800
+#define CAMERA_WINDOW_PRESET_MAX 8
+#define CAMERA_WINDOW_NAME_LEN 16  // com o terminador
+
+typedef struct {
+  uint16_t zoom_pct;     // 100 = campo inteiro
+  uint16_t cx_permille;  // centro da janela no campo inteiro (0-1000)
+  uint16_t cy_permille;
+} camera_roi_t;
+
+typedef struct {
+  camera_roi_t roi;  // ajustada aos limites
+  uint8_t mode;      // 0 UXGA, 1 SVGA, 2 CIF (startX do set_res_raw)
+  uint16_t offset_x, offset_y, total_x, total_y;  // em pixels do modo
+  uint16_t output_x, output_y;
+  uint16_t sensor_x, sensor_y, sensor_w, sensor_h;  // janela no sensor inteiro
+} camera_window_t;
+
+// Calcula a janela para a ROI e a saída dadas; o zoom fica limitado para a
+// janela não ser menor que a saída (o DSP só reduz) e o centro para a
+// janela caber no sensor. Retorna NULL ou o erro. Código portável.
+const char *camera_window_plan(const camera_roi_t *roi, uint16_t out_w, uint16_t out_h, camera_window_t *win);
+const char *camera_window_mode_name(uint8_t mode);
+
+// Aplica a ROI na resolução atual do sensor; NULL ou o erro
+const char *camera_window_apply(sensor_t *s, const camera_roi_t *roi);
+// Chamado depois de todo set_framesize, que volta a janela do driver para o
+// campo inteiro
+void camera_window_reset();
+// ROI em uso
+void camera_window_current(const sensor_t *s, camera_roi_t *roi);
+// Janela aplicada por último; false se é o campo inteiro do driver
+bool camera_window_get(const sensor_t *s, camera_window_t *win);
+
+// Presets: os embutidos ("full", "center2x", "center4x") e os salvos na NVS
+// (namespace "roi"). Retornam NULL ou o erro.
+const char *camera_window_preset_get(const char *name, camera_roi_t *roi);
+const char *camera_window_preset_save(const char *name, const camera_roi_t *roi);
+const char *camera_window_preset_delete(const char *name);
+int camera_window_preset_list(char names[][CAMERA_WINDOW_NAME_LEN], int max);
+
+#endif
@@ -0,0 +1,100 @@
+#include "day_night.h"
+#include <stdlib.h>
+#include <string.h>
+
+// Médias móveis exponenciais em ponto fixo (x16), peso 1/4 por amostra
+#define AVG_SHIFT 2
+
+struct day_night {
+  day_night_params_t params;
+  day_night_mode_t mode;
+  bool has_sample;
+  int32_t luma_x16;
+  int32_t gain_x16;
+  int32_t bpkp_x16;
+  int64_t pending_since;  // 0 enquanto a condição de troca não vale
+  uint32_t switches;
+};
+
+static const char *mode_names[] = {"day", "night"};
+
+day_night_t *day_night_new(const day_night_params_t *params, day_night_mode_t mode) {
+  day_night_t *d = (day_night_t *)malloc(sizeof(day_night_t));
+  if (!d) {
+    return NULL;
+  }
+  memset(d, 0, sizeof(day_night_t));
+  d->params = *params;
+  d->mode = mode;
+  return d;
+}
+
+void day_night_free(day_night_t *d) {
+  free(d);
+}
+
+static void average(int32_t *avg, int32_t sample, bool first) {
+  int32_t v = sample * 16;
+  *avg = first ? v : *avg + ((v - *avg) >> AVG_SHIFT);
+}
+
+static bool wants_switch(const day_night_t *d) {
+  const day_night_params_t *p = &d->params;
+  int32_t luma = d->luma_x16 / 16;
+  int32_t gain = d->gain_x16 / 16;
+  if (d->mode == DAY_NIGHT_DAY) {
+    return luma < p->enter_luma || (gain && gain >= p->enter_gain_x16);
+  }
+  // Sem o ganho, só a luminância decide (a faixa entre as duas é a histerese)
+  return luma >= p->exit_luma && (!gain || gain <= p->exit_gain_x16);
+}
+
+bool day_night_update(day_night_t *d, uint8_t luma, uint16_t gain_x16, size_t jpeg_len, uint32_t pixels, int64_t now_us) {
+  bool first = !d->has_sample;
+  average(&d->luma_x16, luma, first);
+  average(&d->gain_x16, gain_x16, first);
+  average(&d->bpkp_x16, pixels ? (int32_t)(jpeg_len * 1000 / pixels) : 0, first);
+  d->has_sample = true;
+
+  if (!wants_switch(d)) {
+    d->pending_since = 0;
+    return false;
+  }
+  if (!d->pending_since) {
+    d->pending_since = now_us ? now_us : 1;
+  }
+  return now_us - d->pending_since >= (int64_t)d->params.hold_ms * 1000;
+}
+
+void day_night_set_mode(day_night_t *d, day_night_mode_t mode) {
+  if (mode != d->mode) {
+    d->mode = mode;
+    d->switches++;
+    // O AGC leva alguns quadros para assentar no perfil novo
+    d->has_sample = false;
+  }
+  d->pending_since = 0;
+}
+
+void day_night_get_state(const day_night_t *d, day_night_state_t *state) {
+  state->mode = d->mode;
+  state->luma = d->luma_x16 / 16;
+  state->gain_x16 = d->gain_x16 / 16;
+  state->bytes_per_kpixel = d->bpkp_x16 / 16;
+  state->switches = d->switches;
+}
+
+const char *day_night_mode_name(day_night_mode_t mode) {
+  return mode_names[mode];
+}
+
+uint16_t day_night_ov2640_gain_x16(uint8_t reg) {
+  // Ganho = (b7+1)(b6+1)(b5+1)(b4+1)(1 + b3..0/16)
+  uint16_t gain = 16 + (reg & 0x0f);
+  for (int bit = 4; bit < 8; bit++) {
+    if (reg & (1 << bit)) {
+      gain *= 2;
+    }
+  }
+  return gain;
+}
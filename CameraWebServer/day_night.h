@@ -0,0 +1,53 @@
+#ifndef DAY_NIGHT_H
+#define DAY_NIGHT_H
+
+// Decide entre os modos dia e noite pela luminância da cena (DC médio de Y
+// dos quadros, do scene_detect) e pelo ganho do AGC do sensor, com
+// histerese: a noite entra quando o perfil de dia não dá conta (imagem
+// escura mesmo com o ganho no teto, ou ganho tão alto que é só ruído) e só
+// sai quando o ganho volta a ser baixo com a cena clara. Cada condição
+// precisa se manter por hold_ms antes da troca. Código portável.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef enum {
+  DAY_NIGHT_DAY,
+  DAY_NIGHT_NIGHT
+} day_night_mode_t;
+
+typedef struct {
+  uint8_t enter_luma;       // luminância média abaixo da qual é noite
+  uint8_t exit_luma;        // luminância mínima para voltar ao dia
+  uint16_t enter_gain_x16;  // ganho (x16) a partir do qual é noite
+  uint16_t exit_gain_x16;   // ganho máximo (x16) para voltar ao dia
+  uint32_t hold_ms;         // tempo com a condição valendo antes de trocar
+} day_night_params_t;
+
+typedef struct {
+  day_night_mode_t mode;
+  uint8_t luma;              // médias móveis das amostras
+  uint16_t gain_x16;         // 0 se o sensor não informa o ganho
+  uint32_t bytes_per_kpixel; // tamanho do JPEG: sobe com o ruído
+  uint32_t switches;
+} day_night_state_t;
+
+typedef struct day_night day_night_t;
+
+day_night_t *day_night_new(const day_night_params_t *params, day_night_mode_t mode);
+void day_night_free(day_night_t *d);
+
+// Uma amostra por quadro analisado (gain_x16 0 = desconhecido). Retorna
+// true quando o modo deve trocar agora; quem chama aplica e confirma com
+// day_night_set_mode.
+bool day_night_update(day_night_t *d, uint8_t luma, uint16_t gain_x16, size_t jpeg_len, uint32_t pixels, int64_t now_us);
+// Modo efetivamente em uso (também reinicia a contagem do hold)
+void day_night_set_mode(day_night_t *d, day_night_mode_t mode);
+void day_night_get_state(const day_night_t *d, day_night_state_t *state);
+const char *day_night_mode_name(day_night_mode_t mode);
+
+// Ganho do OV2640 (registrador 0x00 do banco do sensor) em x16
+uint16_t day_night_ov2640_gain_x16(uint8_t reg);
+
+#endif
@@ -0,0 +1,422 @@
+#include "event_log.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_partition.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "webfs.h"
+#include "esp32-hal-log.h"
+
+#define SECTOR_MAGIC 0x314C5645      // "EVL1"
+#define SYNCED_MS 1577836800000LL    // 2020-01-01: antes disso o relógio não foi acertado
+#define READ_BATCH 16                // registros por leitura da flash
+
+// Na flash, little-endian como o ESP32
+typedef struct __attribute__((packed)) {
+  uint32_t magic;
+  uint32_t seq;        // cresce a cada setor aberto: ordem do anel
+  uint16_t record;     // EVENT_LOG_RECORD
+  uint16_t reserved;   // 0xFFFF
+  uint32_t crc;        // CRC-32 dos 12 bytes anteriores
+} sector_header_t;
+
+typedef struct __attribute__((packed)) {
+  uint32_t time_s;
+  uint16_t ms;
+  uint8_t type;
+  uint8_t flags;
+  uint8_t score;
+  uint8_t box[4];
+  uint8_t reserved;    // 0xFF
+  uint16_t crc;        // 16 bits baixos do CRC-32 dos 14 bytes anteriores
+} record_t;
+
+static_assert(sizeof(sector_header_t) == EVENT_LOG_RECORD, "cabeçalho ocupa um slot");
+static_assert(sizeof(record_t) == EVENT_LOG_RECORD, "registro de 16 bytes");
+
+// Entrada do índice esparso: um setor com registros, pelo primeiro instante
+typedef struct {
+  int64_t first_ms;
+  uint16_t sector;
+} index_entry_t;
+
+static const esp_partition_t *part = NULL;
+static SemaphoreHandle_t lock = NULL;    // índice, cabeça e estatísticas
+static SemaphoreHandle_t writer = NULL;  // uma gravação (ou montagem) por vez
+static QueueHandle_t inbox = NULL;
+static uint32_t sectors = 0;
+// Setores com registros, do mais velho ao mais novo (fila circular)
+static index_entry_t *ring = NULL;
+static uint32_t ring_start = 0;
+static uint32_t ring_count = 0;
+static uint32_t head = 0;       // setor aberto para gravação
+static uint32_t head_slot = 0;  // próximo slot livre nele; EVENT_LOG_PER_SECTOR = fechado
+static bool head_listed = false;
+static uint32_t next_seq = 1;
+static int64_t last_ms = 0;
+static event_log_stats_t stats;
+
+static uint32_t record_crc(const record_t *r) {
+  return webfs_crc32(0, (const uint8_t *)r, offsetof(record_t, crc)) & 0xFFFF;
+}
+
+static uint32_t header_crc(const sector_header_t *h) {
+  return webfs_crc32(0, (const uint8_t *)h, offsetof(sector_header_t, crc));
+}
+
+static bool is_blank(const void *p, size_t len) {
+  const uint8_t *b = (const uint8_t *)p;
+  for (size_t i = 0; i < len; i++) {
+    if (b[i] != 0xFF) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static size_t slot_offset(uint32_t sector, uint32_t slot) {
+  return (size_t)sector * EVENT_LOG_SECTOR + (size_t)(slot + 1) * EVENT_LOG_RECORD;
+}
+
+static bool record_valid(const record_t *r) {
+  return !is_blank(r, sizeof(*r)) && r->crc == record_crc(r);
+}
+
+static int64_t record_ms(const record_t *r) {
+  return (int64_t)r->time_s * 1000 + r->ms;
+}
+
+static index_entry_t *ring_at(uint32_t i) {
+  return &ring[(ring_start + i) % sectors];
+}
+
+// Registros usados do setor (os torn contam: o slot não volta a ser livre)
+static uint32_t used_slots(uint32_t sector) {
+  return sector == head ? head_slot : EVENT_LOG_PER_SECTOR;
+}
+
+// Instante do primeiro registro válido a partir de slot, ou INT64_MAX
+static int64_t time_from(uint32_t sector, uint32_t slot, uint32_t used) {
+  record_t r;
+  for (; slot < used; slot++) {
+    if (esp_partition_read(part, slot_offset(sector, slot), &r, sizeof(r)) == ESP_OK && record_valid(&r)) {
+      return record_ms(&r);
+    }
+  }
+  return INT64_MAX;
+}
+
+// Primeiro slot do setor com instante >= from_ms (busca binária)
+static uint32_t lower_bound(uint32_t sector, int64_t from_ms) {
+  uint32_t used = used_slots(sector);
+  uint32_t lo = 0, hi = used;
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    if (time_from(sector, mid, used) < from_ms) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+static void mount() {
+  int64_t start_us = esp_timer_get_time();
+  uint32_t max_seq = 0;
+  uint32_t *seqs = (uint32_t *)calloc(sectors, sizeof(uint32_t));
+  memset(&stats, 0, sizeof(stats));
+  stats.sectors = sectors;
+  ring_start = ring_count = 0;
+  head_listed = false;
+  last_ms = 0;
+  if (!seqs) {
+    return;
+  }
+
+  for (uint32_t s = 0; s < sectors; s++) {
+    sector_header_t h;
+    if (esp_partition_read(part, (size_t)s * EVENT_LOG_SECTOR, &h, sizeof(h)) != ESP_OK) {
+      continue;
+    }
+    if (h.magic == SECTOR_MAGIC && h.record == EVENT_LOG_RECORD && h.crc == header_crc(&h) && h.seq) {
+      seqs[s] = h.seq;
+      if (h.seq > max_seq) {
+        max_seq = h.seq;
+        head = s;
+      }
+    } else if (!is_blank(&h, sizeof(h))) {
+      stats.bad_sectors++;
+    }
+  }
+
+  if (!max_seq) {
+    // Partição vazia: o primeiro registro abre o setor 0
+    head = sectors - 1;
+    head_slot = EVENT_LOG_PER_SECTOR;
+    next_seq = 1;
+  } else {
+    // Na cabeça a gravação segue depois do último slot não apagado; um
+    // registro pela metade ali é a última gravação antes da queda
+    record_t batch[READ_BATCH];
+    head_slot = 0;
+    for (uint32_t slot = 0; slot < EVENT_LOG_PER_SECTOR; slot += READ_BATCH) {
+      uint32_t n = EVENT_LOG_PER_SECTOR - slot < READ_BATCH ? EVENT_LOG_PER_SECTOR - slot : READ_BATCH;
+      esp_partition_read(part, slot_offset(head, slot), batch, n * sizeof(record_t));
+      for (uint32_t i = 0; i < n; i++) {
+        if (!is_blank(&batch[i], sizeof(record_t))) {
+          head_slot = slot + i + 1;
+          stats.torn += !record_valid(&batch[i]);
+        }
+      }
+    }
+    next_seq = max_seq + 1;
+  }
+
+  // O anel segue a ordem dos setores a partir do que vem depois da cabeça
+  for (uint32_t k = 1; k <= sectors; k++) {
+    uint32_t s = (head + k) % sectors;
+    if (!seqs[s]) {
+      continue;
+    }
+    int64_t first = time_from(s, 0, used_slots(s));
+    if (first == INT64_MAX) {
+      continue;
+    }
+    index_entry_t *e = &ring[(ring_start + ring_count++) % sectors];
+    e->first_ms = first;
+    e->sector = s;
+    stats.records += used_slots(s);
+    head_listed = s == head;
+  }
+  if (ring_count) {
+    // Último instante gravado: a busca pelo fim acha o último válido
+    const index_entry_t *last = ring_at(ring_count - 1);
+    uint32_t used = used_slots(last->sector);
+    record_t r;
+    last_ms = last->first_ms;
+    for (uint32_t slot = used; slot-- > 0;) {
+      if (esp_partition_read(part, slot_offset(last->sector, slot), &r, sizeof(r)) == ESP_OK && record_valid(&r)) {
+        last_ms = record_ms(&r);
+        break;
+      }
+    }
+    stats.oldest_ms = ring_at(0)->first_ms;
+    stats.newest_ms = last_ms;
+  }
+  free(seqs);
+  stats.mounted = true;
+  stats.mount_ms = (esp_timer_get_time() - start_us) / 1000;
+}
+
+// Apaga o próximo setor do anel e escreve o cabeçalho; o mais velho sai do
+// índice antes do apagamento, que corre sem o lock
+static bool open_sector() {
+  uint32_t s = (head + 1) % sectors;
+  xSemaphoreTake(lock, portMAX_DELAY);
+  if (ring_count && ring_at(0)->sector == s) {
+    stats.records -= EVENT_LOG_PER_SECTOR;
+    ring_start = (ring_start + 1) % sectors;
+    ring_count--;
+    stats.oldest_ms = ring_count ? ring_at(0)->first_ms : 0;
+  }
+  head = s;
+  head_slot = EVENT_LOG_PER_SECTOR;
+  head_listed = false;
+  stats.erases++;
+  xSemaphoreGive(lock);
+
+  sector_header_t h;
+  memset(&h, 0xFF, sizeof(h));
+  h.magic = SECTOR_MAGIC;
+  h.seq = next_seq++;
+  h.record = EVENT_LOG_RECORD;
+  h.crc = header_crc(&h);
+  esp_err_t err = esp_partition_erase_range(part, (size_t)s * EVENT_LOG_SECTOR, EVENT_LOG_SECTOR);
+  if (err == ESP_OK) {
+    err = esp_partition_write(part, (size_t)s * EVENT_LOG_SECTOR, &h, sizeof(h));
+  }
+  if (err != ESP_OK) {
+    // Fica fora do anel; o próximo registro tenta o setor seguinte
+    log_e("Event log: cannot open sector %u (%s)", (unsigned)s, esp_err_to_name(err));
+    return false;
+  }
+  xSemaphoreTake(lock, portMAX_DELAY);
+  head_slot = 0;
+  xSemaphoreGive(lock);
+  return true;
+}
+
+static void write_entry(const event_log_entry_t *entry) {
+  xSemaphoreTake(writer, portMAX_DELAY);
+  if (head_slot >= EVENT_LOG_PER_SECTOR && !open_sector()) {
+    __atomic_add_fetch(&stats.write_errors, 1, __ATOMIC_RELAXED);
+    xSemaphoreGive(writer);
+    return;
+  }
+  // Relógio que voltou (reboot sem SNTP) grava com o último instante: o log
+  // continua ordenado para a busca binária
+  int64_t t = entry->time_ms > last_ms ? entry->time_ms : last_ms;
+  record_t r;
+  memset(&r, 0xFF, sizeof(r));
+  r.time_s = t / 1000;
+  r.ms = t % 1000;
+  r.type = entry->type;
+  r.flags = entry->flags | (entry->time_ms < SYNCED_MS ? EVENT_LOG_UNSYNCED : 0);
+  r.score = entry->score;
+  memcpy(r.box, entry->box, sizeof(r.box));
+  r.crc = record_crc(&r);
+  esp_err_t err = esp_partition_write(part, slot_offset(head, head_slot), &r, sizeof(r));
+
+  // O slot é consumido mesmo com erro: pode ter ficado gravado pela metade
+  xSemaphoreTake(lock, portMAX_DELAY);
+  if (err == ESP_OK) {
+    if (!head_listed) {
+      index_entry_t *e = &ring[(ring_start + ring_count++) % sectors];
+      e->first_ms = t;
+      e->sector = head;
+      head_listed = true;
+      stats.records += head_slot;  // slots que erros anteriores já gastaram
+    }
+    last_ms = t;
+    stats.appended++;
+    stats.newest_ms = t;
+    stats.oldest_ms = ring_at(0)->first_ms;
+  } else {
+    stats.write_errors++;
+  }
+  head_slot++;
+  stats.records += head_listed;
+  xSemaphoreGive(lock);
+  xSemaphoreGive(writer);
+}
+
+static void event_log_task(void *arg) {
+  (void)arg;
+  event_log_entry_t entry;
+  for (;;) {
+    if (xQueueReceive(inbox, &entry, portMAX_DELAY) == pdTRUE) {
+      write_entry(&entry);
+    }
+  }
+}
+
+bool event_log_begin() {
+  if (!lock) {
+    part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, EVENT_LOG_PARTITION);
+    if (!part) {
+      log_w("Event log: partition '%s' not found; events are not kept", EVENT_LOG_PARTITION);
+      return false;
+    }
+    sectors = part->size / EVENT_LOG_SECTOR;
+    lock = xSemaphoreCreateMutex();
+    writer = xSemaphoreCreateMutex();
+    inbox = xQueueCreate(EVENT_LOG_INBOX, sizeof(event_log_entry_t));
+    ring = (index_entry_t *)calloc(sectors, sizeof(index_entry_t));
+    if (!lock || !writer || !inbox || !ring || sectors < 2 ||
+        xTaskCreate(event_log_task, "evlog", EVENT_LOG_TASK_STACK, NULL, EVENT_LOG_TASK_PRIORITY, NULL) != pdPASS) {
+      log_e("Event log: cannot start");
+      part = NULL;
+      return false;
+    }
+  }
+  if (!part) {
+    return false;
+  }
+  xSemaphoreTake(writer, portMAX_DELAY);
+  xSemaphoreTake(lock, portMAX_DELAY);
+  mount();
+  xSemaphoreGive(lock);
+  xSemaphoreGive(writer);
+  log_i("Event log: %u records in %u sectors, %u torn, %u bad sectors (%u ms)", (unsigned)stats.records, (unsigned)sectors,
+        (unsigned)stats.torn, (unsigned)stats.bad_sectors, (unsigned)stats.mount_ms);
+  return stats.mounted;
+}
+
+bool event_log_append(const event_log_entry_t *entry) {
+  if (!part || xQueueSend(inbox, entry, 0) != pdTRUE) {
+    __atomic_add_fetch(&stats.dropped, 1, __ATOMIC_RELAXED);
+    return false;
+  }
+  return true;
+}
+
+int event_log_query(int64_t from_ms, int64_t to_ms, uint8_t type, event_log_entry_t *out, int max, int64_t *next_ms) {
+  int n = 0;
+  *next_ms = 0;
+  if (!part) {
+    return 0;
+  }
+  xSemaphoreTake(lock, portMAX_DELAY);
+  // Último setor que começa antes de from_ms: o primeiro registro pedido
+  // está nele ou no começo do seguinte
+  uint32_t lo = 0, hi = ring_count;
+  while (lo < hi) {
+    uint32_t mid = (lo + hi) / 2;
+    if (ring_at(mid)->first_ms < from_ms) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  uint32_t k = lo ? lo - 1 : 0;
+  uint32_t slot = lo ? lower_bound(ring_at(k)->sector, from_ms) : 0;
+
+  record_t batch[READ_BATCH];
+  bool done = false;
+  for (; k < ring_count && !done; k++, slot = 0) {
+    uint32_t sector = ring_at(k)->sector;
+    uint32_t used = used_slots(sector);
+    while (slot < used && !done) {
+      uint32_t count = used - slot < READ_BATCH ? used - slot : READ_BATCH;
+      if (esp_partition_read(part, slot_offset(sector, slot), batch, count * sizeof(record_t)) != ESP_OK) {
+        break;
+      }
+      for (uint32_t i = 0; i < count && !done; i++) {
+        const record_t *r = &batch[i];
+        int64_t t = record_ms(r);
+        if (!record_valid(r) || t < from_ms || (type && r->type != type)) {
+          continue;
+        }
+        if (t >= to_ms) {
+          done = true;
+        } else if (n == max) {
+          *next_ms = t;
+          done = true;
+        } else {
+          event_log_entry_t *e = &out[n++];
+          e->time_ms = t;
+          e->type = r->type;
+          e->flags = r->flags;
+          e->score = r->score;
+          memcpy(e->box, r->box, sizeof(e->box));
+        }
+      }
+      slot += count;
+    }
+  }
+  xSemaphoreGive(lock);
+  return n;
+}
+
+void event_log_get_stats(event_log_stats_t *out) {
+  if (!lock) {
+    memset(out, 0, sizeof(*out));
+    return;
+  }
+  xSemaphoreTake(lock, portMAX_DELAY);
+  *out = stats;
+  xSemaphoreGive(lock);
+}
+
+const char *event_log_type_name(uint8_t type) {
+  switch (type) {
+    case EVENT_LOG_MOTION: return "motion";
+    case EVENT_LOG_TAMPER: return "tamper";
+    default: return "unknown";
+  }
+}
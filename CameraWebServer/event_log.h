@@ -0,0 +1,77 @@
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+// Histórico de eventos na partição "evlog": registros de 16 bytes de tamanho
+// fixo gravados só em sequência (log estruturado), setor a setor, num anel.
+// Cada setor de 4 KB começa com um cabeçalho (número de sequência + CRC) e
+// recebe EVENT_LOG_PER_SECTOR registros; cheio o anel, o setor mais velho é
+// apagado e reaproveitado, então todos os setores gastam por igual.
+//
+// Os instantes nunca voltam (um relógio atrasado grava com o último instante
+// visto), o que deixa o log ordenado por tempo: o índice em RAM guarda o
+// primeiro instante de cada setor e a consulta acha o começo com duas buscas
+// binárias, no índice e dentro do setor, lendo só alguns registros da flash.
+//
+// Queda de energia: registro pela metade falha no CRC e é pulado; setor com
+// cabeçalho inválido (apagamento ou abertura interrompidos) fica fora do anel
+// até ser apagado de novo. A gravação continua depois do último registro.
+//
+// event_log_append só copia para a fila da tarefa "evlog", sem esperar: pode
+// ser chamado da tarefa de captura (o apagamento de um setor leva dezenas de ms).
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define EVENT_LOG_PARTITION "evlog"
+#define EVENT_LOG_SECTOR 4096
+#define EVENT_LOG_RECORD 16
+#define EVENT_LOG_PER_SECTOR (EVENT_LOG_SECTOR / EVENT_LOG_RECORD - 1)  // o primeiro slot é o cabeçalho
+#define EVENT_LOG_INBOX 16
+#define EVENT_LOG_TASK_STACK 3072
+#define EVENT_LOG_TASK_PRIORITY 2    // abaixo do MQTT
+
+typedef enum {
+  EVENT_LOG_MOTION = 1,
+  EVENT_LOG_TAMPER = 2,
+} event_log_type_t;
+
+#define EVENT_LOG_END 0x01       // fim do evento (sem a flag: começo)
+#define EVENT_LOG_UNSYNCED 0x02  // relógio antes de 2020 (sem SNTP ainda)
+
+typedef struct {
+  int64_t time_ms;  // unix, ms
+  uint8_t type;     // event_log_type_t
+  uint8_t flags;
+  uint8_t score;    // 0-100
+  uint8_t box[4];   // x0, y0, x1, y1 em 1/255 do quadro (x1/y1 inclusivos)
+} event_log_entry_t;
+
+typedef struct {
+  bool mounted;
+  uint32_t sectors;      // do anel (tamanho da partição / 4 KB)
+  uint32_t records;      // no log agora
+  uint32_t appended;     // desde o boot
+  uint32_t dropped;      // fila cheia ou log desmontado
+  uint32_t write_errors;
+  uint32_t erases;       // desde o boot
+  uint32_t torn;         // registros com CRC inválido vistos na montagem
+  uint32_t bad_sectors;  // cabeçalhos inválidos na montagem
+  uint32_t mount_ms;
+  int64_t oldest_ms;     // 0 com o log vazio
+  int64_t newest_ms;
+} event_log_stats_t;
+
+// Monta a partição (reconstrói o índice) e sobe a tarefa. Chamar de novo
+// remonta a partir da flash, como depois de um reboot.
+bool event_log_begin();
+// false se a fila está cheia ou o log não montou. Não bloqueia.
+bool event_log_append(const event_log_entry_t *entry);
+// Registros com from_ms <= instante < to_ms, do mais antigo, até max (de
+// tipo type, 0 = todos); *next_ms recebe o instante do próximo que ficou de
+// fora, ou 0. Retorna quantos foram para out.
+int event_log_query(int64_t from_ms, int64_t to_ms, uint8_t type, event_log_entry_t *out, int max, int64_t *next_ms);
+void event_log_get_stats(event_log_stats_t *out);
+const char *event_log_type_name(uint8_t type);
+
+#endif
@@ -0,0 +1,216 @@
+#include "frame_hub.h"
+#include <stdlib.h>
+#include <string.h>
+#include "esp_camera.h"
+#include "esp_timer.h"
+#include "img_converters.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "metrics.h"
+#include "trace.h"
+
+#include "esp32-hal-log.h"
+
+#define HUB_TASK_STACK 4096
+#define HUB_TASK_PRIORITY 5
+#define CAPTURE_RETRY_MS 100
+
+typedef struct {
+  bool active;
+  QueueHandle_t queue;
+  int64_t paused_until;
+  uint32_t stale;
+} subscriber_t;
+
+static SemaphoreHandle_t lock = NULL;
+static SemaphoreHandle_t wake = NULL;  // dado quando entra um assinante
+static subscriber_t subs[FRAME_HUB_MAX_SUBSCRIBERS];
+static int active_count = 0;
+static int keepers = 0;  // frame_hub_keep_capturing
+static frame_hub_analyze_fn analyzer = NULL;
+
+// Copia o quadro do driver (ou converte para JPEG) para um buffer próprio
+static hub_frame_t *frame_new(camera_fb_t *fb) {
+  hub_frame_t *frame = (hub_frame_t *)malloc(sizeof(hub_frame_t));
+  if (!frame) {
+    return NULL;
+  }
+  memset(frame, 0, sizeof(*frame));
+  if (fb->format == PIXFORMAT_JPEG) {
+    frame->buf = (uint8_t *)malloc(fb->len);
+    if (frame->buf) {
+      memcpy(frame->buf, fb->buf, fb->len);
+      frame->len = fb->len;
+    }
+  } else if (!frame2jpg(fb, 80, &frame->buf, &frame->len)) {
+    frame->buf = NULL;
+  }
+  if (!frame->buf) {
+    free(frame);
+    return NULL;
+  }
+  frame->width = fb->width;
+  frame->height = fb->height;
+  frame->timestamp = fb->timestamp;
+  frame->refs = 1;
+  return frame;
+}
+
+void frame_hub_release(hub_frame_t *frame) {
+  if (frame && __atomic_sub_fetch(&frame->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+    free(frame->buf);
+    free(frame);
+  }
+}
+
+static void publish(hub_frame_t *frame) {
+  xSemaphoreTake(lock, portMAX_DELAY);
+  for (int i = 0; i < FRAME_HUB_MAX_SUBSCRIBERS; i++) {
+    subscriber_t *sub = &subs[i];
+    if (!sub->active || frame->captured_us < __atomic_load_n(&sub->paused_until, __ATOMIC_RELAXED)) {
+      continue;
+    }
+    __atomic_add_fetch(&frame->refs, 1, __ATOMIC_RELAXED);
+    if (xQueueSend(sub->queue, &frame, 0) == pdTRUE) {
+      continue;
+    }
+    // Fila cheia: o assinante não acompanha, perde o quadro mais antigo
+    hub_frame_t *old = NULL;
+    if (xQueueReceive(sub->queue, &old, 0) == pdTRUE) {
+      frame_hub_release(old);
+      __atomic_add_fetch(&sub->stale, 1, __ATOMIC_RELAXED);
+      metrics_drop(METRIC_DROP_STALE);
+    }
+    if (xQueueSend(sub->queue, &frame, 0) != pdTRUE) {
+      frame_hub_release(frame);
+    }
+  }
+  xSemaphoreGive(lock);
+}
+
+static void hub_task(void *arg) {
+  (void)arg;
+  for (;;) {
+    if (!__atomic_load_n(&active_count, __ATOMIC_ACQUIRE) && !__atomic_load_n(&keepers, __ATOMIC_ACQUIRE)) {
+      xSemaphoreTake(wake, portMAX_DELAY);
+      continue;
+    }
+    int64_t t_wait = esp_timer_get_time();
+    trace_begin("capture", 0);
+    camera_fb_t *fb = esp_camera_fb_get();
+    trace_end("capture");
+    int64_t t_got = esp_timer_get_time();
+    if (!fb) {
+      log_e("Camera capture failed");
+      metrics_drop(METRIC_DROP_CAPTURE);
+      vTaskDelay(CAPTURE_RETRY_MS / portTICK_PERIOD_MS);
+      continue;
+    }
+    metrics_observe(METRIC_CAPTURE_WAIT, t_got - t_wait);
+
+    trace_begin("encode", fb->len);
+    hub_frame_t *frame = frame_new(fb);
+    esp_camera_fb_return(fb);
+    trace_end("encode");
+    if (!frame) {
+      log_e("Frame copy failed");
+      metrics_drop(METRIC_DROP_ENCODE);
+      continue;
+    }
+    frame->captured_us = t_got;
+    metrics_observe(METRIC_ENCODE, esp_timer_get_time() - t_got);
+
+    uint32_t rest_ms = analyzer ? analyzer(frame) : 0;
+    publish(frame);
+    frame_hub_release(frame);
+    if (rest_ms) {
+      vTaskDelay(rest_ms / portTICK_PERIOD_MS);
+    }
+  }
+}
+
+bool frame_hub_begin(frame_hub_analyze_fn analyze) {
+  if (lock) {
+    return true;
+  }
+  analyzer = analyze;
+  lock = xSemaphoreCreateMutex();
+  wake = xSemaphoreCreateBinary();
+  if (!lock || !wake) {
+    return false;
+  }
+  return xTaskCreate(hub_task, "frame_hub", HUB_TASK_STACK, NULL, HUB_TASK_PRIORITY, NULL) == pdPASS;
+}
+
+int frame_hub_subscribe() {
+  if (!lock) {
+    return -1;
+  }
+  int slot = -1;
+  xSemaphoreTake(lock, portMAX_DELAY);
+  for (int i = 0; i < FRAME_HUB_MAX_SUBSCRIBERS && slot < 0; i++) {
+    if (!subs[i].active) {
+      QueueHandle_t queue = xQueueCreate(FRAME_HUB_QUEUE_DEPTH, sizeof(hub_frame_t *));
+      if (!queue) {
+        break;
+      }
+      subs[i].queue = queue;
+      subs[i].paused_until = 0;
+      subs[i].stale = 0;
+      subs[i].active = true;
+      slot = i;
+    }
+  }
+  if (slot >= 0) {
+    __atomic_add_fetch(&active_count, 1, __ATOMIC_RELEASE);
+  }
+  xSemaphoreGive(lock);
+  if (slot >= 0) {
+    xSemaphoreGive(wake);
+  }
+  return slot;
+}
+
+void frame_hub_unsubscribe(int sub) {
+  if (sub < 0) {
+    return;
+  }
+  xSemaphoreTake(lock, portMAX_DELAY);
+  subs[sub].active = false;
+  __atomic_sub_fetch(&active_count, 1, __ATOMIC_RELEASE);
+  hub_frame_t *frame;
+  while (xQueueReceive(subs[sub].queue, &frame, 0) == pdTRUE) {
+    frame_hub_release(frame);
+  }
+  vQueueDelete(subs[sub].queue);
+  subs[sub].queue = NULL;
+  xSemaphoreGive(lock);
+}
+
+hub_frame_t *frame_hub_receive(int sub, uint32_t timeout_ms) {
+  hub_frame_t *frame = NULL;
+  if (xQueueReceive(subs[sub].queue, &frame, timeout_ms / portTICK_PERIOD_MS) != pdTRUE) {
+    return NULL;
+  }
+  return frame;
+}
+
+void frame_hub_pause(int sub, int64_t until_us) {
+  __atomic_store_n(&subs[sub].paused_until, until_us, __ATOMIC_RELAXED);
+}
+
+uint32_t frame_hub_take_stale(int sub) {
+  return __atomic_exchange_n(&subs[sub].stale, 0, __ATOMIC_RELAXED);
+}
+
+int frame_hub_subscribers() {
+  return __atomic_load_n(&active_count, __ATOMIC_RELAXED);
+}
+
+void frame_hub_keep_capturing(bool on) {
+  if (__atomic_add_fetch(&keepers, on ? 1 : -1, __ATOMIC_RELEASE) > 0 && on && wake) {
+    xSemaphoreGive(wake);
+  }
+}
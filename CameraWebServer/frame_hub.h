@@ -0,0 +1,51 @@
+#ifndef FRAME_HUB_H
+#define FRAME_HUB_H
+
+// Captura separada do envio: uma tarefa pega os quadros da câmera, copia (ou
+// converte para JPEG) uma vez só e devolve o buffer ao driver na hora. Cada
+// assinante (uma sessão de fluxo) tem a sua fila curta; com a fila cheia, o
+// quadro mais antigo daquele assinante é descartado como velho e os outros
+// não sentem nada. A tarefa só captura enquanto há assinantes.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <sys/time.h>
+
+#define FRAME_HUB_MAX_SUBSCRIBERS 4
+#define FRAME_HUB_QUEUE_DEPTH 2
+
+typedef struct {
+  uint8_t *buf;  // JPEG
+  size_t len;
+  uint16_t width, height;
+  struct timeval timestamp;
+  int64_t captured_us;
+  bool changed;    // preenchidos pelo analisador, se houver
+  bool is_static;
+  uint32_t refs;   // interno
+} hub_frame_t;
+
+// Chamado na tarefa de captura para cada quadro, antes de publicar; retorna
+// por quantos ms a captura pode descansar (cena estática)
+typedef uint32_t (*frame_hub_analyze_fn)(hub_frame_t *frame);
+
+bool frame_hub_begin(frame_hub_analyze_fn analyze);
+
+// Retorna o assinante ou -1 com todos ocupados
+int frame_hub_subscribe();
+void frame_hub_unsubscribe(int sub);
+// Próximo quadro do assinante (NULL no timeout); devolver com release
+hub_frame_t *frame_hub_receive(int sub, uint32_t timeout_ms);
+void frame_hub_release(hub_frame_t *frame);
+// Quadros capturados antes de until_us não entram na fila do assinante (a
+// sessão limitou a própria taxa)
+void frame_hub_pause(int sub, int64_t until_us);
+// Quadros velhos descartados da fila do assinante desde a última chamada
+uint32_t frame_hub_take_stale(int sub);
+int frame_hub_subscribers();
+// Mantém a captura (e o analisador) rodando mesmo sem assinantes, para quem
+// só quer o que o analisador vê; cada true pede um false depois
+void frame_hub_keep_capturing(bool on);
+
+#endif
@@ -0,0 +1,223 @@
+#include "jpeg_delta.h"
+#include "jpeg_mcu.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(ESP_PLATFORM)
+#include "esp_heap_caps.h"
+#endif
+
+// Maior MCU possível: 10 blocos com 63 coeficientes de até 26 bits cada
+#define JPEG_DELTA_MCU_BYTES (JPEG_MCU_MAX_BLOCKS * 208)
+
+struct jpeg_delta_encoder {
+  jpeg_delta_params_t params;
+  jpeg_delta_stats_t stats;
+  jpeg_info_t info;
+  uint32_t header_hash;
+  uint32_t ref_mcus;
+  uint8_t ref_blocks;
+  jpeg_block_t *ref;
+  uint32_t *ref_hash;
+  uint8_t *out;
+  size_t out_cap;
+  uint32_t seq;
+  uint32_t since_key;
+  bool force_key;
+  uint8_t mcu_bits[JPEG_DELTA_MCU_BYTES];
+};
+
+static void *delta_alloc(size_t size) {
+#if defined(ESP_PLATFORM)
+  // As referências de uma imagem VGA ocupam dezenas de KB: preferir PSRAM
+  void *p = heap_caps_malloc(size, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (p) {
+    return p;
+  }
+#endif
+  return malloc(size);
+}
+
+static uint32_t fnv1a(uint32_t h, const uint8_t *p, size_t n) {
+  while (n--) {
+    h = (h ^ *p++) * 16777619u;
+  }
+  return h;
+}
+
+static inline uint8_t *put_u16(uint8_t *p, uint16_t v) {
+  p[0] = v;
+  p[1] = v >> 8;
+  return p + 2;
+}
+
+static inline uint8_t *put_u32(uint8_t *p, uint32_t v) {
+  p[0] = v;
+  p[1] = v >> 8;
+  p[2] = v >> 16;
+  p[3] = v >> 24;
+  return p + 4;
+}
+
+jpeg_delta_encoder_t *jpeg_delta_encoder_new(const jpeg_delta_params_t *params) {
+  jpeg_delta_encoder_t *enc = (jpeg_delta_encoder_t *)delta_alloc(sizeof(jpeg_delta_encoder_t));
+  if (!enc) {
+    return NULL;
+  }
+  memset(enc, 0, sizeof(jpeg_delta_encoder_t));
+  enc->params = *params;
+  enc->force_key = true;
+  return enc;
+}
+
+void jpeg_delta_encoder_free(jpeg_delta_encoder_t *enc) {
+  if (!enc) {
+    return;
+  }
+  free(enc->ref);
+  free(enc->ref_hash);
+  free(enc->out);
+  free(enc);
+}
+
+void jpeg_delta_request_keyframe(jpeg_delta_encoder_t *enc) {
+  enc->force_key = true;
+}
+
+const jpeg_delta_stats_t *jpeg_delta_get_stats(const jpeg_delta_encoder_t *enc) {
+  return &enc->stats;
+}
+
+static bool ensure_refs(jpeg_delta_encoder_t *enc, const jpeg_info_t *info) {
+  if (enc->ref && enc->ref_mcus == info->mcu_count && enc->ref_blocks == info->blocks_per_mcu) {
+    return true;
+  }
+  free(enc->ref);
+  free(enc->ref_hash);
+  enc->ref = (jpeg_block_t *)delta_alloc(sizeof(jpeg_block_t) * info->mcu_count * info->blocks_per_mcu);
+  enc->ref_hash = (uint32_t *)delta_alloc(sizeof(uint32_t) * info->mcu_count);
+  if (!enc->ref || !enc->ref_hash) {
+    free(enc->ref);
+    free(enc->ref_hash);
+    enc->ref = NULL;
+    enc->ref_hash = NULL;
+    enc->ref_mcus = 0;
+    return false;
+  }
+  enc->ref_mcus = info->mcu_count;
+  enc->ref_blocks = info->blocks_per_mcu;
+  return true;
+}
+
+static bool ensure_out(jpeg_delta_encoder_t *enc, size_t need) {
+  if (enc->out_cap >= need) {
+    return true;
+  }
+  free(enc->out);
+  enc->out = (uint8_t *)delta_alloc(need);
+  enc->out_cap = enc->out ? need : 0;
+  return enc->out != NULL;
+}
+
+static bool mcu_changed(const jpeg_delta_encoder_t *enc, const jpeg_block_t *ref, const jpeg_block_t *cur, uint32_t ref_hash, uint32_t cur_hash) {
+  const jpeg_delta_params_t *p = &enc->params;
+  if (!p->dc_threshold && !p->ac_threshold) {
+    return ref_hash != cur_hash;
+  }
+  for (int b = 0; b < enc->ref_blocks; b++) {
+    if (abs(cur[b].dc - ref[b].dc) > p->dc_threshold || abs((int)cur[b].ac_bits - (int)ref[b].ac_bits) > p->ac_threshold) {
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t jpeg_delta_encode(jpeg_delta_encoder_t *enc, const uint8_t *jpg, size_t len, const uint8_t **out) {
+  jpeg_info_t *info = &enc->info;
+  if (!jpeg_parse_header(jpg, len, info) || info->mcu_count > 0xFFFF || !ensure_refs(enc, info)) {
+    enc->stats.errors++;
+    enc->force_key = true;
+    return 0;
+  }
+
+  // O DRI é removido: o reagrupador regrava o fluxo sem marcadores RST
+  size_t hdr_len = info->header_len - (info->dri_offset ? 6 : 0);
+  uint32_t hash = fnv1a(2166136261u, jpg, info->dri_offset ? info->dri_offset : info->header_len);
+  if (info->dri_offset) {
+    hash = fnv1a(hash, jpg + info->dri_offset + 6, info->header_len - info->dri_offset - 6);
+  }
+  bool key = enc->force_key || hash != enc->header_hash || (enc->params.keyframe_interval && enc->since_key >= enc->params.keyframe_interval);
+
+  size_t bound = JPEG_DELTA_HEADER_SIZE + hdr_len + info->scan_len + (size_t)info->mcu_count * (3 + 4 * info->blocks_per_mcu);
+  if (!ensure_out(enc, bound)) {
+    enc->stats.errors++;
+    return 0;
+  }
+
+  uint8_t *p = enc->out;
+  memcpy(p, JPEG_DELTA_MAGIC, 4);
+  p[4] = key ? JPEG_DELTA_FLAG_KEYFRAME : 0;
+  p[5] = info->blocks_per_mcu;
+  put_u16(p + 6, info->mcus_x);
+  put_u32(p + 8, enc->seq);
+  put_u32(p + 12, info->mcu_count);
+  uint8_t *changed_at = p + 16;
+  p = put_u16(p + 20, key ? hdr_len : 0);
+  if (key) {
+    if (info->dri_offset) {
+      memcpy(p, jpg, info->dri_offset);
+      memcpy(p + info->dri_offset, jpg + info->dri_offset + 6, info->header_len - info->dri_offset - 6);
+    } else {
+      memcpy(p, jpg, hdr_len);
+    }
+    p += hdr_len;
+  }
+
+  jpeg_scan_t scan;
+  jpeg_block_t blocks[JPEG_MCU_MAX_BLOCKS];
+  jpeg_bit_writer_t w;
+  uint32_t changed = 0;
+  jpeg_scan_begin(&scan, info);
+  for (uint32_t m = 0; m < info->mcu_count; m++) {
+    jpeg_bit_writer_init(&w, enc->mcu_bits, sizeof(enc->mcu_bits), false);
+    if (!jpeg_scan_mcu(&scan, blocks, &w)) {
+      // Referências ficaram parcialmente atualizadas: próximo quadro é keyframe
+      enc->stats.errors++;
+      enc->force_key = true;
+      return 0;
+    }
+    size_t nbytes = jpeg_bit_writer_flush(&w);
+    uint32_t h = fnv1a(fnv1a(2166136261u, (const uint8_t *)blocks, sizeof(jpeg_block_t) * info->blocks_per_mcu), enc->mcu_bits, nbytes);
+    jpeg_block_t *ref = enc->ref + (size_t)m * info->blocks_per_mcu;
+    if (!key && !mcu_changed(enc, ref, blocks, enc->ref_hash[m], h)) {
+      continue;
+    }
+    p = put_u16(p, m);
+    for (int b = 0; b < info->blocks_per_mcu; b++) {
+      p = put_u16(p, (uint16_t)blocks[b].dc);
+      p = put_u16(p, blocks[b].ac_bits);
+    }
+    memcpy(p, enc->mcu_bits, nbytes);
+    p += nbytes;
+    memcpy(ref, blocks, sizeof(jpeg_block_t) * info->blocks_per_mcu);
+    enc->ref_hash[m] = h;
+    changed++;
+  }
+  put_u32(changed_at, changed);
+
+  enc->seq++;
+  enc->header_hash = hash;
+  enc->force_key = false;
+  enc->since_key = key ? 1 : enc->since_key + 1;
+
+  size_t out_len = p - enc->out;
+  enc->stats.frames++;
+  enc->stats.keyframes += key;
+  enc->stats.last_changed = changed;
+  enc->stats.mcus_total += info->mcu_count;
+  enc->stats.mcus_sent += changed;
+  enc->stats.bytes_in += len;
+  enc->stats.bytes_out += out_len;
+  *out = enc->out;
+  return out_len;
+}
@@ -0,0 +1,49 @@
+#ifndef JPEG_DELTA_H
+#define JPEG_DELTA_H
+
+// Fluxo experimental de reposição condicional: compara as MCUs entrópicas
+// de cada JPEG com as últimas enviadas e transmite apenas as que mudaram,
+// com keyframes completos periódicos. O reagrupador de referência fica em
+// tools/delta_reassembler.
+//
+// Formato do pacote (little endian):
+//   "MJD1" | flags u8 | blocos/MCU u8 | mcus_x u16 | seq u32 | mcus u32
+//   | alteradas u32 | header_len u16 | cabeçalho JPEG sem DRI (keyframe)
+//   | registros: índice u16, (dc i16, bits AC u16) por bloco, bits AC
+//     concatenados e completados até o byte
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define JPEG_DELTA_MAGIC          "MJD1"
+#define JPEG_DELTA_FLAG_KEYFRAME  0x01
+#define JPEG_DELTA_HEADER_SIZE    22
+
+typedef struct {
+  uint16_t keyframe_interval;  // quadros entre keyframes (0 = apenas quando necessário)
+  uint8_t dc_threshold;        // diferença de DC (quantizado) que marca a MCU como alterada
+  uint16_t ac_threshold;       // diferença em bits AC; 0 e 0 = comparação exata
+} jpeg_delta_params_t;
+
+typedef struct {
+  uint32_t frames;
+  uint32_t keyframes;
+  uint32_t errors;
+  uint32_t last_changed;
+  uint64_t mcus_total;
+  uint64_t mcus_sent;
+  uint64_t bytes_in;
+  uint64_t bytes_out;
+} jpeg_delta_stats_t;
+
+typedef struct jpeg_delta_encoder jpeg_delta_encoder_t;
+
+jpeg_delta_encoder_t *jpeg_delta_encoder_new(const jpeg_delta_params_t *params);
+void jpeg_delta_encoder_free(jpeg_delta_encoder_t *enc);
+void jpeg_delta_request_keyframe(jpeg_delta_encoder_t *enc);
+// Gera o pacote do quadro; o buffer retornado em *out pertence ao codificador
+// e é válido até a próxima chamada. Retorna 0 se o JPEG não for suportado.
+size_t jpeg_delta_encode(jpeg_delta_encoder_t *enc, const uint8_t *jpg, size_t len, const uint8_t **out);
+const jpeg_delta_stats_t *jpeg_delta_get_stats(const jpeg_delta_encoder_t *enc);
+
+#endif
@@ -0,0 +1,451 @@
+#include "jpeg_mcu.h"
+#include <string.h>
+
+static inline uint16_t read_be16(const uint8_t *p) {
+  return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+static bool build_huff_table(jpeg_huff_table_t *t, const uint8_t *counts, const uint8_t *values, size_t nvalues) {
+  uint16_t huffcode[256];
+  uint8_t huffsize[256];
+  size_t total = 0;
+
+  memset(t, 0, sizeof(jpeg_huff_table_t));
+  for (int l = 1; l <= 16; l++) {
+    t->bits[l] = counts[l - 1];
+    total += counts[l - 1];
+  }
+  if (total > 256 || total > nvalues) {
+    return false;
+  }
+  memcpy(t->huffval, values, total);
+
+  uint32_t code = 0;
+  size_t k = 0;
+  for (int l = 1; l <= 16; l++) {
+    for (int i = 0; i < t->bits[l]; i++) {
+      huffsize[k] = l;
+      huffcode[k] = code;
+      code++;
+      k++;
+    }
+    if (code > (1u << l)) {
+      return false;
+    }
+    code <<= 1;
+  }
+
+  k = 0;
+  for (int l = 1; l <= 16; l++) {
+    if (t->bits[l]) {
+      t->valptr[l] = k;
+      t->mincode[l] = huffcode[k];
+      k += t->bits[l];
+      t->maxcode[l] = huffcode[k - 1];
+    } else {
+      t->maxcode[l] = -1;
+    }
+  }
+  t->maxcode[17] = 0x7FFFFFFF;
+
+  for (k = 0; k < total; k++) {
+    t->ehufco[t->huffval[k]] = huffcode[k];
+    t->ehufsi[t->huffval[k]] = huffsize[k];
+    if (huffsize[k] <= JPEG_HUFF_LOOKAHEAD) {
+      int shift = JPEG_HUFF_LOOKAHEAD - huffsize[k];
+      uint32_t base = (uint32_t)huffcode[k] << shift;
+      for (uint32_t i = 0; i < (1u << shift); i++) {
+        t->lookup[base + i] = (uint16_t)((huffsize[k] << 8) | t->huffval[k]);
+      }
+    }
+  }
+  t->present = true;
+  return true;
+}
+
+static bool parse_dht(jpeg_info_t *info, const uint8_t *seg, size_t n) {
+  while (n >= 17) {
+    uint8_t tc = seg[0] >> 4;
+    uint8_t th = seg[0] & 0x0F;
+    if (tc > 1 || th > 1) {
+      return false;
+    }
+    size_t total = 0;
+    for (int i = 0; i < 16; i++) {
+      total += seg[1 + i];
+    }
+    if (17 + total > n) {
+      return false;
+    }
+    jpeg_huff_table_t *t = tc ? &info->ac[th] : &info->dc[th];
+    if (!build_huff_table(t, seg + 1, seg + 17, total)) {
+      return false;
+    }
+    seg += 17 + total;
+    n -= 17 + total;
+  }
+  return n == 0;
+}
+
+static bool parse_dqt(jpeg_info_t *info, const uint8_t *seg, size_t n) {
+  while (n > 0) {
+    uint8_t pq = seg[0] >> 4;
+    uint8_t tq = seg[0] & 0x0F;
+    size_t sz = pq ? 128 : 64;
+    if (tq > 3 || 1 + sz > n) {
+      return false;
+    }
+    for (int i = 0; i < 64; i++) {
+      // Tabelas de 16 bits são saturadas em 8 bits (o sensor gera apenas 8 bits)
+      uint16_t v = pq ? read_be16(seg + 1 + i * 2) : seg[1 + i];
+      info->qt[tq][i] = v > 255 ? 255 : v;
+    }
+    info->qt_present |= 1 << tq;
+    seg += 1 + sz;
+    n -= 1 + sz;
+  }
+  return true;
+}
+
+static bool parse_sof(jpeg_info_t *info, const uint8_t *seg, size_t n) {
+  if (n < 6 || seg[0] != 8) {
+    return false;
+  }
+  info->height = read_be16(seg + 1);
+  info->width = read_be16(seg + 3);
+  info->ncomp = seg[5];
+  if (!info->width || !info->height || info->ncomp < 1 || info->ncomp > JPEG_MCU_MAX_COMPONENTS || n < 6 + info->ncomp * 3u) {
+    return false;
+  }
+  info->hmax = 1;
+  info->vmax = 1;
+  for (int c = 0; c < info->ncomp; c++) {
+    info->comp_id[c] = seg[6 + c * 3];
+    info->comp_h[c] = seg[7 + c * 3] >> 4;
+    info->comp_v[c] = seg[7 + c * 3] & 0x0F;
+    info->comp_tq[c] = seg[8 + c * 3];
+    if (!info->comp_h[c] || !info->comp_v[c] || info->comp_h[c] > 4 || info->comp_v[c] > 4 || info->comp_tq[c] > 3) {
+      return false;
+    }
+    if (info->comp_h[c] > info->hmax) {
+      info->hmax = info->comp_h[c];
+    }
+    if (info->comp_v[c] > info->vmax) {
+      info->vmax = info->comp_v[c];
+    }
+  }
+  return true;
+}
+
+static bool parse_sos(jpeg_info_t *info, const uint8_t *seg, size_t n) {
+  if (!info->ncomp || n < 1 || seg[0] != info->ncomp || n < 4 + info->ncomp * 2u) {
+    return false;
+  }
+  for (int i = 0; i < info->ncomp; i++) {
+    uint8_t id = seg[1 + i * 2];
+    uint8_t t = seg[2 + i * 2];
+    int c = 0;
+    while (c < info->ncomp && info->comp_id[c] != id) {
+      c++;
+    }
+    if (c == info->ncomp || c != i) {
+      return false;
+    }
+    info->comp_td[c] = t >> 4;
+    info->comp_ta[c] = t & 0x0F;
+    if (info->comp_td[c] > 1 || info->comp_ta[c] > 1 || !info->dc[info->comp_td[c]].present || !info->ac[info->comp_ta[c]].present) {
+      return false;
+    }
+  }
+  // Apenas baseline sequencial: Ss=0, Se=63, Ah=Al=0
+  const uint8_t *p = seg + 1 + info->ncomp * 2;
+  return p[0] == 0 && p[1] == 63 && p[2] == 0;
+}
+
+static bool compute_geometry(jpeg_info_t *info) {
+  if (info->ncomp == 1) {
+    info->mcus_x = (info->width + 7) / 8;
+    info->mcus_y = (info->height + 7) / 8;
+    info->blocks_per_mcu = 1;
+    info->block_comp[0] = 0;
+  } else {
+    info->mcus_x = (info->width + 8 * info->hmax - 1) / (8 * info->hmax);
+    info->mcus_y = (info->height + 8 * info->vmax - 1) / (8 * info->vmax);
+    int b = 0;
+    for (int c = 0; c < info->ncomp; c++) {
+      for (int i = 0; i < info->comp_h[c] * info->comp_v[c]; i++) {
+        if (b >= JPEG_MCU_MAX_BLOCKS) {
+          return false;
+        }
+        info->block_comp[b++] = c;
+      }
+    }
+    info->blocks_per_mcu = b;
+  }
+  info->mcu_count = (uint32_t)info->mcus_x * info->mcus_y;
+  return true;
+}
+
+bool jpeg_parse_header(const uint8_t *buf, size_t len, jpeg_info_t *info) {
+  memset(info, 0, sizeof(jpeg_info_t));
+  if (len < 4 || buf[0] != 0xFF || buf[1] != 0xD8) {
+    return false;
+  }
+  size_t pos = 2;
+  while (pos + 4 <= len) {
+    if (buf[pos] != 0xFF) {
+      return false;
+    }
+    uint8_t m = buf[pos + 1];
+    if (m == 0xFF) {
+      pos++;
+      continue;
+    }
+    size_t seglen = read_be16(buf + pos + 2);
+    if (seglen < 2 || pos + 2 + seglen > len) {
+      return false;
+    }
+    const uint8_t *seg = buf + pos + 4;
+    size_t n = seglen - 2;
+    bool ok = true;
+    switch (m) {
+      case 0xC0:
+      case 0xC1: ok = parse_sof(info, seg, n); break;
+      case 0xC4: ok = parse_dht(info, seg, n); break;
+      case 0xDB: ok = parse_dqt(info, seg, n); break;
+      case 0xDD:
+        ok = n >= 2;
+        if (ok) {
+          info->restart_interval = read_be16(seg);
+          info->dri_offset = pos;
+        }
+        break;
+      case 0xDA:
+        if (!parse_sos(info, seg, n) || !compute_geometry(info)) {
+          return false;
+        }
+        info->header_len = pos + 2 + seglen;
+        info->scan = buf + info->header_len;
+        info->scan_len = len - info->header_len;
+        return true;
+      default:
+        // SOF progressivo, aritmético ou hierárquico não são suportados
+        if ((m >= 0xC2 && m <= 0xCF && m != 0xC4 && m != 0xC8 && m != 0xCC)) {
+          return false;
+        }
+        break;
+    }
+    if (!ok) {
+      return false;
+    }
+    pos += 2 + seglen;
+  }
+  return false;
+}
+
+static inline void bits_fill(jpeg_bit_reader_t *br) {
+  while (br->nbits <= 24) {
+    uint32_t b = 0;
+    if (!br->marker && br->p < br->end) {
+      b = *br->p;
+      if (b == 0xFF) {
+        uint8_t next = (br->p + 1 < br->end) ? br->p[1] : 0xD9;
+        if (next == 0x00) {
+          br->p += 2;
+        } else {
+          // Marcador (RST/EOI): a partir daqui o leitor alimenta zeros
+          br->marker = true;
+          b = 0;
+        }
+      } else {
+        br->p++;
+      }
+    }
+    br->acc |= b << (24 - br->nbits);
+    br->nbits += 8;
+  }
+}
+
+static inline uint32_t bits_get(jpeg_bit_reader_t *br, int n) {
+  if (!n) {
+    return 0;
+  }
+  bits_fill(br);
+  uint32_t v = br->acc >> (32 - n);
+  br->acc <<= n;
+  br->nbits -= n;
+  return v;
+}
+
+static inline int huff_decode(jpeg_bit_reader_t *br, const jpeg_huff_table_t *t, uint32_t *code, int *len) {
+  bits_fill(br);
+  uint32_t look = br->acc >> (32 - JPEG_HUFF_LOOKAHEAD);
+  uint16_t e = t->lookup[look];
+  if (e) {
+    int l = e >> 8;
+    *code = look >> (JPEG_HUFF_LOOKAHEAD - l);
+    *len = l;
+    br->acc <<= l;
+    br->nbits -= l;
+    return e & 0xFF;
+  }
+  uint32_t peek = br->acc >> 16;
+  for (int l = JPEG_HUFF_LOOKAHEAD + 1; l <= 16; l++) {
+    int32_t c = peek >> (16 - l);
+    if (c <= t->maxcode[l]) {
+      *code = c;
+      *len = l;
+      br->acc <<= l;
+      br->nbits -= l;
+      return t->huffval[t->valptr[l] + c - t->mincode[l]];
+    }
+  }
+  return -1;
+}
+
+static inline int extend(uint32_t v, int s) {
+  return (s && v < (1u << (s - 1))) ? (int)v - (1 << s) + 1 : (int)v;
+}
+
+static void bits_restart(jpeg_bit_reader_t *br) {
+  // Descarta o padding e procura o marcador RSTn seguinte
+  const uint8_t *p = br->p;
+  while (p + 1 < br->end && !(p[0] == 0xFF && p[1] >= 0xD0 && p[1] <= 0xD7)) {
+    p++;
+  }
+  br->p = (p + 1 < br->end) ? p + 2 : br->end;
+  br->acc = 0;
+  br->nbits = 0;
+  br->marker = false;
+}
+
+void jpeg_scan_begin(jpeg_scan_t *scan, const jpeg_info_t *info) {
+  memset(scan, 0, sizeof(jpeg_scan_t));
+  scan->info = info;
+  scan->br.p = info->scan;
+  scan->br.end = info->scan + info->scan_len;
+  scan->until_restart = info->restart_interval;
+}
+
+static inline size_t writer_bits(const jpeg_bit_writer_t *w) {
+  return w->pos * 8 + w->nbits;
+}
+
+bool jpeg_scan_mcu(jpeg_scan_t *scan, jpeg_block_t *blocks, jpeg_bit_writer_t *ac_out) {
+  const jpeg_info_t *info = scan->info;
+  jpeg_bit_reader_t *br = &scan->br;
+
+  if (scan->mcu >= info->mcu_count) {
+    return false;
+  }
+  if (info->restart_interval) {
+    if (!scan->until_restart) {
+      bits_restart(br);
+      memset(scan->pred, 0, sizeof(scan->pred));
+      scan->until_restart = info->restart_interval;
+    }
+    scan->until_restart--;
+  }
+
+  for (int b = 0; b < info->blocks_per_mcu; b++) {
+    int c = info->block_comp[b];
+    const jpeg_huff_table_t *dct = &info->dc[info->comp_td[c]];
+    const jpeg_huff_table_t *act = &info->ac[info->comp_ta[c]];
+    uint32_t code;
+    int len;
+
+    int s = huff_decode(br, dct, &code, &len);
+    if (s < 0 || s > 11) {
+      return false;
+    }
+    scan->pred[c] += extend(bits_get(br, s), s);
+    blocks[b].dc = scan->pred[c];
+
+    size_t start = writer_bits(ac_out);
+    int k = 1;
+    while (k < 64) {
+      int rs = huff_decode(br, act, &code, &len);
+      if (rs < 0) {
+        return false;
+      }
+      jpeg_bit_writer_put(ac_out, code, len);
+      int r = rs >> 4;
+      s = rs & 0x0F;
+      if (!s) {
+        if (r != 15) {
+          break;  // EOB
+        }
+        k += 16;
+        continue;
+      }
+      k += r;
+      jpeg_bit_writer_put(ac_out, bits_get(br, s), s);
+      k++;
+    }
+    if (k > 64 || ac_out->error) {
+      return false;
+    }
+    blocks[b].ac_bits = writer_bits(ac_out) - start;
+  }
+  scan->mcu++;
+  return true;
+}
+
+void jpeg_bit_writer_init(jpeg_bit_writer_t *w, uint8_t *buf, size_t cap, bool stuff) {
+  w->buf = buf;
+  w->cap = cap;
+  w->pos = 0;
+  w->acc = 0;
+  w->nbits = 0;
+  w->stuff = stuff;
+  w->error = false;
+}
+
+static inline void writer_emit(jpeg_bit_writer_t *w, uint8_t byte) {
+  if (w->pos >= w->cap) {
+    w->error = true;
+    return;
+  }
+  w->buf[w->pos++] = byte;
+  if (w->stuff && byte == 0xFF) {
+    writer_emit(w, 0x00);
+  }
+}
+
+void jpeg_bit_writer_put(jpeg_bit_writer_t *w, uint32_t value, int nbits) {
+  if (nbits <= 0) {
+    return;
+  }
+  w->acc = (w->acc << nbits) | (value & ((1u << nbits) - 1));
+  w->nbits += nbits;
+  while (w->nbits >= 8) {
+    w->nbits -= 8;
+    writer_emit(w, (uint8_t)(w->acc >> w->nbits));
+  }
+  w->acc &= (1u << w->nbits) - 1;
+}
+
+size_t jpeg_bit_writer_flush(jpeg_bit_writer_t *w) {
+  if (w->nbits) {
+    int pad = 8 - w->nbits;
+    jpeg_bit_writer_put(w, (1u << pad) - 1, pad);
+  }
+  return w->pos;
+}
+
+void jpeg_encode_dc(jpeg_bit_writer_t *w, const jpeg_huff_table_t *tbl, int diff) {
+  int t = diff < 0 ? -diff : diff;
+  int s = 0;
+  while (t) {
+    s++;
+    t >>= 1;
+  }
+  if (s > 11 || !tbl->ehufsi[s]) {
+    w->error = true;
+    return;
+  }
+  jpeg_bit_writer_put(w, tbl->ehufco[s], tbl->ehufsi[s]);
+  if (s) {
+    jpeg_bit_writer_put(w, diff < 0 ? diff - 1 : diff, s);
+  }
+}
@@ -0,0 +1,103 @@
+#ifndef JPEG_MCU_H
+#define JPEG_MCU_H
+
+// Leitura de JPEG baseline no nível de MCU (sem decodificar pixels).
+// Código portável: não depende do Arduino nem do ESP-IDF, para poder ser
+// compilado também pelas ferramentas de host em tools/.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define JPEG_MCU_MAX_COMPONENTS 3
+#define JPEG_MCU_MAX_BLOCKS     10
+#define JPEG_HUFF_LOOKAHEAD     9
+
+typedef struct {
+  uint8_t bits[17];       // bits[l] = quantidade de códigos com l bits
+  uint8_t huffval[256];
+  int32_t maxcode[18];
+  int32_t valptr[17];
+  int32_t mincode[17];
+  uint16_t lookup[1 << JPEG_HUFF_LOOKAHEAD];  // (tamanho << 8) | símbolo, 0 = código longo
+  uint16_t ehufco[256];   // tabela inversa para codificação
+  uint8_t ehufsi[256];
+  bool present;
+} jpeg_huff_table_t;
+
+typedef struct {
+  uint16_t width;
+  uint16_t height;
+  uint8_t ncomp;
+  uint8_t comp_id[JPEG_MCU_MAX_COMPONENTS];
+  uint8_t comp_h[JPEG_MCU_MAX_COMPONENTS];
+  uint8_t comp_v[JPEG_MCU_MAX_COMPONENTS];
+  uint8_t comp_tq[JPEG_MCU_MAX_COMPONENTS];
+  uint8_t comp_td[JPEG_MCU_MAX_COMPONENTS];
+  uint8_t comp_ta[JPEG_MCU_MAX_COMPONENTS];
+  uint8_t hmax;
+  uint8_t vmax;
+  uint16_t mcus_x;
+  uint16_t mcus_y;
+  uint32_t mcu_count;
+  uint8_t blocks_per_mcu;
+  uint8_t block_comp[JPEG_MCU_MAX_BLOCKS];  // componente de cada bloco dentro da MCU
+  uint16_t restart_interval;
+  uint8_t qt[4][64];      // tabelas de quantização em ordem zig-zag (8 bits)
+  uint8_t qt_present;     // bitmask das tabelas encontradas
+  jpeg_huff_table_t dc[2];
+  jpeg_huff_table_t ac[2];
+  size_t header_len;      // bytes do SOI até o início dos dados entrópicos
+  size_t dri_offset;      // posição do segmento DRI (0 = ausente)
+  const uint8_t *scan;
+  size_t scan_len;
+} jpeg_info_t;
+
+typedef struct {
+  const uint8_t *p;
+  const uint8_t *end;
+  uint32_t acc;
+  int nbits;
+  bool marker;
+} jpeg_bit_reader_t;
+
+typedef struct {
+  uint8_t *buf;
+  size_t cap;
+  size_t pos;
+  uint32_t acc;
+  int nbits;
+  bool stuff;             // insere 0x00 após 0xFF (fluxo JPEG)
+  bool error;             // sem espaço no buffer ou símbolo fora da tabela
+} jpeg_bit_writer_t;
+
+typedef struct {
+  int16_t dc;             // valor absoluto do coeficiente DC
+  uint16_t ac_bits;       // bits entrópicos dos coeficientes AC
+} jpeg_block_t;
+
+typedef struct {
+  const jpeg_info_t *info;
+  jpeg_bit_reader_t br;
+  int16_t pred[JPEG_MCU_MAX_COMPONENTS];
+  uint32_t mcu;
+  uint16_t until_restart;
+} jpeg_scan_t;
+
+// Analisa os segmentos até o SOS. Retorna false para JPEG progressivo,
+// 12 bits, não entrelaçado com mais de um componente ou tabelas inválidas.
+bool jpeg_parse_header(const uint8_t *buf, size_t len, jpeg_info_t *info);
+
+void jpeg_scan_begin(jpeg_scan_t *scan, const jpeg_info_t *info);
+// Decodifica a próxima MCU: preenche blocks[] e copia os bits AC (sem
+// byte stuffing) para ac_out. Retorna false em dados corrompidos.
+bool jpeg_scan_mcu(jpeg_scan_t *scan, jpeg_block_t *blocks, jpeg_bit_writer_t *ac_out);
+
+void jpeg_bit_writer_init(jpeg_bit_writer_t *w, uint8_t *buf, size_t cap, bool stuff);
+void jpeg_bit_writer_put(jpeg_bit_writer_t *w, uint32_t value, int nbits);
+// Completa o último byte com bits 1 (padding do JPEG) e retorna o total de bytes.
+size_t jpeg_bit_writer_flush(jpeg_bit_writer_t *w);
+
+// Codifica a diferença de DC com a tabela informada (categoria + bits extras).
+void jpeg_encode_dc(jpeg_bit_writer_t *w, const jpeg_huff_table_t *tbl, int diff);
+
+#endif
@@ -0,0 +1,230 @@
+#include "metrics.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define METRICS_MAX_BUCKETS 12
+
+typedef struct {
+  const char *name;
+  const char *help;
+  bool seconds;                        // valores em µs, exportados em segundos
+  uint32_t bounds[METRICS_MAX_BUCKETS];  // limites superiores crescentes; 0 encerra
+} hist_def_t;
+
+static const hist_def_t hist_defs[METRIC_HIST_COUNT] = {
+  {"camera_capture_wait_seconds", "Time blocked in esp_camera_fb_get", true,
+   {1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000, 500000, 1000000}},
+  {"camera_encode_seconds", "Time copying or converting a frame to JPEG", true,
+   {100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000}},
+  {"camera_send_seconds", "Time sending one frame to a client", true,
+   {1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000}},
+  {"camera_frame_interval_seconds", "Interval between frames sent on a stream", true,
+   {10000, 20000, 33000, 50000, 66000, 100000, 200000, 500000, 1000000, 2000000}},
+  {"camera_frame_size_bytes", "Size of the frames sent", false,
+   {4096, 8192, 16384, 32768, 65536, 131072, 262144, 524288}},
+  {"camera_wifi_connect_seconds", "Time from a WiFi connection attempt to an IP address", true,
+   {100000, 250000, 500000, 1000000, 2000000, 3000000, 5000000, 10000000, 20000000}},
+  {"camera_wifi_first_frame_seconds", "Time from the successful WiFi connection attempt to the next frame sent", true,
+   {250000, 500000, 1000000, 2000000, 3000000, 5000000, 10000000, 20000000}},
+};
+
+static const char *drop_reasons[METRIC_DROP_COUNT] = {"capture", "encode", "send", "static", "link", "stale"};
+
+typedef struct {
+  uint32_t buckets[METRICS_MAX_BUCKETS + 1];  // não cumulativos; o último é +Inf
+  uint32_t count;
+  uint64_t sum;
+} hist_t;
+
+typedef struct {
+  bool active;
+  char endpoint[12];
+  char peer[48];
+  uint64_t bytes;
+  uint32_t frames;
+} client_t;
+
+static hist_t hists[METRIC_HIST_COUNT];
+static uint32_t drops[METRIC_DROP_COUNT];
+static client_t clients[METRICS_MAX_CLIENTS];
+static uint64_t bytes_total;
+static uint32_t clients_total;
+static int64_t wifi_attempt_us;
+static int64_t wifi_frame_pending_us;  // início da tentativa bem-sucedida; 0 sem medida aberta
+static uint32_t wifi_connects[2];      // [0] com varredura, [1] direta
+static uint32_t lines_dropped;         // linhas longas sem memória para formatar
+
+void metrics_observe(metrics_hist_t id, uint32_t value) {
+  const uint32_t *bounds = hist_defs[id].bounds;
+  int b = 0;
+  while (b < METRICS_MAX_BUCKETS && bounds[b] && value > bounds[b]) {
+    b++;
+  }
+  if (b < METRICS_MAX_BUCKETS && !bounds[b]) {
+    b = METRICS_MAX_BUCKETS;
+  }
+  hist_t *h = &hists[id];
+  __atomic_fetch_add(&h->buckets[b], 1, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&h->count, 1, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&h->sum, (uint64_t)value, __ATOMIC_RELAXED);
+}
+
+void metrics_drop(metrics_drop_t reason) {
+  __atomic_fetch_add(&drops[reason], 1, __ATOMIC_RELAXED);
+}
+
+int metrics_client_open(const char *endpoint, const char *peer) {
+  __atomic_fetch_add(&clients_total, 1, __ATOMIC_RELAXED);
+  for (int i = 0; i < METRICS_MAX_CLIENTS; i++) {
+    bool expected = false;
+    if (__atomic_compare_exchange_n(&clients[i].active, &expected, true, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+      client_t *c = &clients[i];
+      snprintf(c->endpoint, sizeof(c->endpoint), "%s", endpoint);
+      snprintf(c->peer, sizeof(c->peer), "%s", peer);
+      c->bytes = 0;
+      c->frames = 0;
+      return i;
+    }
+  }
+  return -1;
+}
+
+void metrics_client_sent(int slot, uint32_t bytes) {
+  __atomic_fetch_add(&bytes_total, (uint64_t)bytes, __ATOMIC_RELAXED);
+  if (slot >= 0) {
+    // Cada slot só é escrito pela tarefa dona da conexão
+    clients[slot].bytes += bytes;
+    clients[slot].frames++;
+  }
+}
+
+void metrics_client_close(int slot) {
+  if (slot >= 0) {
+    __atomic_store_n(&clients[slot].active, false, __ATOMIC_RELEASE);
+  }
+}
+
+void metrics_wifi_attempt(int64_t now_us) {
+  __atomic_store_n(&wifi_attempt_us, now_us, __ATOMIC_RELAXED);
+}
+
+void metrics_wifi_connected(int64_t now_us, bool direct) {
+  int64_t started = __atomic_load_n(&wifi_attempt_us, __ATOMIC_RELAXED);
+  metrics_observe(METRIC_WIFI_CONNECT, (uint32_t)(now_us - started));
+  __atomic_fetch_add(&wifi_connects[direct ? 1 : 0], 1, __ATOMIC_RELAXED);
+  __atomic_store_n(&wifi_frame_pending_us, started, __ATOMIC_RELEASE);
+}
+
+void metrics_wifi_frame(int64_t now_us) {
+  if (!__atomic_load_n(&wifi_frame_pending_us, __ATOMIC_RELAXED)) {
+    return;
+  }
+  int64_t started = __atomic_exchange_n(&wifi_frame_pending_us, 0, __ATOMIC_ACQ_REL);
+  if (started) {
+    metrics_observe(METRIC_WIFI_FIRST_FRAME, (uint32_t)(now_us - started));
+  }
+}
+
+// Linha que não cabe no buffer da pilha (HELP longo, rótulos grandes) é
+// formatada de novo no heap: cortar a linha quebraria a coleta inteira
+__attribute__((format(printf, 3, 4)))
+static void emit(metrics_write_fn write, void *ctx, const char *fmt, ...) {
+  char line[160];
+  va_list args, again;
+  va_start(args, fmt);
+  va_copy(again, args);
+  int n = vsnprintf(line, sizeof(line), fmt, args);
+  va_end(args);
+  if (n > 0 && (size_t)n < sizeof(line)) {
+    write(ctx, line, n);
+  } else if (n > 0) {
+    char *big = (char *)malloc(n + 1);
+    if (big) {
+      vsnprintf(big, n + 1, fmt, again);
+      write(ctx, big, n);
+      free(big);
+    } else {
+      // Sem memória: a linha inteira fica de fora, nunca pela metade
+      __atomic_fetch_add(&lines_dropped, 1, __ATOMIC_RELAXED);
+    }
+  }
+  va_end(again);
+}
+
+static void render_hist(metrics_write_fn write, void *ctx, metrics_hist_t id) {
+  const hist_def_t *def = &hist_defs[id];
+  const hist_t *h = &hists[id];
+  double scale = def->seconds ? 1e-6 : 1.0;
+  uint32_t cumulative = 0;
+
+  emit(write, ctx, "# HELP %s %s\n", def->name, def->help);
+  emit(write, ctx, "# TYPE %s histogram\n", def->name);
+  for (int b = 0; b < METRICS_MAX_BUCKETS && def->bounds[b]; b++) {
+    cumulative += __atomic_load_n(&h->buckets[b], __ATOMIC_RELAXED);
+    emit(write, ctx, "%s_bucket{le=\"%g\"} %u\n", def->name, def->bounds[b] * scale, (unsigned)cumulative);
+  }
+  cumulative += __atomic_load_n(&h->buckets[METRICS_MAX_BUCKETS], __ATOMIC_RELAXED);
+  emit(write, ctx, "%s_bucket{le=\"+Inf\"} %u\n", def->name, (unsigned)cumulative);
+  emit(write, ctx, "%s_sum %.6f\n", def->name, (double)__atomic_load_n(&h->sum, __ATOMIC_RELAXED) * scale);
+  // count igual ao bucket +Inf, mesmo com observações chegando durante a coleta
+  emit(write, ctx, "%s_count %u\n", def->name, (unsigned)cumulative);
+}
+
+// Valores inteiros saem exatos (%.6g arredondaria contagens acima de 10^6)
+static void render_values(metrics_write_fn write, void *ctx, const metrics_gauge_t *values, size_t count, const char *type) {
+  for (size_t i = 0; i < count; i++) {
+    const metrics_gauge_t *v = &values[i];
+    emit(write, ctx, "# HELP %s %s\n", v->name, v->help);
+    emit(write, ctx, "# TYPE %s %s\n", v->name, type);
+    if (v->value > -9e15 && v->value < 9e15 && v->value == (double)(int64_t)v->value) {
+      emit(write, ctx, "%s %lld\n", v->name, (long long)v->value);
+    } else {
+      emit(write, ctx, "%s %.9g\n", v->name, v->value);
+    }
+  }
+}
+
+void metrics_render(metrics_write_fn write, void *ctx, const metrics_gauge_t *gauges, size_t gauge_count, const metrics_gauge_t *counters,
+                    size_t counter_count) {
+  for (int id = 0; id < METRIC_HIST_COUNT; id++) {
+    render_hist(write, ctx, (metrics_hist_t)id);
+  }
+
+  emit(write, ctx, "# HELP camera_frames_dropped_total Frames captured but not sent\n# TYPE camera_frames_dropped_total counter\n");
+  for (int r = 0; r < METRIC_DROP_COUNT; r++) {
+    emit(write, ctx, "camera_frames_dropped_total{reason=\"%s\"} %u\n", drop_reasons[r], (unsigned)__atomic_load_n(&drops[r], __ATOMIC_RELAXED));
+  }
+
+  emit(write, ctx, "# HELP camera_stream_sent_bytes_total Bytes sent on all streams\n# TYPE camera_stream_sent_bytes_total counter\n");
+  emit(write, ctx, "camera_stream_sent_bytes_total %llu\n", (unsigned long long)__atomic_load_n(&bytes_total, __ATOMIC_RELAXED));
+  emit(write, ctx, "# HELP camera_stream_clients_total Stream connections accepted\n# TYPE camera_stream_clients_total counter\n");
+  emit(write, ctx, "camera_stream_clients_total %u\n", (unsigned)__atomic_load_n(&clients_total, __ATOMIC_RELAXED));
+
+  emit(write, ctx, "# HELP camera_wifi_connects_total WiFi connections by path\n# TYPE camera_wifi_connects_total counter\n");
+  emit(write, ctx, "camera_wifi_connects_total{path=\"scan\"} %u\n", (unsigned)__atomic_load_n(&wifi_connects[0], __ATOMIC_RELAXED));
+  emit(write, ctx, "camera_wifi_connects_total{path=\"direct\"} %u\n", (unsigned)__atomic_load_n(&wifi_connects[1], __ATOMIC_RELAXED));
+
+  emit(write, ctx, "# HELP camera_metrics_lines_dropped_total /metrics lines left out for lack of memory\n");
+  emit(write, ctx, "# TYPE camera_metrics_lines_dropped_total counter\n");
+  emit(write, ctx, "camera_metrics_lines_dropped_total %u\n", (unsigned)__atomic_load_n(&lines_dropped, __ATOMIC_RELAXED));
+
+  emit(write, ctx, "# HELP camera_client_sent_bytes Bytes sent to each connected stream client\n# TYPE camera_client_sent_bytes gauge\n");
+  for (int i = 0; i < METRICS_MAX_CLIENTS; i++) {
+    const client_t *c = &clients[i];
+    if (__atomic_load_n(&c->active, __ATOMIC_ACQUIRE)) {
+      emit(write, ctx, "camera_client_sent_bytes{endpoint=\"%s\",client=\"%s\"} %llu\n", c->endpoint, c->peer, (unsigned long long)c->bytes);
+    }
+  }
+  emit(write, ctx, "# HELP camera_client_sent_frames Frames sent to each connected stream client\n# TYPE camera_client_sent_frames gauge\n");
+  for (int i = 0; i < METRICS_MAX_CLIENTS; i++) {
+    const client_t *c = &clients[i];
+    if (__atomic_load_n(&c->active, __ATOMIC_ACQUIRE)) {
+      emit(write, ctx, "camera_client_sent_frames{endpoint=\"%s\",client=\"%s\"} %u\n", c->endpoint, c->peer, (unsigned)c->frames);
+    }
+  }
+
+  render_values(write, ctx, gauges, gauge_count, "gauge");
+  render_values(write, ctx, counters, counter_count, "counter");
+}
@@ -0,0 +1,65 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+// Contadores e histogramas de buckets fixos do pipeline de vídeo, exportados
+// no formato texto do Prometheus (/metrics). Toda a memória é estática: o
+// caminho de cada quadro só faz incrementos atômicos. Código portável.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define METRICS_MAX_CLIENTS 8
+
+typedef enum {
+  METRIC_CAPTURE_WAIT,    // espera em esp_camera_fb_get (µs)
+  METRIC_ENCODE,          // cópia/conversão para JPEG (µs)
+  METRIC_SEND,            // envio de um quadro completo (µs)
+  METRIC_FRAME_INTERVAL,  // intervalo entre quadros enviados (µs)
+  METRIC_FRAME_SIZE,      // tamanho do quadro enviado (bytes)
+  METRIC_WIFI_CONNECT,    // tentativa de conexão WiFi -> IP (µs)
+  METRIC_WIFI_FIRST_FRAME,  // tentativa bem-sucedida -> primeiro quadro enviado (µs)
+  METRIC_HIST_COUNT
+} metrics_hist_t;
+
+typedef enum {
+  METRIC_DROP_CAPTURE,    // falha de captura
+  METRIC_DROP_ENCODE,     // falha de conversão/alocação
+  METRIC_DROP_SEND,       // falha de envio (cliente caiu)
+  METRIC_DROP_STATIC,     // descartado pelo modo de cena estática
+  METRIC_DROP_LINK,       // enlace WiFi caído: capturado e descartado
+  METRIC_DROP_STALE,      // fila de uma sessão cheia: o quadro mais antigo dela
+  METRIC_DROP_COUNT
+} metrics_drop_t;
+
+typedef struct {
+  const char *name;
+  const char *help;
+  double value;
+} metrics_gauge_t;
+
+typedef void (*metrics_write_fn)(void *ctx, const char *data, size_t len);
+
+void metrics_observe(metrics_hist_t id, uint32_t value);
+void metrics_drop(metrics_drop_t reason);
+
+// Cliente de fluxo: retorna o slot ou -1 se a tabela estiver cheia (os bytes
+// continuam contando no total). endpoint e peer são copiados.
+int metrics_client_open(const char *endpoint, const char *peer);
+void metrics_client_sent(int slot, uint32_t bytes);
+void metrics_client_close(int slot);
+
+// Enlace WiFi: início de cada tentativa, IP obtido (conexão direta pelo
+// cache ou com varredura) e quadro enviado. O primeiro quadro depois de um
+// IP novo fecha a medida de METRIC_WIFI_FIRST_FRAME; os outros só custam
+// uma leitura atômica.
+void metrics_wifi_attempt(int64_t now_us);
+void metrics_wifi_connected(int64_t now_us, bool direct);
+void metrics_wifi_frame(int64_t now_us);
+
+// Escreve todas as métricas mais os gauges e contadores dados (lidos na hora
+// da coleta; os contadores só crescem e têm o nome terminado em _total)
+void metrics_render(metrics_write_fn write, void *ctx, const metrics_gauge_t *gauges, size_t gauge_count, const metrics_gauge_t *counters,
+                    size_t counter_count);
+
+#endif
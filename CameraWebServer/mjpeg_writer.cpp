@@ -0,0 +1,76 @@
+#include "mjpeg_writer.h"
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include "lwip/sockets.h"
+
+static mjpeg_writer_stats_t stats;
+
+// Escreve os pedaços inteiros, continuando de onde um envio parcial parou;
+// conta as chamadas em *writes
+static esp_err_t write_all(int fd, struct iovec *iov, int count, uint32_t *writes) {
+  while (count > 0) {
+    // Como o writev, com MSG_NOSIGNAL: um cliente que fechou não derruba o
+    // simulador de host com SIGPIPE (o lwip não tem sinais)
+    struct msghdr msg = {};
+    msg.msg_iov = iov;
+    msg.msg_iovlen = count;
+    ssize_t n = sendmsg(fd, &msg, MSG_NOSIGNAL);
+    (*writes)++;
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return ESP_FAIL;
+    }
+    __atomic_add_fetch(&stats.bytes, (uint64_t)n, __ATOMIC_RELAXED);
+    while (count > 0 && (size_t)n >= iov->iov_len) {
+      n -= iov->iov_len;
+      iov++;
+      count--;
+    }
+    if (count > 0) {
+      iov->iov_base = (char *)iov->iov_base + n;
+      iov->iov_len -= n;
+    }
+  }
+  return ESP_OK;
+}
+
+esp_err_t mjpeg_writer_begin(int fd, const char *content_type, const char *boundary) {
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+  char header[256];
+  int len = snprintf(header, sizeof(header),
+                     "HTTP/1.1 200 OK\r\n"
+                     "Content-Type: %s\r\n"
+                     "Access-Control-Allow-Origin: *\r\n"
+                     "X-Framerate: 60\r\n"
+                     "Cache-Control: no-store\r\n"
+                     "Connection: close\r\n\r\n",
+                     content_type);
+  if (len < 0 || len >= (int)sizeof(header)) {
+    return ESP_FAIL;
+  }
+  struct iovec iov[2] = {{header, (size_t)len}, {(void *)boundary, strlen(boundary)}};
+  uint32_t writes = 0;
+  return write_all(fd, iov, 2, &writes);
+}
+
+esp_err_t mjpeg_writer_part(int fd, const char *header, size_t header_len, const uint8_t *data, size_t len, const char *boundary) {
+  struct iovec iov[3] = {{(void *)header, header_len}, {(void *)data, len}, {(void *)boundary, strlen(boundary)}};
+  uint32_t writes = 0;
+  esp_err_t res = write_all(fd, iov, 3, &writes);
+  __atomic_add_fetch(&stats.writes, writes, __ATOMIC_RELAXED);
+  if (res == ESP_OK) {
+    __atomic_add_fetch(&stats.parts, 1, __ATOMIC_RELAXED);
+  }
+  return res;
+}
+
+void mjpeg_writer_get_stats(mjpeg_writer_stats_t *out) {
+  out->parts = __atomic_load_n(&stats.parts, __ATOMIC_RELAXED);
+  out->writes = __atomic_load_n(&stats.writes, __ATOMIC_RELAXED);
+  out->bytes = __atomic_load_n(&stats.bytes, __ATOMIC_RELAXED);
+}
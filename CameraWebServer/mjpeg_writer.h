@@ -0,0 +1,28 @@
+#ifndef MJPEG_WRITER_H
+#define MJPEG_WRITER_H
+
+// Resposta multipart escrita direto no socket da sessão, sem o chunked do
+// httpd: o cabeçalho HTTP sai uma vez e cada parte (cabeçalho da parte,
+// JPEG e fronteira) vai num único sendmsg. O lwip enche os segmentos até o
+// MSS com os três pedaços juntos; com o chunked eram três envios, cada um
+// com a linha do tamanho e o CRLF em segmentos próprios. Com TCP_NODELAY o
+// último segmento do quadro sai sem esperar o ACK do anterior (Nagle).
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+typedef struct {
+  uint32_t parts;
+  uint32_t writes;  // chamadas ao sendmsg das partes (mais de uma só com envio parcial)
+  uint64_t bytes;   // inclui os cabeçalhos das respostas
+} mjpeg_writer_stats_t;
+
+// Liga o TCP_NODELAY e envia o cabeçalho da resposta (Connection: close: a
+// resposta termina com o fechamento) e a primeira fronteira
+esp_err_t mjpeg_writer_begin(int fd, const char *content_type, const char *boundary);
+// Uma parte; ESP_FAIL com o cliente fora ou no timeout de envio do socket
+esp_err_t mjpeg_writer_part(int fd, const char *header, size_t header_len, const uint8_t *data, size_t len, const char *boundary);
+void mjpeg_writer_get_stats(mjpeg_writer_stats_t *stats);
+
+#endif
@@ -0,0 +1,641 @@
+#include "mqtt_client.h"
+#include <Preferences.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_timer.h"
+#include "esp_random.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "lwip/sockets.h"
+#include "lwip/netdb.h"
+#include "frame_hub.h"
+#include "esp32-hal-log.h"
+
+// Tipos de pacote (primeiro byte, já com os bits fixos)
+#define MQTT_CONNECT 0x10
+#define MQTT_CONNACK 0x20
+#define MQTT_PUBLISH 0x30
+#define MQTT_PUBACK 0x40
+#define MQTT_PINGREQ 0xC0
+#define MQTT_PINGRESP 0xD0
+#define MQTT_DISCONNECT 0xE0
+#define PUBLISH_DUP 0x08
+#define PUBLISH_QOS1 0x02
+#define PUBLISH_RETAIN 0x01
+
+#define POLL_MS 50           // espera pela fila entre uma olhada e outra no socket
+#define OUT_BUFFER 1460      // pacotes pequenos saem juntos, um segmento TCP
+#define SNAPSHOT_FRESH_MS 2000  // evento mais velho (guardado na queda) vai sem foto
+
+typedef struct {
+  uint32_t seq;
+  uint16_t packet_id;  // 0 = ainda não saiu nesta conexão
+  bool acked;
+  bool sent_before;    // saiu numa conexão anterior: vai de novo com DUP
+  bool snapshot;
+  int64_t queued_us;
+  char type[16];
+  char payload[MQTT_EVENT_MAX];
+} mqtt_event_t;
+
+static SemaphoreHandle_t lock = NULL;  // config e config_changed
+static QueueHandle_t inbox = NULL;
+static mqtt_config_t config;
+static bool config_changed = false;
+static bool enabled = false;
+static mqtt_status_fn status_fn = NULL;
+static mqtt_client_stats_t stats;
+static uint32_t next_seq = 0;
+static char client_id[24];
+
+// Só a tarefa mexe daqui para baixo
+static mqtt_event_t backlog[MQTT_BACKLOG];
+static int backlog_head = 0;
+static int backlog_count = 0;
+static uint16_t next_packet_id = 0;
+static uint8_t out[OUT_BUFFER];
+static size_t out_len = 0;
+static uint8_t in[64];
+static size_t in_len = 0;
+static size_t in_skip = 0;  // resto de um pacote grande demais, descartado
+
+static void count(uint32_t *counter, uint32_t n) {
+  __atomic_add_fetch(counter, n, __ATOMIC_RELAXED);
+}
+
+static void set_stat(uint32_t *field, uint32_t v) {
+  __atomic_store_n(field, v, __ATOMIC_RELAXED);
+}
+
+// ---- Configuração (NVS, tudo como texto, como grava o /mqtt) ----
+
+static void load_config(mqtt_config_t *c) {
+  memset(c, 0, sizeof(*c));
+  c->port = MQTT_DEFAULT_PORT;
+  strcpy(c->prefix, MQTT_DEFAULT_PREFIX);
+  c->heartbeat_s = MQTT_DEFAULT_HEARTBEAT_S;
+  Preferences prefs;
+  if (!prefs.begin(MQTT_NVS_NAMESPACE, true)) {
+    return;
+  }
+  snprintf(c->host, sizeof(c->host), "%s", prefs.getString("host").c_str());
+  snprintf(c->user, sizeof(c->user), "%s", prefs.getString("user").c_str());
+  snprintf(c->pass, sizeof(c->pass), "%s", prefs.getString("pass").c_str());
+  if (prefs.isKey("prefix")) {
+    snprintf(c->prefix, sizeof(c->prefix), "%s", prefs.getString("prefix").c_str());
+  }
+  if (prefs.isKey("port")) {
+    c->port = prefs.getString("port").toInt();
+  }
+  if (prefs.isKey("heartbeat")) {
+    c->heartbeat_s = prefs.getString("heartbeat").toInt();
+  }
+  c->snapshot = prefs.getString("snapshot").toInt() != 0;
+  prefs.end();
+}
+
+void mqtt_client_get_config(mqtt_config_t *out_config) {
+  if (!lock) {
+    load_config(out_config);
+    return;
+  }
+  xSemaphoreTake(lock, portMAX_DELAY);
+  *out_config = config;
+  xSemaphoreGive(lock);
+}
+
+bool mqtt_client_configure(const mqtt_config_t *c) {
+  if (!lock || !c->port || !c->prefix[0]) {
+    return false;
+  }
+  Preferences prefs;
+  if (!prefs.begin(MQTT_NVS_NAMESPACE, false)) {
+    return false;
+  }
+  char number[8];
+  bool ok = prefs.putString("host", c->host) == strlen(c->host) && prefs.putString("user", c->user) == strlen(c->user) &&
+            prefs.putString("pass", c->pass) == strlen(c->pass) && prefs.putString("prefix", c->prefix) == strlen(c->prefix);
+  snprintf(number, sizeof(number), "%u", c->port);
+  ok = ok && prefs.putString("port", number);
+  snprintf(number, sizeof(number), "%u", c->heartbeat_s);
+  ok = ok && prefs.putString("heartbeat", number);
+  ok = ok && prefs.putString("snapshot", c->snapshot ? "1" : "0");
+  prefs.end();
+
+  xSemaphoreTake(lock, portMAX_DELAY);
+  config = *c;
+  config_changed = true;
+  xSemaphoreGive(lock);
+  return ok;
+}
+
+// Configuração nova para a tarefa; false se nada mudou
+static bool take_config(mqtt_config_t *c) {
+  xSemaphoreTake(lock, portMAX_DELAY);
+  bool changed = config_changed;
+  if (changed) {
+    *c = config;
+    config_changed = false;
+  }
+  xSemaphoreGive(lock);
+  return changed;
+}
+
+// ---- Fila de eventos ----
+
+bool mqtt_client_event(const char *type, const char *fields, bool snapshot) {
+  if (!inbox || !__atomic_load_n(&enabled, __ATOMIC_RELAXED)) {
+    return false;
+  }
+  mqtt_event_t ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.seq = __atomic_add_fetch(&next_seq, 1, __ATOMIC_RELAXED);
+  ev.snapshot = snapshot;
+  ev.queued_us = esp_timer_get_time();
+  snprintf(ev.type, sizeof(ev.type), "%s", type);
+  size_t n = snprintf(ev.payload, sizeof(ev.payload), "{\"seq\":%u,\"type\":\"%s\"%s%s}", ev.seq, ev.type, fields[0] ? "," : "", fields);
+  if (n >= sizeof(ev.payload)) {
+    log_w("MQTT: %s event too long (%u bytes)", ev.type, (unsigned)n);
+    return false;
+  }
+  if (xQueueSend(inbox, &ev, 0) != pdTRUE) {
+    count(&stats.dropped, 1);
+    return false;
+  }
+  count(&stats.events, 1);
+  return true;
+}
+
+// Cheio, o mais antigo sai (mesmo em voo: o PUBACK dele é ignorado)
+static void backlog_push(const mqtt_event_t *ev) {
+  if (backlog_count == MQTT_BACKLOG) {
+    backlog_head = (backlog_head + 1) % MQTT_BACKLOG;
+    backlog_count--;
+    count(&stats.dropped, 1);
+  }
+  backlog[(backlog_head + backlog_count) % MQTT_BACKLOG] = *ev;
+  backlog_count++;
+}
+
+static void backlog_ack(uint16_t packet_id) {
+  for (int i = 0; i < backlog_count; i++) {
+    mqtt_event_t *ev = &backlog[(backlog_head + i) % MQTT_BACKLOG];
+    if (ev->packet_id == packet_id && !ev->acked) {
+      ev->acked = true;
+      count(&stats.published, 1);
+      break;
+    }
+  }
+  while (backlog_count && backlog[backlog_head].acked) {
+    backlog_head = (backlog_head + 1) % MQTT_BACKLOG;
+    backlog_count--;
+  }
+}
+
+// ---- Pacotes ----
+
+static uint8_t *put_u16(uint8_t *p, uint16_t v) {
+  *p++ = v >> 8;
+  *p++ = v & 0xFF;
+  return p;
+}
+
+static uint8_t *put_str(uint8_t *p, const char *s) {
+  size_t n = strlen(s);
+  p = put_u16(p, n);
+  memcpy(p, s, n);
+  return p + n;
+}
+
+// Cabeçalho fixo: tipo e o comprimento restante em até 4 bytes de 7 bits
+static uint8_t *put_header(uint8_t *p, uint8_t type, size_t remaining) {
+  *p++ = type;
+  do {
+    uint8_t b = remaining & 0x7F;
+    remaining >>= 7;
+    *p++ = remaining ? b | 0x80 : b;
+  } while (remaining);
+  return p;
+}
+
+static bool send_all(int fd, const uint8_t *data, size_t len) {
+  while (len) {
+    ssize_t n = send(fd, data, len, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return false;
+    }
+    data += n;
+    len -= n;
+  }
+  return true;
+}
+
+static bool flush_out(int fd) {
+  bool ok = send_all(fd, out, out_len);
+  out_len = 0;
+  return ok;
+}
+
+// PUBLISH no buffer de saída (que só sai no flush_out); corpos maiores que o
+// buffer vão direto, depois do que já estava nele
+static bool send_publish(int fd, uint8_t flags, const char *topic, uint16_t packet_id, const void *payload, size_t len) {
+  uint8_t head[8 + 2 + sizeof(config.prefix) + 32];
+  size_t topic_len = strlen(topic);
+  size_t remaining = 2 + topic_len + (flags & PUBLISH_QOS1 ? 2 : 0) + len;
+  uint8_t *p = put_header(head, MQTT_PUBLISH | flags, remaining);
+  p = put_str(p, topic);
+  if (flags & PUBLISH_QOS1) {
+    p = put_u16(p, packet_id);
+  }
+  size_t head_len = p - head;
+  if (out_len + head_len + len > sizeof(out) && !flush_out(fd)) {
+    return false;
+  }
+  if (head_len + len > sizeof(out)) {
+    return send_all(fd, head, head_len) && send_all(fd, (const uint8_t *)payload, len);
+  }
+  memcpy(out + out_len, head, head_len);
+  memcpy(out + out_len + head_len, payload, len);
+  out_len += head_len + len;
+  return true;
+}
+
+static bool send_small(int fd, uint8_t type) {
+  uint8_t packet[2] = {type, 0};
+  if (out_len + 2 > sizeof(out) && !flush_out(fd)) {
+    return false;
+  }
+  memcpy(out + out_len, packet, 2);
+  out_len += 2;
+  return true;
+}
+
+static void topic_of(char *topic, size_t cap, const mqtt_config_t *c, const char *suffix) {
+  snprintf(topic, cap, "%s/%s", c->prefix, suffix);
+}
+
+static bool recv_exact(int fd, uint8_t *buf, size_t len) {
+  while (len) {
+    ssize_t n = recv(fd, buf, len, 0);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return false;
+    }
+    buf += n;
+    len -= n;
+  }
+  return true;
+}
+
+// Conexão TCP com prazo (o connect bloqueante do lwip espera bem mais)
+static int connect_to(const mqtt_config_t *c) {
+  struct addrinfo hints, *res = NULL;
+  char port[8];
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  snprintf(port, sizeof(port), "%u", c->port);
+  if (getaddrinfo(c->host, port, &hints, &res) != 0 || !res) {
+    log_w("MQTT: cannot resolve %s", c->host);
+    return -1;
+  }
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (fd < 0) {
+    freeaddrinfo(res);
+    return -1;
+  }
+  int flags = fcntl(fd, F_GETFL, 0);
+  fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+  int rc = connect(fd, res->ai_addr, res->ai_addrlen);
+  freeaddrinfo(res);
+  if (rc < 0 && errno == EINPROGRESS) {
+    fd_set wfds;
+    FD_ZERO(&wfds);
+    FD_SET(fd, &wfds);
+    struct timeval tv = {MQTT_IO_TIMEOUT_MS / 1000, (MQTT_IO_TIMEOUT_MS % 1000) * 1000};
+    int err = 0;
+    socklen_t err_len = sizeof(err);
+    rc = select(fd + 1, NULL, &wfds, NULL, &tv) == 1 && getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &err_len) == 0 && !err ? 0 : -1;
+  }
+  if (rc < 0) {
+    close(fd);
+    return -1;
+  }
+  fcntl(fd, F_SETFL, flags);
+  struct timeval tv = {MQTT_IO_TIMEOUT_MS / 1000, (MQTT_IO_TIMEOUT_MS % 1000) * 1000};
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  return fd;
+}
+
+// CONNECT com sessão limpa e o testamento "offline" retido; de volta, o
+// CONNACK e o "online" no lugar dele
+static int open_session(const mqtt_config_t *c) {
+  int fd = connect_to(c);
+  if (fd < 0) {
+    return -1;
+  }
+  char will_topic[sizeof(c->prefix) + 16];
+  topic_of(will_topic, sizeof(will_topic), c, "availability");
+  bool user = c->user[0], pass = user && c->pass[0];
+  size_t remaining = 10 + 2 + strlen(client_id) + 2 + strlen(will_topic) + 2 + 7 + (user ? 2 + strlen(c->user) : 0) + (pass ? 2 + strlen(c->pass) : 0);
+  uint8_t packet[16 + 2 + sizeof(client_id) + sizeof(will_topic) + 9 + sizeof(c->user) + sizeof(c->pass)];
+  uint8_t *p = put_header(packet, MQTT_CONNECT, remaining);
+  p = put_str(p, "MQTT");
+  *p++ = 4;  // 3.1.1
+  // sessão limpa, testamento com QoS 1 e retido, usuário e senha se houver
+  *p++ = 0x02 | 0x04 | 0x08 | 0x20 | (user ? 0x80 : 0) | (pass ? 0x40 : 0);
+  p = put_u16(p, MQTT_KEEPALIVE_S);
+  p = put_str(p, client_id);
+  p = put_str(p, will_topic);
+  p = put_str(p, "offline");
+  if (user) {
+    p = put_str(p, c->user);
+  }
+  if (pass) {
+    p = put_str(p, c->pass);
+  }
+  uint8_t ack[4];
+  if (!send_all(fd, packet, p - packet) || !recv_exact(fd, ack, sizeof(ack)) || ack[0] != MQTT_CONNACK || ack[1] != 2) {
+    log_w("MQTT: no CONNACK from %s:%u", c->host, c->port);
+    close(fd);
+    return -1;
+  }
+  if (ack[3]) {
+    // 4 e 5: usuário/senha errados ou sem permissão
+    log_w("MQTT: %s:%u refused the connection (code %u)", c->host, c->port, ack[3]);
+    close(fd);
+    return -1;
+  }
+  out_len = 0;
+  in_len = 0;
+  in_skip = 0;
+  if (!send_publish(fd, PUBLISH_RETAIN, will_topic, 0, "online", 6) || !flush_out(fd)) {
+    close(fd);
+    return -1;
+  }
+  log_i("MQTT: connected to %s:%u as %s", c->host, c->port, client_id);
+  return fd;
+}
+
+// Tudo o que ainda não saiu nesta conexão, junto no buffer de saída
+static bool send_backlog(int fd, const mqtt_config_t *c, bool *want_snapshot) {
+  char topic[sizeof(c->prefix) + 8 + sizeof(backlog[0].type)];
+  int64_t now = esp_timer_get_time();
+  for (int i = 0; i < backlog_count; i++) {
+    mqtt_event_t *ev = &backlog[(backlog_head + i) % MQTT_BACKLOG];
+    if (ev->packet_id || ev->acked) {
+      continue;
+    }
+    if (!++next_packet_id) {
+      next_packet_id = 1;
+    }
+    ev->packet_id = next_packet_id;
+    snprintf(topic, sizeof(topic), "%s/event/%s", c->prefix, ev->type);
+    if (!send_publish(fd, PUBLISH_QOS1 | (ev->sent_before ? PUBLISH_DUP : 0), topic, ev->packet_id, ev->payload, strlen(ev->payload))) {
+      return false;
+    }
+    if (ev->sent_before) {
+      count(&stats.resent, 1);
+    }
+    ev->sent_before = true;
+    *want_snapshot = *want_snapshot || (ev->snapshot && now - ev->queued_us < SNAPSHOT_FRESH_MS * 1000LL);
+  }
+  return true;
+}
+
+// Lê o que chegou sem esperar: PUBACK, PINGRESP (o resto é ignorado);
+// false com a conexão caída
+static bool receive(int fd, int64_t *last_rx_us) {
+  for (;;) {
+    ssize_t n = recv(fd, in + in_len, sizeof(in) - in_len, MSG_DONTWAIT);
+    if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+      return false;
+    }
+    if (n < 0) {
+      return true;
+    }
+    *last_rx_us = esp_timer_get_time();
+    in_len += n;
+    if (in_skip) {
+      size_t k = in_skip < in_len ? in_skip : in_len;
+      memmove(in, in + k, in_len - k);
+      in_len -= k;
+      in_skip -= k;
+    }
+    for (;;) {
+      size_t remaining = 0, pos = 1;
+      int shift = 0;
+      bool complete = false;
+      while (pos < in_len && pos <= 4) {
+        remaining |= (size_t)(in[pos] & 0x7F) << shift;
+        shift += 7;
+        if (!(in[pos++] & 0x80)) {
+          complete = true;
+          break;
+        }
+      }
+      if (!complete) {
+        break;
+      }
+      size_t total = pos + remaining;
+      if (total > sizeof(in)) {
+        in_skip = total - in_len;
+        in_len = 0;
+        break;
+      }
+      if (in_len < total) {
+        break;
+      }
+      if ((in[0] & 0xF0) == MQTT_PUBACK && remaining == 2) {
+        backlog_ack(in[pos] << 8 | in[pos + 1]);
+      }
+      memmove(in, in + total, in_len - total);
+      in_len -= total;
+    }
+  }
+}
+
+static bool send_heartbeat(int fd, const mqtt_config_t *c) {
+  char topic[sizeof(c->prefix) + 8];
+  char json[384];
+  int64_t now = esp_timer_get_time();
+  int n = snprintf(json, sizeof(json), "{\"uptime_s\":%u,\"backlog\":%u,\"dropped\":%u,\"events\":%u", (uint32_t)(now / 1000000),
+                   (uint32_t)backlog_count, __atomic_load_n(&stats.dropped, __ATOMIC_RELAXED), __atomic_load_n(&stats.events, __ATOMIC_RELAXED));
+  if (status_fn) {
+    n += status_fn(json + n, sizeof(json) - n - 1);
+  }
+  json[n++] = '}';
+  topic_of(topic, sizeof(topic), c, "status");
+  count(&stats.heartbeats, 1);
+  return send_publish(fd, 0, topic, 0, json, n);
+}
+
+// Um quadro novo do frame_hub; sem assinante livre, fica sem foto
+static bool send_snapshot(int fd, const mqtt_config_t *c) {
+  char topic[sizeof(c->prefix) + 10];
+  int sub = frame_hub_subscribe();
+  if (sub < 0) {
+    return true;
+  }
+  hub_frame_t *frame = frame_hub_receive(sub, 1000);
+  bool ok = true;
+  if (frame) {
+    topic_of(topic, sizeof(topic), c, "snapshot");
+    ok = send_publish(fd, 0, topic, 0, frame->buf, frame->len) && flush_out(fd);
+    frame_hub_release(frame);
+    count(&stats.snapshots, 1);
+  }
+  frame_hub_unsubscribe(sub);
+  return ok;
+}
+
+static void mqtt_task(void *arg) {
+  (void)arg;
+  mqtt_config_t c;
+  memset(&c, 0, sizeof(c));
+  int fd = -1;
+  bool on = false;
+  uint32_t retry_ms = MQTT_RETRY_MIN_MS;
+  int64_t next_connect_us = 0, next_heartbeat_us = 0, last_tx_us = 0, last_rx_us = 0;
+  int64_t flush_start_us = 0;  // CONNACK com eventos guardados; 0 = nada pendente
+  int64_t last_snapshot_us = 0;
+
+  for (;;) {
+    if (take_config(&c)) {
+      if (fd >= 0) {
+        send_small(fd, MQTT_DISCONNECT);
+        flush_out(fd);
+        close(fd);
+        fd = -1;
+      }
+      if (on != (c.host[0] != 0)) {
+        on = !on;
+        frame_hub_keep_capturing(on);
+        __atomic_store_n(&enabled, on, __ATOMIC_RELAXED);
+      }
+      retry_ms = MQTT_RETRY_MIN_MS;
+      next_connect_us = 0;
+      __atomic_store_n(&stats.connected, false, __ATOMIC_RELAXED);
+    }
+
+    mqtt_event_t ev;
+    TickType_t wait = POLL_MS / portTICK_PERIOD_MS;
+    while (xQueueReceive(inbox, &ev, wait) == pdTRUE) {
+      backlog_push(&ev);
+      wait = 0;
+    }
+    set_stat(&stats.backlog, backlog_count);
+    int64_t now = esp_timer_get_time();
+    if (!on || (fd < 0 && now < next_connect_us)) {
+      continue;
+    }
+
+    if (fd < 0) {
+      fd = open_session(&c);
+      if (fd < 0) {
+        count(&stats.connect_failures, 1);
+        next_connect_us = now + retry_ms * 1000LL;
+        retry_ms = retry_ms * 2 < MQTT_RETRY_MAX_MS ? retry_ms * 2 : MQTT_RETRY_MAX_MS;
+        continue;
+      }
+      count(&stats.connects, 1);
+      __atomic_store_n(&stats.connected, true, __ATOMIC_RELAXED);
+      retry_ms = MQTT_RETRY_MIN_MS;
+      now = esp_timer_get_time();
+      last_tx_us = last_rx_us = now;
+      next_heartbeat_us = now;
+      flush_start_us = backlog_count ? now : 0;
+      // Sessão limpa: o que estava em voo na conexão anterior sai de novo
+      for (int i = 0; i < backlog_count; i++) {
+        backlog[(backlog_head + i) % MQTT_BACKLOG].packet_id = 0;
+      }
+    }
+
+    bool want_snapshot = false;
+    bool ok = send_backlog(fd, &c, &want_snapshot);
+    if (ok && c.heartbeat_s && now >= next_heartbeat_us) {
+      ok = send_heartbeat(fd, &c);
+      next_heartbeat_us = now + c.heartbeat_s * 1000000LL;
+    }
+    if (ok && out_len == 0 && now - last_tx_us >= MQTT_KEEPALIVE_S * 500000LL) {
+      ok = send_small(fd, MQTT_PINGREQ);
+    }
+    if (ok && out_len) {
+      last_tx_us = now;
+      ok = flush_out(fd);
+    }
+    if (ok && want_snapshot && c.snapshot && (!last_snapshot_us || now - last_snapshot_us >= MQTT_SNAPSHOT_MIN_MS * 1000LL)) {
+      last_snapshot_us = now;
+      ok = send_snapshot(fd, &c);
+    }
+    ok = ok && receive(fd, &last_rx_us);
+    // Sem nada do broker (nem o PINGRESP) por um keepalive e meio: caiu
+    if (ok && esp_timer_get_time() - last_rx_us > MQTT_KEEPALIVE_S * 1500000LL) {
+      log_w("MQTT: broker %s:%u stopped answering", c.host, c.port);
+      ok = false;
+    }
+    if (!ok) {
+      log_w("MQTT: connection to %s:%u lost, %u events waiting", c.host, c.port, (uint32_t)backlog_count);
+      close(fd);
+      fd = -1;
+      out_len = 0;
+      __atomic_store_n(&stats.connected, false, __ATOMIC_RELAXED);
+      next_connect_us = esp_timer_get_time() + retry_ms * 1000LL;
+      continue;
+    }
+    if (flush_start_us && !backlog_count) {
+      set_stat(&stats.last_flush_ms, (esp_timer_get_time() - flush_start_us) / 1000);
+      flush_start_us = 0;
+    }
+    set_stat(&stats.backlog, backlog_count);
+  }
+}
+
+bool mqtt_client_start(mqtt_status_fn status) {
+  if (lock) {
+    return true;
+  }
+  status_fn = status;
+  lock = xSemaphoreCreateMutex();
+  inbox = xQueueCreate(MQTT_INBOX, sizeof(mqtt_event_t));
+  if (!lock || !inbox) {
+    return false;
+  }
+  snprintf(client_id, sizeof(client_id), "esp32cam-%08x", (unsigned)esp_random());
+  load_config(&config);
+  config_changed = true;
+  if (config.host[0]) {
+    // Já aceita eventos antes de a tarefa ler a configuração
+    __atomic_store_n(&enabled, true, __ATOMIC_RELAXED);
+    log_i("MQTT: publishing to %s:%u under %s/", config.host, config.port, config.prefix);
+  }
+  return xTaskCreate(mqtt_task, "mqtt", MQTT_TASK_STACK, NULL, MQTT_TASK_PRIORITY, NULL) == pdPASS;
+}
+
+void mqtt_client_get_stats(mqtt_client_stats_t *out_stats) {
+  out_stats->enabled = __atomic_load_n(&enabled, __ATOMIC_RELAXED);
+  out_stats->connected = __atomic_load_n(&stats.connected, __ATOMIC_RELAXED);
+  out_stats->connects = __atomic_load_n(&stats.connects, __ATOMIC_RELAXED);
+  out_stats->connect_failures = __atomic_load_n(&stats.connect_failures, __ATOMIC_RELAXED);
+  out_stats->events = __atomic_load_n(&stats.events, __ATOMIC_RELAXED);
+  out_stats->published = __atomic_load_n(&stats.published, __ATOMIC_RELAXED);
+  out_stats->resent = __atomic_load_n(&stats.resent, __ATOMIC_RELAXED);
+  out_stats->dropped = __atomic_load_n(&stats.dropped, __ATOMIC_RELAXED);
+  out_stats->backlog = __atomic_load_n(&stats.backlog, __ATOMIC_RELAXED);
+  out_stats->heartbeats = __atomic_load_n(&stats.heartbeats, __ATOMIC_RELAXED);
+  out_stats->snapshots = __atomic_load_n(&stats.snapshots, __ATOMIC_RELAXED);
+  out_stats->last_flush_ms = __atomic_load_n(&stats.last_flush_ms, __ATOMIC_RELAXED);
+}
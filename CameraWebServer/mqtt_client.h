@@ -0,0 +1,83 @@
+#ifndef MQTT_CLIENT_H
+#define MQTT_CLIENT_H
+
+// Publicador MQTT 3.1.1 dos eventos da câmera para a automação da casa (só
+// publica, QoS 0 e 1, sem assinaturas):
+//
+//   <prefixo>/event/<tipo>   {"seq":N,"type":"motion",...}  QoS 1
+//   <prefixo>/status         heartbeat a cada heartbeat_s    QoS 0
+//   <prefixo>/snapshot       JPEG logo depois do evento      QoS 0 (opcional)
+//   <prefixo>/availability   "online", ou "offline" pelo testamento (retidos)
+//
+// mqtt_client_event só copia o evento para a fila da tarefa, sem esperar:
+// pode ser chamado da tarefa de captura. A tarefa "mqtt" faz a conexão e todo
+// o envio. Com o broker fora, os eventos esperam num anel de MQTT_BACKLOG
+// entradas (cheio, sai o mais antigo) e, na volta, seguem num lote só, cada um
+// com o seq e o instante da captura, até o PUBACK; os que já tinham saído
+// antes da queda vão de novo com a marca DUP. O seq deixa o assinante
+// descartar as duplicatas.
+//
+// A configuração fica no NVS (namespace MQTT_NVS_NAMESPACE); sem host o
+// publicador fica parado. Enquanto ligado, a captura do frame_hub não para
+// mesmo sem ninguém assistindo, para o analisador seguir vendo a cena.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define MQTT_DEFAULT_PORT 1883
+#define MQTT_DEFAULT_PREFIX "esp32cam"
+#define MQTT_DEFAULT_HEARTBEAT_S 60
+#define MQTT_NVS_NAMESPACE "mqtt"
+#define MQTT_BACKLOG 32          // eventos guardados com o broker fora
+#define MQTT_INBOX 8             // eventos entre a captura e a tarefa
+#define MQTT_EVENT_MAX 192       // corpo JSON de um evento
+#define MQTT_TASK_STACK 4096
+#define MQTT_TASK_PRIORITY 3     // abaixo da captura e das sessões
+#define MQTT_KEEPALIVE_S 30
+#define MQTT_IO_TIMEOUT_MS 3000  // conexão, CONNACK e cada envio
+#define MQTT_RETRY_MIN_MS 1000   // espera entre tentativas, dobrando até o máximo
+#define MQTT_RETRY_MAX_MS 30000
+#define MQTT_SNAPSHOT_MIN_MS 10000
+
+typedef struct {
+  char host[64];  // vazio = desligado
+  uint16_t port;
+  char user[32];
+  char pass[64];
+  char prefix[48];
+  uint16_t heartbeat_s;  // 0 = sem heartbeat
+  bool snapshot;
+} mqtt_config_t;
+
+typedef struct {
+  bool enabled;
+  bool connected;
+  uint32_t connects;          // sessões abertas com o broker
+  uint32_t connect_failures;
+  uint32_t events;            // aceitos na fila
+  uint32_t published;         // confirmados pelo broker (PUBACK)
+  uint32_t resent;            // reenviados com DUP depois de uma queda
+  uint32_t dropped;           // perdidos com a fila ou o anel cheios
+  uint32_t backlog;           // esperando o PUBACK agora
+  uint32_t heartbeats;
+  uint32_t snapshots;
+  uint32_t last_flush_ms;     // CONNACK -> PUBACK do último evento guardado
+} mqtt_client_stats_t;
+
+// Membros JSON extras do heartbeat, cada um precedido de vírgula; retorna o
+// tamanho escrito
+typedef size_t (*mqtt_status_fn)(char *buf, size_t cap);
+
+// Lê a configuração do NVS e sobe a tarefa; chamar de novo não faz nada
+bool mqtt_client_start(mqtt_status_fn status);
+void mqtt_client_get_config(mqtt_config_t *out);
+// Grava a configuração no NVS; a tarefa reconecta com ela
+bool mqtt_client_configure(const mqtt_config_t *config);
+// Evento de tipo type (motion, tamper...) com os membros JSON fields (sem
+// chaves); false se o publicador está parado ou a fila da tarefa está cheia.
+// Não bloqueia.
+bool mqtt_client_event(const char *type, const char *fields, bool snapshot);
+void mqtt_client_get_stats(mqtt_client_stats_t *out);
+
+#endif
@@ -0,0 +1,380 @@
+#include "rtp_jpeg.h"
+#include <string.h>
+#include "jpeg_mcu.h"
+
+// Tabelas Huffman padrão (JPEG anexo K.3), as únicas que o RFC 2435 admite:
+// o receptor não recebe DHT
+static const uint8_t lum_dc_bits[16] = {0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0};
+static const uint8_t chm_dc_bits[16] = {0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0};
+static const uint8_t dc_symbols[12] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+static const uint8_t lum_ac_bits[16] = {0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7d};
+static const uint8_t lum_ac_symbols[162] = {
+  0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07, 0x22, 0x71, 0x14, 0x32, 0x81,
+  0x91, 0xa1, 0x08, 0x23, 0x42, 0xb1, 0xc1, 0x15, 0x52, 0xd1, 0xf0, 0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0a, 0x16, 0x17, 0x18,
+  0x19, 0x1a, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+  0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74, 0x75,
+  0x76, 0x77, 0x78, 0x79, 0x7a, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99,
+  0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xc2, 0xc3,
+  0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5,
+  0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa,
+};
+
+static const uint8_t chm_ac_bits[16] = {0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77};
+static const uint8_t chm_ac_symbols[162] = {
+  0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71, 0x13, 0x22, 0x32, 0x81, 0x08,
+  0x14, 0x42, 0x91, 0xa1, 0xb1, 0xc1, 0x09, 0x23, 0x33, 0x52, 0xf0, 0x15, 0x62, 0x72, 0xd1, 0x0a, 0x16, 0x24, 0x34, 0xe1, 0x25,
+  0xf1, 0x17, 0x18, 0x19, 0x1a, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x43, 0x44, 0x45, 0x46, 0x47,
+  0x48, 0x49, 0x4a, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x73, 0x74,
+  0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+  0x98, 0x99, 0x9a, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba,
+  0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xe2, 0xe3, 0xe4,
+  0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa,
+};
+
+// Tabelas de quantização de referência (anexo K.1, em zig-zag) para Q < 128
+static const uint8_t lum_quant[64] = {
+  16, 11, 12, 14, 12, 10, 16, 14, 13, 14, 18, 17, 16, 19, 24, 40, 26, 24, 22, 22, 24, 49, 35, 37, 29, 40, 58, 51, 61, 60, 57, 51,
+  56, 55, 64, 72, 92, 78, 64, 68, 87, 69, 55, 56, 80, 109, 81, 87, 95, 98, 103, 104, 103, 62, 77, 113, 121, 112, 100, 120, 92, 101, 103, 99,
+};
+static const uint8_t chm_quant[64] = {
+  17, 18, 18, 24, 21, 24, 47, 26, 26, 47, 99, 66, 56, 66, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+  99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99, 99,
+};
+
+static void put_be16(uint8_t *p, uint16_t v) {
+  p[0] = v >> 8;
+  p[1] = v & 0xff;
+}
+
+static void put_be32(uint8_t *p, uint32_t v) {
+  p[0] = v >> 24;
+  p[1] = (v >> 16) & 0xff;
+  p[2] = (v >> 8) & 0xff;
+  p[3] = v & 0xff;
+}
+
+static uint16_t get_be16(const uint8_t *p) {
+  return (p[0] << 8) | p[1];
+}
+
+static uint32_t get_be32(const uint8_t *p) {
+  return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static bool huff_is(const jpeg_huff_table_t *t, const uint8_t *bits, const uint8_t *symbols, size_t count) {
+  for (int l = 1; l <= 16; l++) {
+    if (t->bits[l] != bits[l - 1]) {
+      return false;
+    }
+  }
+  return memcmp(t->huffval, symbols, count) == 0;
+}
+
+// Tipo do RFC 2435 (0 ou 1, sem o bit de DRI) ou -1 fora do formato
+static int payload_type(const jpeg_info_t *info) {
+  if (info->ncomp != 3 || info->comp_h[0] != 2 || info->comp_v[0] > 2 || info->comp_td[0] || info->comp_ta[0]) {
+    return -1;
+  }
+  for (int c = 1; c < 3; c++) {
+    if (info->comp_h[c] != 1 || info->comp_v[c] != 1 || info->comp_tq[c] != info->comp_tq[1] || info->comp_td[c] != 1 || info->comp_ta[c] != 1) {
+      return -1;
+    }
+  }
+  if (!huff_is(&info->dc[0], lum_dc_bits, dc_symbols, sizeof(dc_symbols)) || !huff_is(&info->dc[1], chm_dc_bits, dc_symbols, sizeof(dc_symbols))
+      || !huff_is(&info->ac[0], lum_ac_bits, lum_ac_symbols, sizeof(lum_ac_symbols))
+      || !huff_is(&info->ac[1], chm_ac_bits, chm_ac_symbols, sizeof(chm_ac_symbols))) {
+    return -1;
+  }
+  return info->comp_v[0] == 1 ? 0 : 1;
+}
+
+void rtp_jpeg_sender_init(rtp_jpeg_sender_t *s, uint32_t ssrc, uint16_t first_seq) {
+  memset(s, 0, sizeof(*s));
+  s->ssrc = ssrc;
+  s->seq = first_seq;
+}
+
+int rtp_jpeg_send_frame(rtp_jpeg_sender_t *s, const uint8_t *jpeg, size_t len, uint32_t timestamp, uint8_t *buf, size_t max_packet,
+                        rtp_jpeg_emit_fn emit, void *ctx) {
+  jpeg_info_t info;
+  if (max_packet < RTP_JPEG_MIN_PACKET || !jpeg_parse_header(jpeg, len, &info)) {
+    return -1;
+  }
+  int type = payload_type(&info);
+  if (type < 0 || info.width > 2040 || info.height > 2040) {
+    return -1;
+  }
+  if (info.restart_interval) {
+    type += 64;
+  }
+
+  // O EOI fica de fora (o receptor o recoloca); depois dele o driver às
+  // vezes deixa preenchimento
+  const uint8_t *scan = info.scan;
+  size_t scan_len = info.scan_len;
+  for (size_t i = scan_len; i >= 2 && scan_len - i < 64; i--) {
+    if (scan[i - 2] == 0xFF && scan[i - 1] == 0xD9) {
+      scan_len = i - 2;
+      break;
+    }
+  }
+
+  size_t offset = 0;
+  int packets = 0;
+  while (offset < scan_len) {
+    uint8_t *p = buf;
+    p[0] = 0x80;  // V=2
+    p[1] = RTP_JPEG_PAYLOAD_TYPE;
+    put_be16(p + 2, s->seq);
+    put_be32(p + 4, timestamp);
+    put_be32(p + 8, s->ssrc);
+
+    uint8_t *j = p + RTP_HEADER_SIZE;
+    j[0] = 0;  // type-specific
+    j[1] = (offset >> 16) & 0xff;
+    j[2] = (offset >> 8) & 0xff;
+    j[3] = offset & 0xff;
+    j[4] = type;
+    j[5] = 255;  // tabelas dinâmicas, no primeiro pacote do quadro
+    j[6] = (info.width + 7) / 8;
+    j[7] = (info.height + 7) / 8;
+    size_t hdr = RTP_HEADER_SIZE + 8;
+    if (type >= 64) {
+      put_be16(buf + hdr, info.restart_interval);
+      put_be16(buf + hdr + 2, 0xFFFF);  // F=1, L=1, contagem 0x3FFF: o quadro inteiro
+      hdr += 4;
+    }
+    if (offset == 0) {
+      buf[hdr] = 0;      // MBZ
+      buf[hdr + 1] = 0;  // duas tabelas de 8 bits
+      put_be16(buf + hdr + 2, 128);
+      memcpy(buf + hdr + 4, info.qt[info.comp_tq[0]], 64);
+      memcpy(buf + hdr + 4 + 64, info.qt[info.comp_tq[1]], 64);
+      hdr += 4 + 128;
+    }
+
+    size_t n = scan_len - offset;
+    if (n > max_packet - hdr) {
+      n = max_packet - hdr;
+    }
+    memcpy(buf + hdr, scan + offset, n);
+    if (offset + n >= scan_len) {
+      p[1] |= 0x80;  // M: último pacote do quadro
+    }
+    if (!emit(ctx, buf, hdr + n)) {
+      return -2;
+    }
+    s->seq++;
+    s->packets++;
+    s->octets += hdr - RTP_HEADER_SIZE + n;
+    offset += n;
+    packets++;
+  }
+  s->last_timestamp = timestamp;
+  return packets;
+}
+
+uint64_t rtp_ntp_from_unix_us(int64_t unix_us) {
+  uint64_t sec = (uint64_t)(unix_us / 1000000) + 2208988800ULL;
+  uint64_t frac = ((uint64_t)(unix_us % 1000000) << 32) / 1000000;
+  return (sec << 32) | frac;
+}
+
+size_t rtp_jpeg_sender_report(const rtp_jpeg_sender_t *s, uint64_t ntp, uint32_t rtp_ts, uint8_t *out, size_t cap) {
+  if (cap < RTCP_SR_SIZE) {
+    return 0;
+  }
+  out[0] = 0x80;  // V=2, sem blocos de recepção
+  out[1] = 200;   // SR
+  put_be16(out + 2, RTCP_SR_SIZE / 4 - 1);
+  put_be32(out + 4, s->ssrc);
+  put_be32(out + 8, ntp >> 32);
+  put_be32(out + 12, ntp & 0xffffffff);
+  put_be32(out + 16, rtp_ts);
+  put_be32(out + 20, s->packets);
+  put_be32(out + 24, s->octets);
+  return RTCP_SR_SIZE;
+}
+
+void rtp_jpeg_receiver_init(rtp_jpeg_receiver_t *r, uint8_t *buf, size_t cap) {
+  memset(r, 0, sizeof(*r));
+  r->buf = buf;
+  r->cap = cap;
+}
+
+// Tabelas para Q de 1 a 99 (RFC 2435, anexo A)
+static void make_tables(int q, uint8_t *tables) {
+  int factor = q < 50 ? 5000 / q : 200 - q * 2;
+  for (int i = 0; i < 64; i++) {
+    int lq = (lum_quant[i] * factor + 50) / 100;
+    int cq = (chm_quant[i] * factor + 50) / 100;
+    tables[i] = lq < 1 ? 1 : lq > 255 ? 255 : lq;
+    tables[i + 64] = cq < 1 ? 1 : cq > 255 ? 255 : cq;
+  }
+}
+
+static uint8_t *put_huffman(uint8_t *p, const uint8_t *bits, const uint8_t *symbols, size_t count, uint8_t class_id) {
+  *p++ = 0xFF;
+  *p++ = 0xC4;
+  put_be16(p, 3 + 16 + count);
+  p += 2;
+  *p++ = class_id;
+  memcpy(p, bits, 16);
+  p += 16;
+  memcpy(p, symbols, count);
+  return p + count;
+}
+
+// Cabeçalho JFIF do quadro (RFC 2435, anexo B); retorna o tamanho ou 0
+// sem espaço
+static size_t make_headers(uint8_t *out, size_t cap, int type, uint16_t width, uint16_t height, const uint8_t *tables, uint16_t dri) {
+  if (cap < 1024) {
+    return 0;
+  }
+  uint8_t *p = out;
+  *p++ = 0xFF;
+  *p++ = 0xD8;
+
+  *p++ = 0xFF;
+  *p++ = 0xDB;
+  put_be16(p, 2 + 2 * 65);
+  p += 2;
+  *p++ = 0;
+  memcpy(p, tables, 64);
+  p += 64;
+  *p++ = 1;
+  memcpy(p, tables + 64, 64);
+  p += 64;
+
+  if (dri) {
+    *p++ = 0xFF;
+    *p++ = 0xDD;
+    put_be16(p, 4);
+    put_be16(p + 2, dri);
+    p += 4;
+  }
+
+  const uint8_t sof[] = {0xFF, 0xC0, 0, 17, 8, (uint8_t)(height >> 8), (uint8_t)height, (uint8_t)(width >> 8), (uint8_t)width, 3,
+                         1, (uint8_t)(type ? 0x22 : 0x21), 0, 2, 0x11, 1, 3, 0x11, 1};
+  memcpy(p, sof, sizeof(sof));
+  p += sizeof(sof);
+
+  p = put_huffman(p, lum_dc_bits, dc_symbols, sizeof(dc_symbols), 0x00);
+  p = put_huffman(p, lum_ac_bits, lum_ac_symbols, sizeof(lum_ac_symbols), 0x10);
+  p = put_huffman(p, chm_dc_bits, dc_symbols, sizeof(dc_symbols), 0x01);
+  p = put_huffman(p, chm_ac_bits, chm_ac_symbols, sizeof(chm_ac_symbols), 0x11);
+
+  const uint8_t sos[] = {0xFF, 0xDA, 0, 12, 3, 1, 0x00, 2, 0x11, 3, 0x11, 0, 63, 0};
+  memcpy(p, sos, sizeof(sos));
+  p += sizeof(sos);
+  return p - out;
+}
+
+size_t rtp_jpeg_receive(rtp_jpeg_receiver_t *r, const uint8_t *packet, size_t len) {
+  if (len < RTP_HEADER_SIZE || (packet[0] >> 6) != 2) {
+    r->errors++;
+    return 0;
+  }
+  size_t pos = RTP_HEADER_SIZE + 4 * (packet[0] & 0x0F);
+  if ((packet[0] & 0x10) && pos + 4 <= len) {
+    pos += 4 + 4 * get_be16(packet + pos + 2);
+  }
+  size_t end = len;
+  if (packet[0] & 0x20) {
+    end = packet[len - 1] <= len ? len - packet[len - 1] : 0;
+  }
+  if ((packet[1] & 0x7F) != RTP_JPEG_PAYLOAD_TYPE || pos + 8 > end) {
+    r->errors++;
+    return 0;
+  }
+  bool marker = packet[1] & 0x80;
+  uint16_t seq = get_be16(packet + 2);
+  uint32_t timestamp = get_be32(packet + 4);
+  if (r->seq_valid && seq != r->next_seq && r->active) {
+    r->active = false;
+    r->lost++;
+  }
+  r->next_seq = seq + 1;
+  r->seq_valid = true;
+
+  const uint8_t *j = packet + pos;
+  uint32_t offset = ((uint32_t)j[1] << 16) | (j[2] << 8) | j[3];
+  int type = j[4];
+  int q = j[5];
+  uint16_t width = j[6] * 8, height = j[7] * 8;
+  pos += 8;
+  uint16_t dri = 0;
+  if (type >= 64 && type < 128) {
+    if (pos + 4 > end) {
+      r->errors++;
+      return 0;
+    }
+    dri = get_be16(packet + pos);
+    pos += 4;
+    type -= 64;
+  }
+  if (type > 1) {
+    r->errors++;
+    return 0;
+  }
+
+  if (offset == 0) {
+    if (r->active) {
+      r->lost++;  // o quadro anterior não chegou ao bit M
+    }
+    r->active = false;
+    uint8_t tables[128];
+    if (q >= 128) {
+      if (pos + 4 > end) {
+        r->errors++;
+        return 0;
+      }
+      uint16_t qlen = get_be16(packet + pos + 2);
+      pos += 4;
+      if (packet[pos - 3] != 0 || qlen < 128 || pos + qlen > end) {
+        r->errors++;
+        return 0;
+      }
+      memcpy(tables, packet + pos, 128);
+      pos += qlen;
+    } else if (q > 0) {
+      make_tables(q, tables);
+    } else {
+      r->errors++;
+      return 0;
+    }
+    if (!width || !height || !(r->header_len = make_headers(r->buf, r->cap, type, width, height, tables, dri))) {
+      r->errors++;
+      return 0;
+    }
+    r->len = r->header_len;
+    r->timestamp = timestamp;
+    r->active = true;
+  } else if (!r->active || timestamp != r->timestamp || offset != r->len - r->header_len) {
+    if (r->active) {
+      r->lost++;
+      r->active = false;
+    }
+    return 0;
+  }
+
+  size_t n = end - pos;
+  if (r->len + n + 2 > r->cap) {
+    r->errors++;
+    r->active = false;
+    return 0;
+  }
+  memcpy(r->buf + r->len, packet + pos, n);
+  r->len += n;
+  if (!marker) {
+    return 0;
+  }
+  r->active = false;
+  if (r->len < r->header_len + 2 || r->buf[r->len - 2] != 0xFF || r->buf[r->len - 1] != 0xD9) {
+    r->buf[r->len++] = 0xFF;
+    r->buf[r->len++] = 0xD9;
+  }
+  r->frames++;
+  return r->len;
+}
@@ -0,0 +1,68 @@
+#ifndef RTP_JPEG_H
+#define RTP_JPEG_H
+
+// Payload RTP de JPEG (RFC 2435). O remetente divide o scan entrópico de
+// cada quadro em pacotes com o cabeçalho JPEG do RTP; as tabelas de
+// quantização vão no primeiro pacote de cada quadro (Q = 255) e o receptor
+// remonta o cabeçalho JFIF com as tabelas Huffman padrão (JPEG anexo K).
+// Só entram JPEGs baseline YUV 4:2:2 (tipo 0, o do OV2640) ou 4:2:0 (tipo
+// 1), com as tabelas Huffman padrão; com DRI os tipos viram 64 e 65.
+//
+// O receptor de referência fica aqui também, para as ferramentas de host.
+// Código portável.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define RTP_JPEG_PAYLOAD_TYPE 26
+#define RTP_JPEG_CLOCK_HZ 90000
+#define RTP_HEADER_SIZE 12
+#define RTP_JPEG_MIN_PACKET 256  // cabeçalhos do primeiro pacote: 156 bytes
+#define RTCP_SR_SIZE 28
+
+typedef struct {
+  uint32_t ssrc;
+  uint16_t seq;       // próximo número de sequência
+  uint32_t packets;   // enviados, para o relatório do remetente
+  uint32_t octets;    // bytes de payload enviados
+  uint32_t last_timestamp;
+} rtp_jpeg_sender_t;
+
+// Entrega um pacote RTP pronto; false interrompe o quadro
+typedef bool (*rtp_jpeg_emit_fn)(void *ctx, const uint8_t *packet, size_t len);
+
+void rtp_jpeg_sender_init(rtp_jpeg_sender_t *s, uint32_t ssrc, uint16_t first_seq);
+// Fragmenta o quadro em pacotes de até max_packet bytes, montados em buf
+// (max_packet bytes, fornecido pelo chamador). Retorna os pacotes enviados,
+// -1 para JPEG não suportado e -2 se o emit recusou um pacote (o resto do
+// quadro é descartado; o receptor perde só este quadro).
+int rtp_jpeg_send_frame(rtp_jpeg_sender_t *s, const uint8_t *jpeg, size_t len, uint32_t timestamp, uint8_t *buf, size_t max_packet,
+                        rtp_jpeg_emit_fn emit, void *ctx);
+
+// Relatório do remetente (RTCP SR, sem blocos de recepção): ntp é o relógio
+// de parede em NTP 32.32 e rtp_ts o instante equivalente no relógio de 90 kHz
+size_t rtp_jpeg_sender_report(const rtp_jpeg_sender_t *s, uint64_t ntp, uint32_t rtp_ts, uint8_t *out, size_t cap);
+// Microssegundos desde 1970 -> NTP 32.32 (segundos desde 1900)
+uint64_t rtp_ntp_from_unix_us(int64_t unix_us);
+
+typedef struct {
+  uint8_t *buf;       // JPEG remontado
+  size_t cap;
+  size_t len;
+  size_t header_len;
+  bool active;        // quadro em montagem
+  uint32_t timestamp;
+  uint16_t next_seq;
+  bool seq_valid;
+  uint32_t frames;
+  uint32_t lost;      // quadros perdidos por pacote faltando
+  uint32_t errors;    // pacotes inválidos ou quadros grandes demais
+} rtp_jpeg_receiver_t;
+
+void rtp_jpeg_receiver_init(rtp_jpeg_receiver_t *r, uint8_t *buf, size_t cap);
+// Aplica um pacote RTP; retorna o tamanho do JPEG completo em r->buf quando o
+// pacote fecha um quadro (bit M), 0 caso contrário
+size_t rtp_jpeg_receive(rtp_jpeg_receiver_t *r, const uint8_t *packet, size_t len);
+
+#endif
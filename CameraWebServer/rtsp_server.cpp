@@ -0,0 +1,814 @@
+#include "rtsp_server.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/time.h>
+#include "esp_timer.h"
+#include "esp_random.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "lwip/sockets.h"
+#include "frame_hub.h"
+#include "metrics.h"
+#include "rtp_jpeg.h"
+#include "stream_session.h"
+#include "trace.h"
+#include "esp32-hal-log.h"
+
+#define INTERLEAVED_HEADER 4  // '$', canal e tamanho, antes de cada pacote no TCP
+
+typedef struct {
+  int fd;
+  char peer[48];
+  char request[RTSP_REQUEST_MAX];
+  size_t request_len;
+  int64_t last_activity_us;
+
+  uint32_t session_id;  // 0 = sem SETUP
+  bool interleaved;
+  bool multicast;       // o RTP vem do grupo, não desta conexão
+  uint8_t channel;      // RTP; o RTCP vai no seguinte
+  int rtp_fd, rtcp_fd;  // UDP
+  struct sockaddr_in rtp_to, rtcp_to;
+  char track_url[128];
+
+  bool playing;
+  int sub;              // só unicast
+  int client;
+  int session;
+  rtp_jpeg_sender_t sender;
+  uint32_t base_ts;  // instante do PLAY no relógio de 90 kHz
+  int64_t base_us;
+  int64_t last_sr_us;
+  bool failed;       // envio intercalado falhou: a conexão acaba
+  uint8_t packet[INTERLEAVED_HEADER + RTSP_MAX_PACKET];
+} rtsp_conn_t;
+
+// Grupo multicast: um envio por quadro, qualquer que seja o número de
+// espectadores; a tarefa do grupo roda enquanto algum estiver em PLAY
+typedef struct {
+  SemaphoreHandle_t lock;
+  int viewers;
+  bool running;
+  bool killed;  // encerrado pelo /sessions: os espectadores saem também
+  int fd;
+  struct sockaddr_in rtp_to, rtcp_to;
+  rtp_jpeg_sender_t sender;  // continua entre uma subida e outra do grupo
+  uint32_t base_ts;
+  int64_t base_us;
+  int64_t last_sr_us;
+  int sub;
+  int client;
+  int session;
+  uint8_t packet[RTSP_MAX_PACKET];
+} rtsp_group_t;
+
+static int listen_fd = -1;
+static int conns_open = 0;
+static rtsp_server_stats_t stats;
+static rtsp_group_t group;
+
+static void count(uint32_t *counter, uint32_t n) {
+  __atomic_add_fetch(counter, n, __ATOMIC_RELAXED);
+}
+
+static uint16_t get_be16(const uint8_t *p) {
+  return (uint16_t)(p[0] << 8 | p[1]);
+}
+
+static bool send_all(int fd, const uint8_t *data, size_t len) {
+  while (len) {
+    ssize_t n = send(fd, data, len, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return false;
+    }
+    data += n;
+    len -= n;
+  }
+  return true;
+}
+
+// Valor de um cabeçalho do pedido (nome sem diferença de caixa); false se
+// não há
+static bool header_value(const char *request, const char *name, char *out, size_t cap) {
+  size_t name_len = strlen(name);
+  const char *line = strstr(request, "\r\n");
+  while (line) {
+    line += 2;
+    if (!strncasecmp(line, name, name_len) && line[name_len] == ':') {
+      const char *v = line + name_len + 1;
+      while (*v == ' ' || *v == '\t') {
+        v++;
+      }
+      size_t n = strcspn(v, "\r\n");
+      if (n >= cap) {
+        n = cap - 1;
+      }
+      memcpy(out, v, n);
+      out[n] = '\0';
+      return true;
+    }
+    line = strstr(line, "\r\n");
+  }
+  return false;
+}
+
+// Caminho de uma URL rtsp://host[:porta]/caminho
+static const char *url_path(const char *url) {
+  const char *p = strstr(url, "://");
+  if (!p) {
+    return url;
+  }
+  p = strchr(p + 3, '/');
+  return p ? p : "/";
+}
+
+static bool path_is_stream(const char *url) {
+  const char *path = url_path(url);
+  size_t n = strlen(RTSP_SERVER_PATH);
+  return !strncmp(path, RTSP_SERVER_PATH, n) && (path[n] == '\0' || path[n] == '/');
+}
+
+static bool reply(rtsp_conn_t *c, int status, const char *reason, const char *cseq, const char *headers, const char *body) {
+  char head[512];
+  int len = snprintf(head, sizeof(head), "RTSP/1.0 %d %s\r\nCSeq: %s\r\nServer: ESP32-CAM\r\n%s", status, reason, cseq, headers ? headers : "");
+  if (body) {
+    len += snprintf(head + len, len < (int)sizeof(head) ? sizeof(head) - len : 0, "Content-Length: %u\r\n", (unsigned)strlen(body));
+  }
+  len += snprintf(head + len, len < (int)sizeof(head) ? sizeof(head) - len : 0, "\r\n");
+  if (len >= (int)sizeof(head)) {
+    return false;
+  }
+  return send_all(c->fd, (const uint8_t *)head, len) && (!body || send_all(c->fd, (const uint8_t *)body, strlen(body)));
+}
+
+static void close_udp(rtsp_conn_t *c) {
+  if (c->rtp_fd >= 0) {
+    close(c->rtp_fd);
+    c->rtp_fd = -1;
+  }
+  if (c->rtcp_fd >= 0) {
+    close(c->rtcp_fd);
+    c->rtcp_fd = -1;
+  }
+}
+
+static void group_leave();
+
+static void stop_playing(rtsp_conn_t *c) {
+  if (!c->playing) {
+    return;
+  }
+  c->playing = false;
+  if (c->multicast) {
+    group_leave();
+  } else {
+    frame_hub_unsubscribe(c->sub);
+  }
+  metrics_client_close(c->client);
+  stream_session_close(c->session);
+  count(&stats.playing, (uint32_t)-1);
+}
+
+// Socket UDP numa porta efêmera; retorna a porta local ou 0
+static uint16_t open_udp(int *fd) {
+  *fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (*fd < 0) {
+    return 0;
+  }
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  socklen_t len = sizeof(addr);
+  if (bind(*fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || getsockname(*fd, (struct sockaddr *)&addr, &len) != 0) {
+    close(*fd);
+    *fd = -1;
+    return 0;
+  }
+  return ntohs(addr.sin_port);
+}
+
+static bool handle_describe(rtsp_conn_t *c, const char *url, const char *cseq) {
+  if (!path_is_stream(url)) {
+    return reply(c, 404, "Not Found", cseq, NULL, NULL);
+  }
+  struct sockaddr_in local;
+  socklen_t len = sizeof(local);
+  char ip[INET_ADDRSTRLEN] = "0.0.0.0";
+  if (getsockname(c->fd, (struct sockaddr *)&local, &len) == 0 && local.sin_family == AF_INET) {
+    inet_ntop(AF_INET, &local.sin_addr, ip, sizeof(ip));
+  }
+  char sdp[320];
+  snprintf(sdp, sizeof(sdp),
+           "v=0\r\n"
+           "o=- %u 1 IN IP4 %s\r\n"
+           "s=ESP32-CAM\r\n"
+           "c=IN IP4 0.0.0.0\r\n"
+           "t=0 0\r\n"
+           "a=range:npt=0-\r\n"
+           "m=video 0 RTP/AVP %d\r\n"
+           "a=rtpmap:%d JPEG/%d\r\n"
+           "a=control:track1\r\n",
+           (unsigned)(esp_random() >> 1), ip, RTP_JPEG_PAYLOAD_TYPE, RTP_JPEG_PAYLOAD_TYPE, RTP_JPEG_CLOCK_HZ);
+  char headers[192];
+  size_t n = strlen(url);
+  snprintf(headers, sizeof(headers), "Content-Base: %s%s\r\nContent-Type: application/sdp\r\n", url, n && url[n - 1] == '/' ? "" : "/");
+  return reply(c, 200, "OK", cseq, headers, sdp);
+}
+
+static bool handle_setup(rtsp_conn_t *c, const char *request, const char *url, const char *cseq) {
+  char transport[128];
+  if (!path_is_stream(url) || !header_value(request, "Transport", transport, sizeof(transport))) {
+    return reply(c, 400, "Bad Request", cseq, NULL, NULL);
+  }
+  if (c->session_id) {
+    // Um fluxo por sessão; mudar o transporte no meio não é suportado
+    return reply(c, 455, "Method Not Valid in This State", cseq, NULL, NULL);
+  }
+
+  char headers[256];
+  uint32_t ssrc = esp_random();
+  const char *interleaved = strstr(transport, "interleaved=");
+  const char *client_port = strstr(transport, "client_port=");
+  if (strstr(transport, "multicast")) {
+    // Destino e portas são os do grupo, não os que o cliente pedir
+    c->multicast = true;
+    ssrc = group.sender.ssrc;
+    snprintf(headers, sizeof(headers), "Transport: RTP/AVP;multicast;destination=%s;port=%d-%d;ttl=%d;ssrc=%08X\r\n", RTSP_MULTICAST_GROUP,
+             RTSP_MULTICAST_PORT, RTSP_MULTICAST_PORT + 1, RTSP_MULTICAST_TTL, (unsigned)ssrc);
+  } else if (strstr(transport, "RTP/AVP/TCP")) {
+    c->interleaved = true;
+    c->channel = interleaved ? (uint8_t)atoi(interleaved + 12) : 0;
+    snprintf(headers, sizeof(headers), "Transport: RTP/AVP/TCP;unicast;interleaved=%u-%u;ssrc=%08X\r\n", c->channel, c->channel + 1,
+             (unsigned)ssrc);
+  } else if (client_port) {
+    struct sockaddr_in peer;
+    socklen_t len = sizeof(peer);
+    char *end;
+    int rtp_port = strtol(client_port + 12, &end, 10);
+    int rtcp_port = *end == '-' ? atoi(end + 1) : rtp_port + 1;
+    if (getpeername(c->fd, (struct sockaddr *)&peer, &len) != 0 || peer.sin_family != AF_INET || rtp_port <= 0 || rtp_port > 65535) {
+      return reply(c, 461, "Unsupported Transport", cseq, NULL, NULL);
+    }
+    uint16_t server_rtp = open_udp(&c->rtp_fd);
+    uint16_t server_rtcp = open_udp(&c->rtcp_fd);
+    if (!server_rtp || !server_rtcp) {
+      close_udp(c);
+      return reply(c, 500, "Internal Server Error", cseq, NULL, NULL);
+    }
+    c->rtp_to = peer;
+    c->rtp_to.sin_port = htons(rtp_port);
+    c->rtcp_to = peer;
+    c->rtcp_to.sin_port = htons(rtcp_port);
+    snprintf(headers, sizeof(headers), "Transport: RTP/AVP;unicast;client_port=%d-%d;server_port=%u-%u;ssrc=%08X\r\n", rtp_port, rtcp_port,
+             server_rtp, server_rtcp, (unsigned)ssrc);
+  } else {
+    return reply(c, 461, "Unsupported Transport", cseq, NULL, NULL);
+  }
+
+  rtp_jpeg_sender_init(&c->sender, ssrc, (uint16_t)esp_random());
+  c->session_id = esp_random() | 1;
+  snprintf(c->track_url, sizeof(c->track_url), "%s", url);
+  size_t n = strlen(headers);
+  snprintf(headers + n, sizeof(headers) - n, "Session: %08X;timeout=%d\r\n", (unsigned)c->session_id, RTSP_SESSION_TIMEOUT_S);
+  log_i("RTSP %s: SETUP over %s", c->peer, c->multicast ? "multicast" : c->interleaved ? "TCP" : "UDP");
+  return reply(c, 200, "OK", cseq, headers, NULL);
+}
+
+// Instante no relógio de 90 kHz que vale base_ts em base_us
+static uint32_t rtp_clock(uint32_t base_ts, int64_t base_us, int64_t us) {
+  return base_ts + (uint32_t)((us - base_us) * (RTP_JPEG_CLOCK_HZ / 10000) / 100);
+}
+
+static uint32_t rtp_time(const rtsp_conn_t *c, int64_t us) {
+  return rtp_clock(c->base_ts, c->base_us, us);
+}
+
+static uint64_t ntp_now() {
+  struct timeval tv;
+  gettimeofday(&tv, NULL);
+  return rtp_ntp_from_unix_us((int64_t)tv.tv_sec * 1000000 + tv.tv_usec);
+}
+
+static bool group_emit(void *ctx, const uint8_t *packet, size_t len) {
+  (void)ctx;
+  if (sendto(group.fd, packet, len, 0, (const struct sockaddr *)&group.rtp_to, sizeof(group.rtp_to)) != (ssize_t)len) {
+    return false;
+  }
+  count(&stats.packets, 1);
+  return true;
+}
+
+static void group_send_frame(hub_frame_t *frame, uint32_t stale) {
+  int64_t t_send = esp_timer_get_time();
+  if (!group.last_sr_us || t_send - group.last_sr_us >= RTSP_SR_INTERVAL_MS * 1000LL) {
+    size_t len = rtp_jpeg_sender_report(&group.sender, ntp_now(), rtp_clock(group.base_ts, group.base_us, t_send), group.packet,
+                                        sizeof(group.packet));
+    if (len && sendto(group.fd, group.packet, len, 0, (const struct sockaddr *)&group.rtcp_to, sizeof(group.rtcp_to)) == (ssize_t)len) {
+      count(&stats.sender_reports, 1);
+    }
+    group.last_sr_us = t_send;
+  }
+  trace_begin("rtp multicast", frame->len);
+  int packets = rtp_jpeg_send_frame(&group.sender, frame->buf, frame->len, rtp_clock(group.base_ts, group.base_us, frame->captured_us),
+                                    group.packet, sizeof(group.packet), group_emit, NULL);
+  trace_end("rtp multicast");
+  int64_t t_sent = esp_timer_get_time();
+  if (packets == -1) {
+    count(&stats.unsupported, 1);
+    return;
+  }
+  if (packets < 0) {
+    count(&stats.frames_cut, 1);
+    metrics_drop(METRIC_DROP_SEND);
+  } else {
+    count(&stats.frames, 1);
+    count(&stats.multicast_frames, 1);
+  }
+  uint32_t sent = packets > 0 ? frame->len + packets * (RTP_HEADER_SIZE + 8) : 0;
+  metrics_observe(METRIC_SEND, t_sent - t_send);
+  metrics_observe(METRIC_FRAME_SIZE, frame->len);
+  metrics_client_sent(group.client, sent);
+  uint32_t min_interval_us = stream_session_frame(group.session, sent, t_sent - t_send, stale, t_sent);
+  frame_hub_pause(group.sub, min_interval_us ? t_sent + min_interval_us : 0);
+}
+
+// Fecha o grupo; lock tomado
+static void group_close() {
+  close(group.fd);
+  frame_hub_unsubscribe(group.sub);
+  metrics_client_close(group.client);
+  stream_session_close(group.session);
+  group.running = false;
+  group.killed = false;
+}
+
+static void group_task(void *arg) {
+  (void)arg;
+  uint32_t stale = 0;
+  while (true) {
+    xSemaphoreTake(group.lock, portMAX_DELAY);
+    bool done = !group.viewers;
+    if (done) {
+      group_close();
+    } else if (!group.killed && stream_session_killed(group.session)) {
+      log_i("RTSP multicast group closed from /sessions");
+      __atomic_store_n(&group.killed, true, __ATOMIC_RELAXED);
+    }
+    bool sending = !group.killed;
+    xSemaphoreGive(group.lock);
+    if (done) {
+      break;
+    }
+
+    hub_frame_t *frame = frame_hub_receive(group.sub, RTSP_RECEIVE_MS);
+    stale += frame_hub_take_stale(group.sub);
+    if (!frame) {
+      continue;
+    }
+    if (sending) {
+      group_send_frame(frame, stale);
+      stale = 0;
+    }
+    frame_hub_release(frame);
+  }
+  log_i("RTSP multicast group stopped");
+  trace_thread_exit();
+  vTaskDelete(NULL);
+}
+
+// Sobe o grupo pela interface da conexão RTSP do primeiro espectador; lock
+// tomado
+static bool group_open(rtsp_conn_t *c) {
+  struct sockaddr_in local;
+  socklen_t len = sizeof(local);
+  if (getsockname(c->fd, (struct sockaddr *)&local, &len) != 0 || local.sin_family != AF_INET) {
+    return false;
+  }
+  group.sub = frame_hub_subscribe();
+  if (group.sub < 0) {
+    return false;
+  }
+  group.fd = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (group.fd < 0) {
+    frame_hub_unsubscribe(group.sub);
+    return false;
+  }
+  uint8_t ttl = RTSP_MULTICAST_TTL;
+  setsockopt(group.fd, IPPROTO_IP, IP_MULTICAST_TTL, &ttl, sizeof(ttl));
+  setsockopt(group.fd, IPPROTO_IP, IP_MULTICAST_IF, &local.sin_addr, sizeof(local.sin_addr));
+  memset(&group.rtp_to, 0, sizeof(group.rtp_to));
+  group.rtp_to.sin_family = AF_INET;
+  group.rtp_to.sin_addr.s_addr = inet_addr(RTSP_MULTICAST_GROUP);
+  group.rtp_to.sin_port = htons(RTSP_MULTICAST_PORT);
+  group.rtcp_to = group.rtp_to;
+  group.rtcp_to.sin_port = htons(RTSP_MULTICAST_PORT + 1);
+
+  char peer[48];
+  snprintf(peer, sizeof(peer), "%s:%d", RTSP_MULTICAST_GROUP, RTSP_MULTICAST_PORT);
+  group.base_us = esp_timer_get_time();
+  group.base_ts = esp_random();
+  group.last_sr_us = 0;
+  group.client = metrics_client_open("multicast", peer);
+  group.session = stream_session_open("multicast", peer, "group", group.fd, group.base_us);
+  group.running = true;
+  if (xTaskCreate(group_task, "rtsp_group", RTSP_TASK_STACK, NULL, RTSP_TASK_PRIORITY, NULL) != pdPASS) {
+    log_e("RTSP task creation failed");
+    group_close();
+    return false;
+  }
+  log_i("RTSP multicast group %s started", peer);
+  return true;
+}
+
+static bool group_join(rtsp_conn_t *c) {
+  xSemaphoreTake(group.lock, portMAX_DELAY);
+  bool ok = !group.killed && (group.running || group_open(c));
+  if (ok) {
+    group.viewers++;
+    count(&stats.multicast_viewers, 1);
+  }
+  xSemaphoreGive(group.lock);
+  return ok;
+}
+
+// A tarefa do grupo para sozinha quando o último espectador sai
+static void group_leave() {
+  xSemaphoreTake(group.lock, portMAX_DELAY);
+  group.viewers--;
+  count(&stats.multicast_viewers, (uint32_t)-1);
+  xSemaphoreGive(group.lock);
+}
+
+static bool group_killed() {
+  return __atomic_load_n(&group.killed, __ATOMIC_RELAXED);
+}
+
+static bool handle_play(rtsp_conn_t *c, const char *cseq) {
+  char headers[256];
+  if (!c->playing && c->multicast) {
+    if (!group_join(c)) {
+      log_w("No multicast group for RTSP %s", c->peer);
+      return reply(c, 453, "Not Enough Bandwidth", cseq, NULL, NULL);
+    }
+    c->playing = true;
+    count(&stats.playing, 1);
+    c->session = stream_session_open("rtsp", c->peer, "multicast", c->fd, esp_timer_get_time());
+    log_i("RTSP %s: PLAY (multicast)", c->peer);
+  } else if (!c->playing) {
+    c->sub = frame_hub_subscribe();
+    if (c->sub < 0) {
+      log_w("No stream slot left for RTSP %s", c->peer);
+      return reply(c, 453, "Not Enough Bandwidth", cseq, NULL, NULL);
+    }
+    c->playing = true;
+    count(&stats.playing, 1);
+    c->base_us = esp_timer_get_time();
+    c->base_ts = esp_random();
+    c->last_sr_us = 0;
+    c->client = metrics_client_open("rtsp", c->peer);
+    c->session = stream_session_open("rtsp", c->peer, c->interleaved ? "tcp" : "udp", c->fd, c->base_us);
+    log_i("RTSP %s: PLAY", c->peer);
+  }
+  const rtp_jpeg_sender_t *sender = c->multicast ? &group.sender : &c->sender;
+  uint32_t rtptime = c->multicast ? rtp_clock(group.base_ts, group.base_us, esp_timer_get_time()) : rtp_time(c, esp_timer_get_time());
+  snprintf(headers, sizeof(headers), "Session: %08X\r\nRange: npt=0.000-\r\nRTP-Info: url=%s;seq=%u;rtptime=%u\r\n", (unsigned)c->session_id,
+           c->track_url, sender->seq, (unsigned)rtptime);
+  return reply(c, 200, "OK", cseq, headers, NULL);
+}
+
+// Atende um pedido completo (terminado em '\0'); false fecha a conexão
+static bool handle_request(rtsp_conn_t *c, const char *request) {
+  char method[16], url[128], cseq[16], session[32];
+  if (sscanf(request, "%15s %127s", method, url) != 2 || !header_value(request, "CSeq", cseq, sizeof(cseq))) {
+    reply(c, 400, "Bad Request", "0", NULL, NULL);
+    return false;
+  }
+  trace_instant("rtsp request", c->fd);
+
+  // Pedidos de uma sessão já criada precisam trazer o id dela
+  bool has_session = header_value(request, "Session", session, sizeof(session));
+  bool session_ok = c->session_id && has_session && strtoul(session, NULL, 16) == c->session_id;
+  bool needs_session = !strcmp(method, "PLAY") || !strcmp(method, "PAUSE") || !strcmp(method, "TEARDOWN");
+  if (needs_session && !c->session_id) {
+    return reply(c, 455, "Method Not Valid in This State", cseq, NULL, NULL);
+  }
+  if ((needs_session || has_session) && c->session_id && !session_ok) {
+    return reply(c, 454, "Session Not Found", cseq, NULL, NULL);
+  }
+
+  if (!strcmp(method, "OPTIONS")) {
+    return reply(c, 200, "OK", cseq, "Public: OPTIONS, DESCRIBE, SETUP, PLAY, PAUSE, TEARDOWN, GET_PARAMETER, SET_PARAMETER\r\n", NULL);
+  }
+  if (!strcmp(method, "DESCRIBE")) {
+    return handle_describe(c, url, cseq);
+  }
+  if (!strcmp(method, "SETUP")) {
+    return handle_setup(c, request, url, cseq);
+  }
+  if (!strcmp(method, "PLAY")) {
+    return handle_play(c, cseq);
+  }
+  char headers[48] = "";
+  if (c->session_id) {
+    snprintf(headers, sizeof(headers), "Session: %08X\r\n", (unsigned)c->session_id);
+  }
+  if (!strcmp(method, "PAUSE")) {
+    stop_playing(c);
+    return reply(c, 200, "OK", cseq, headers, NULL);
+  }
+  if (!strcmp(method, "TEARDOWN")) {
+    log_i("RTSP %s: TEARDOWN", c->peer);
+    reply(c, 200, "OK", cseq, headers, NULL);
+    return false;
+  }
+  // GET_PARAMETER vazio é o keepalive da sessão
+  if (!strcmp(method, "GET_PARAMETER") || !strcmp(method, "SET_PARAMETER")) {
+    return reply(c, 200, "OK", cseq, headers, NULL);
+  }
+  return reply(c, 501, "Not Implemented", cseq, NULL, NULL);
+}
+
+static void consume(rtsp_conn_t *c, size_t n) {
+  memmove(c->request, c->request + n, c->request_len - n);
+  c->request_len -= n;
+}
+
+// Separa os pedidos recebidos e os blocos intercalados do cliente (os RTCP
+// RR, que só renovam a sessão); false fecha a conexão
+static bool handle_input(rtsp_conn_t *c) {
+  while (c->request_len) {
+    if (c->request[0] == '$') {
+      if (c->request_len < INTERLEAVED_HEADER) {
+        return true;
+      }
+      size_t block = INTERLEAVED_HEADER + get_be16((const uint8_t *)c->request + 2);
+      if (block > sizeof(c->request) - 1) {
+        return false;
+      }
+      if (c->request_len < block) {
+        return true;
+      }
+      consume(c, block);
+      continue;
+    }
+
+    c->request[c->request_len] = '\0';
+    char *end = strstr(c->request, "\r\n\r\n");
+    if (!end) {
+      if (c->request_len >= sizeof(c->request) - 1) {
+        reply(c, 400, "Bad Request", "0", NULL, NULL);
+        return false;
+      }
+      return true;
+    }
+    size_t head = end - c->request + 4;
+    char length[12];
+    size_t body = header_value(c->request, "Content-Length", length, sizeof(length)) ? strtoul(length, NULL, 10) : 0;
+    if (head + body > sizeof(c->request) - 1) {
+      reply(c, 413, "Request Entity Too Large", "0", NULL, NULL);
+      return false;
+    }
+    if (c->request_len < head + body) {
+      return true;
+    }
+    end[2] = '\0';  // o corpo (SET_PARAMETER) é ignorado
+    if (!handle_request(c, c->request)) {
+      return false;
+    }
+    consume(c, head + body);
+  }
+  return true;
+}
+
+// Um pacote RTP ou RTCP do canal dado ao cliente; no TCP o pacote tem os 4
+// bytes antes dele livres para o cabeçalho intercalado
+static bool emit_packet(rtsp_conn_t *c, uint8_t *packet, size_t len, bool rtcp) {
+  if (c->interleaved) {
+    uint8_t *p = packet - INTERLEAVED_HEADER;
+    p[0] = '$';
+    p[1] = c->channel + (rtcp ? 1 : 0);
+    p[2] = len >> 8;
+    p[3] = len & 0xff;
+    if (!send_all(c->fd, p, len + INTERLEAVED_HEADER)) {
+      c->failed = true;
+      return false;
+    }
+    return true;
+  }
+  const struct sockaddr_in *to = rtcp ? &c->rtcp_to : &c->rtp_to;
+  return sendto(rtcp ? c->rtcp_fd : c->rtp_fd, packet, len, 0, (const struct sockaddr *)to, sizeof(*to)) == (ssize_t)len;
+}
+
+static bool emit_rtp(void *ctx, const uint8_t *packet, size_t len) {
+  (void)packet;  // montado em c->packet + INTERLEAVED_HEADER
+  rtsp_conn_t *c = (rtsp_conn_t *)ctx;
+  if (!emit_packet(c, c->packet + INTERLEAVED_HEADER, len, false)) {
+    return false;
+  }
+  count(&stats.packets, 1);
+  return true;
+}
+
+// Relatório do remetente: o relógio de parede e o de 90 kHz no mesmo instante
+static void send_report(rtsp_conn_t *c, int64_t now) {
+  size_t len = rtp_jpeg_sender_report(&c->sender, ntp_now(), rtp_time(c, now), c->packet + INTERLEAVED_HEADER, RTSP_MAX_PACKET);
+  if (len && emit_packet(c, c->packet + INTERLEAVED_HEADER, len, true)) {
+    count(&stats.sender_reports, 1);
+  }
+  c->last_sr_us = now;
+}
+
+static void send_frame(rtsp_conn_t *c, hub_frame_t *frame, uint32_t stale) {
+  int64_t t_send = esp_timer_get_time();
+  if (!c->last_sr_us || t_send - c->last_sr_us >= RTSP_SR_INTERVAL_MS * 1000LL) {
+    send_report(c, t_send);
+  }
+  trace_begin("rtp send", frame->len);
+  int packets = rtp_jpeg_send_frame(&c->sender, frame->buf, frame->len, rtp_time(c, frame->captured_us), c->packet + INTERLEAVED_HEADER,
+                                    RTSP_MAX_PACKET, emit_rtp, c);
+  trace_end("rtp send");
+  int64_t t_sent = esp_timer_get_time();
+  if (packets == -1) {
+    count(&stats.unsupported, 1);
+    return;
+  }
+  if (packets < 0) {
+    // Em UDP o resto do quadro fica de fora e o receptor perde só este
+    count(&stats.frames_cut, 1);
+    metrics_drop(METRIC_DROP_SEND);
+    if (c->failed) {
+      if (t_sent - t_send >= RTSP_SEND_TIMEOUT_MS * 900LL) {
+        log_w("RTSP %s: send took %u ms, over the %d ms deadline", c->peer, (uint32_t)((t_sent - t_send) / 1000), RTSP_SEND_TIMEOUT_MS);
+        stream_session_deadline(c->session);
+      }
+      return;
+    }
+  } else {
+    count(&stats.frames, 1);
+  }
+  uint32_t sent = packets > 0 ? frame->len + packets * (RTP_HEADER_SIZE + 8) : 0;
+  metrics_observe(METRIC_SEND, t_sent - t_send);
+  metrics_observe(METRIC_FRAME_SIZE, frame->len);
+  metrics_client_sent(c->client, sent);
+  uint32_t min_interval_us = stream_session_frame(c->session, sent, t_sent - t_send, stale, t_sent);
+  frame_hub_pause(c->sub, min_interval_us ? t_sent + min_interval_us : 0);
+}
+
+static void conn_task(void *arg) {
+  rtsp_conn_t *c = (rtsp_conn_t *)arg;
+  uint32_t stale = 0;
+
+  while (!c->failed) {
+    if (c->playing && (stream_session_killed(c->session) || (c->multicast && group_killed()))) {
+      log_i("RTSP %s closed from /sessions", c->peer);
+      break;
+    }
+    // Tocando em unicast, só espia o socket; o tempo de espera fica com o
+    // frame_hub
+    fd_set readable;
+    FD_ZERO(&readable);
+    FD_SET(c->fd, &readable);
+    int max_fd = c->fd;
+    if (c->rtcp_fd >= 0) {
+      FD_SET(c->rtcp_fd, &readable);
+      max_fd = c->rtcp_fd > max_fd ? c->rtcp_fd : max_fd;
+    }
+    bool sending = c->playing && !c->multicast;
+    struct timeval wait = {sending ? 0 : 1, 0};
+    int ready = select(max_fd + 1, &readable, NULL, NULL, &wait);
+    int64_t now = esp_timer_get_time();
+    if (ready > 0 && FD_ISSET(c->fd, &readable)) {
+      ssize_t n = recv(c->fd, c->request + c->request_len, sizeof(c->request) - 1 - c->request_len, 0);
+      if (n <= 0) {
+        break;
+      }
+      c->request_len += n;
+      c->last_activity_us = now;
+      if (!handle_input(c)) {
+        break;
+      }
+    }
+    if (ready > 0 && c->rtcp_fd >= 0 && FD_ISSET(c->rtcp_fd, &readable)) {
+      uint8_t rr[128];
+      if (recv(c->rtcp_fd, rr, sizeof(rr), 0) > 0) {
+        c->last_activity_us = now;
+      }
+    }
+    // No TCP intercalado a própria conexão diz se o cliente ainda está lá
+    if (!(c->playing && c->interleaved) && now - c->last_activity_us > RTSP_SESSION_TIMEOUT_S * 1000000LL) {
+      log_w("RTSP %s: session timed out", c->peer);
+      break;
+    }
+    if (!sending) {
+      continue;
+    }
+
+    hub_frame_t *frame = frame_hub_receive(c->sub, RTSP_RECEIVE_MS);
+    stale += frame_hub_take_stale(c->sub);
+    if (!frame) {
+      continue;
+    }
+    send_frame(c, frame, stale);
+    frame_hub_release(frame);
+    stale = 0;
+  }
+
+  stop_playing(c);
+  close_udp(c);
+  close(c->fd);
+  __atomic_sub_fetch(&conns_open, 1, __ATOMIC_RELAXED);
+  log_i("RTSP %s disconnected", c->peer);
+  free(c);
+  trace_thread_exit();
+  vTaskDelete(NULL);
+}
+
+static void accept_task(void *arg) {
+  (void)arg;
+  while (true) {
+    struct sockaddr_in addr;
+    socklen_t len = sizeof(addr);
+    int fd = accept(listen_fd, (struct sockaddr *)&addr, &len);
+    if (fd < 0) {
+      vTaskDelay(100 / portTICK_PERIOD_MS);
+      continue;
+    }
+    count(&stats.connections, 1);
+    rtsp_conn_t *c = NULL;
+    if (__atomic_add_fetch(&conns_open, 1, __ATOMIC_RELAXED) > RTSP_SERVER_MAX_CLIENTS || !(c = (rtsp_conn_t *)calloc(1, sizeof(rtsp_conn_t)))) {
+      log_w("RTSP connection refused: %d open", RTSP_SERVER_MAX_CLIENTS);
+      __atomic_sub_fetch(&conns_open, 1, __ATOMIC_RELAXED);
+      close(fd);
+      continue;
+    }
+    c->fd = fd;
+    c->rtp_fd = c->rtcp_fd = -1;
+    c->sub = c->client = c->session = -1;
+    c->last_activity_us = esp_timer_get_time();
+    char ip[INET_ADDRSTRLEN] = "?";
+    inet_ntop(AF_INET, &addr.sin_addr, ip, sizeof(ip));
+    snprintf(c->peer, sizeof(c->peer), "%s:%u", ip, ntohs(addr.sin_port));
+
+    // Pacotes pequenos saem já; cada envio tem prazo
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    struct timeval deadline = {RTSP_SEND_TIMEOUT_MS / 1000, (RTSP_SEND_TIMEOUT_MS % 1000) * 1000};
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &deadline, sizeof(deadline));
+    if (xTaskCreate(conn_task, "rtsp_conn", RTSP_TASK_STACK, c, RTSP_TASK_PRIORITY, NULL) != pdPASS) {
+      log_e("RTSP task creation failed");
+      __atomic_sub_fetch(&conns_open, 1, __ATOMIC_RELAXED);
+      close(fd);
+      free(c);
+    }
+  }
+}
+
+bool rtsp_server_start(uint16_t port) {
+  if (listen_fd >= 0) {
+    return true;
+  }
+  int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+  if (fd < 0) {
+    return false;
+  }
+  int one = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(port);
+  if (bind(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(fd, RTSP_SERVER_MAX_CLIENTS) != 0) {
+    log_e("RTSP bind to port %u failed: %d", port, errno);
+    close(fd);
+    return false;
+  }
+  listen_fd = fd;
+  group.lock = xSemaphoreCreateMutex();
+  rtp_jpeg_sender_init(&group.sender, esp_random(), (uint16_t)esp_random());
+  if (xTaskCreate(accept_task, "rtsp", 3072, NULL, RTSP_TASK_PRIORITY, NULL) != pdPASS) {
+    log_e("RTSP task creation failed");
+    close(fd);
+    listen_fd = -1;
+    return false;
+  }
+  return true;
+}
+
+void rtsp_server_get_stats(rtsp_server_stats_t *out) {
+  out->connections = __atomic_load_n(&stats.connections, __ATOMIC_RELAXED);
+  out->playing = __atomic_load_n(&stats.playing, __ATOMIC_RELAXED);
+  out->frames = __atomic_load_n(&stats.frames, __ATOMIC_RELAXED);
+  out->packets = __atomic_load_n(&stats.packets, __ATOMIC_RELAXED);
+  out->frames_cut = __atomic_load_n(&stats.frames_cut, __ATOMIC_RELAXED);
+  out->unsupported = __atomic_load_n(&stats.unsupported, __ATOMIC_RELAXED);
+  out->sender_reports = __atomic_load_n(&stats.sender_reports, __ATOMIC_RELAXED);
+  out->multicast_viewers = __atomic_load_n(&stats.multicast_viewers, __ATOMIC_RELAXED);
+  out->multicast_frames = __atomic_load_n(&stats.multicast_frames, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,54 @@
+#ifndef RTSP_SERVER_H
+#define RTSP_SERVER_H
+
+// Servidor RTSP (RFC 2326) do fluxo MJPEG em RTP/JPEG (RFC 2435), ao lado do
+// /stream: DESCRIBE, SETUP, PLAY, PAUSE e TEARDOWN, com o RTP em UDP
+// (client_port) ou intercalado na própria conexão TCP (interleaved). Cada
+// conexão roda numa tarefa própria, assina o frame_hub e entra no registro de
+// sessões (/sessions) como "rtsp", com a mesma adaptação de taxa das sessões
+// HTTP. Em UDP um pacote perdido custa só aquele quadro, sem o bloqueio de
+// cabeça de fila do TCP; o relatório do remetente (RTCP SR) sai no primeiro
+// quadro e a cada RTSP_SR_INTERVAL_MS, ligando o relógio de 90 kHz ao
+// relógio de parede.
+//
+// Com "multicast" no Transport do SETUP, o espectador entra no grupo
+// RTSP_MULTICAST_GROUP: uma tarefa só envia cada quadro uma vez para o grupo,
+// com um SSRC e uma sequência comuns, enquanto houver algum espectador em
+// PLAY. O grupo aparece no /sessions como "multicast" e cada espectador como
+// "rtsp" com os parâmetros "multicast".
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define RTSP_SERVER_PORT 554
+#define RTSP_SERVER_PATH "/mjpeg"
+#define RTSP_SERVER_MAX_CLIENTS 4  // os espectadores do grupo multicast contam aqui
+#define RTSP_TASK_STACK 6144
+#define RTSP_TASK_PRIORITY 5
+#define RTSP_MAX_PACKET 1400     // pacote RTP inteiro, cabe num quadro Ethernet
+#define RTSP_REQUEST_MAX 1024
+#define RTSP_SR_INTERVAL_MS 5000
+#define RTSP_SESSION_TIMEOUT_S 60  // sem pedido RTSP nem RTCP do cliente (UDP)
+#define RTSP_RECEIVE_MS 100
+#define RTSP_SEND_TIMEOUT_MS 3000  // prazo de cada envio intercalado
+#define RTSP_MULTICAST_GROUP "239.255.42.42"  // escopo local da organização
+#define RTSP_MULTICAST_PORT 5004              // RTP; o RTCP vai na seguinte
+#define RTSP_MULTICAST_TTL 1                  // não passa do roteador
+
+typedef struct {
+  uint32_t connections;     // aceitas desde o boot
+  uint32_t playing;         // sessões em PLAY agora
+  uint32_t frames;
+  uint32_t packets;
+  uint32_t frames_cut;      // quadros interrompidos no meio (UDP sem buffer)
+  uint32_t unsupported;     // JPEGs que o RFC 2435 não descreve
+  uint32_t sender_reports;
+  uint32_t multicast_viewers;  // espectadores do grupo agora
+  uint32_t multicast_frames;   // quadros enviados ao grupo (uma cópia cada)
+} rtsp_server_stats_t;
+
+// Abre a porta e a tarefa que aceita as conexões; chamar de novo não faz nada
+bool rtsp_server_start(uint16_t port);
+void rtsp_server_get_stats(rtsp_server_stats_t *out);
+
+#endif
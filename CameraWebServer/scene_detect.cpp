@@ -0,0 +1,143 @@
+#include "scene_detect.h"
+#include "jpeg_mcu.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define SCENE_CELLS (SCENE_GRID_W * SCENE_GRID_H)
+#define SCENE_MCU_BYTES (JPEG_MCU_MAX_BLOCKS * 208)
+
+struct scene_detector {
+  scene_params_t params;
+  jpeg_info_t info;
+  size_t ref_len;
+  int16_t ref_cell[SCENE_CELLS];
+  bool has_ref;
+  bool has_cells;
+  uint16_t quiet;
+  uint8_t luma;
+  scene_change_t change;
+  uint8_t ac_bits[SCENE_MCU_BYTES];
+};
+
+scene_detector_t *scene_detector_new(const scene_params_t *params) {
+  scene_detector_t *d = (scene_detector_t *)malloc(sizeof(scene_detector_t));
+  if (!d) {
+    return NULL;
+  }
+  memset(d, 0, sizeof(scene_detector_t));
+  d->params = *params;
+  return d;
+}
+
+void scene_detector_free(scene_detector_t *d) {
+  free(d);
+}
+
+bool scene_detector_is_static(const scene_detector_t *d) {
+  return d->quiet >= d->params.static_frames;
+}
+
+uint8_t scene_detector_luma(const scene_detector_t *d) {
+  return d->luma;
+}
+
+void scene_detector_change(const scene_detector_t *d, scene_change_t *out) {
+  *out = d->change;
+}
+
+// Média dos DCs de luminância por célula da grade (DC/8 + 128 = nível de cinza)
+static bool build_cells(scene_detector_t *d, int16_t *cells) {
+  const jpeg_info_t *info = &d->info;
+  int32_t sum[SCENE_CELLS];
+  uint16_t count[SCENE_CELLS];
+  jpeg_scan_t scan;
+  jpeg_block_t blocks[JPEG_MCU_MAX_BLOCKS];
+  jpeg_bit_writer_t w;
+  int32_t total = 0;
+
+  memset(sum, 0, sizeof(sum));
+  memset(count, 0, sizeof(count));
+  jpeg_scan_begin(&scan, info);
+  for (uint32_t m = 0; m < info->mcu_count; m++) {
+    jpeg_bit_writer_init(&w, d->ac_bits, sizeof(d->ac_bits), false);
+    if (!jpeg_scan_mcu(&scan, blocks, &w)) {
+      return false;
+    }
+    int cx = (m % info->mcus_x) * SCENE_GRID_W / info->mcus_x;
+    int cy = (m / info->mcus_x) * SCENE_GRID_H / info->mcus_y;
+    // Os primeiros blocos da MCU são sempre do componente Y
+    int y = 0, n = 0;
+    for (int b = 0; b < info->blocks_per_mcu && info->block_comp[b] == 0; b++, n++) {
+      y += blocks[b].dc;
+    }
+    y = y * info->qt[info->comp_tq[0]][0] / (n ? n : 1);
+    sum[cy * SCENE_GRID_W + cx] += y;
+    count[cy * SCENE_GRID_W + cx]++;
+    total += y;
+  }
+  for (int c = 0; c < SCENE_CELLS; c++) {
+    cells[c] = count[c] ? sum[c] / count[c] : 0;
+  }
+  int mean = info->mcu_count ? total / (int32_t)info->mcu_count / 8 + 128 : 0;
+  d->luma = mean < 0 ? 0 : (mean > 255 ? 255 : mean);
+  return true;
+}
+
+bool scene_detector_update(scene_detector_t *d, const uint8_t *jpg, size_t len) {
+  int16_t cells[SCENE_CELLS];
+
+  // Tamanho bem diferente já basta: em movimento a decodificação é evitada.
+  // Saindo da cena estática o quadro é decodificado, para localizar a mudança.
+  if (d->has_ref && !scene_detector_is_static(d)) {
+    size_t diff = len > d->ref_len ? len - d->ref_len : d->ref_len - len;
+    if (diff * 1000 > d->ref_len * d->params.size_permille) {
+      d->ref_len = len;
+      d->has_cells = false;
+      d->quiet = 0;
+      return true;
+    }
+  }
+  if (!jpeg_parse_header(jpg, len, &d->info) || !build_cells(d, cells)) {
+    d->has_ref = false;
+    d->quiet = 0;
+    return true;
+  }
+
+  bool changed = !d->has_ref || !d->has_cells;
+  if (changed) {
+    d->change.score = 100;
+    d->change.x0 = d->change.y0 = 0;
+    d->change.x1 = SCENE_GRID_W - 1;
+    d->change.y1 = SCENE_GRID_H - 1;
+  } else {
+    // DC desquantizado está em escala 8x do nível de cinza
+    int count = 0;
+    scene_change_t box = {0, SCENE_GRID_W, SCENE_GRID_H, 0, 0};
+    for (int c = 0; c < SCENE_CELLS; c++) {
+      if (abs(cells[c] - d->ref_cell[c]) > d->params.dc_delta * 8) {
+        int x = c % SCENE_GRID_W, y = c / SCENE_GRID_W;
+        box.x0 = x < box.x0 ? x : box.x0;
+        box.y0 = y < box.y0 ? y : box.y0;
+        box.x1 = x > box.x1 ? x : box.x1;
+        box.y1 = y > box.y1 ? y : box.y1;
+        count++;
+      }
+    }
+    if (count) {
+      box.score = (count * 100 + SCENE_CELLS - 1) / SCENE_CELLS;
+      d->change = box;
+      changed = true;
+    }
+  }
+  if (changed) {
+    // A referência só avança na mudança: desvios lentos acabam acumulando
+    d->ref_len = len;
+    memcpy(d->ref_cell, cells, sizeof(cells));
+    d->has_ref = true;
+    d->has_cells = true;
+    d->quiet = 0;
+  } else if (d->quiet < 0xFFFF) {
+    d->quiet++;
+  }
+  return changed;
+}
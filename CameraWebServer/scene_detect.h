@@ -0,0 +1,40 @@
+#ifndef SCENE_DETECT_H
+#define SCENE_DETECT_H
+
+// Detector barato de mudança de cena sobre o JPEG já comprimido: compara a
+// variação de tamanho e uma miniatura com os DCs de luminância de cada MCU
+// contra a última referência. Código portável (também compila no host).
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SCENE_GRID_W 16
+#define SCENE_GRID_H 12
+
+typedef struct {
+  uint16_t size_permille;   // variação de tamanho (‰) que já indica mudança
+  uint8_t dc_delta;         // variação de DC médio em uma célula da grade
+  uint16_t static_frames;   // quadros sem mudança até declarar a cena estática
+} scene_params_t;
+
+// Onde a cena mudou: caixa das células alteradas, em células da grade
+// (x1/y1 inclusivos), e a parte da grade que mudou
+typedef struct {
+  uint8_t score;  // células alteradas, % da grade
+  uint8_t x0, y0, x1, y1;
+} scene_change_t;
+
+typedef struct scene_detector scene_detector_t;
+
+scene_detector_t *scene_detector_new(const scene_params_t *params);
+void scene_detector_free(scene_detector_t *d);
+// Retorna true se o quadro difere da referência; quadros não suportados
+// contam como mudança para nunca segurar o fluxo por engano.
+bool scene_detector_update(scene_detector_t *d, const uint8_t *jpg, size_t len);
+bool scene_detector_is_static(const scene_detector_t *d);
+// Luminância média (DC de Y, 0-255) do último quadro analisado
+uint8_t scene_detector_luma(const scene_detector_t *d);
+// Mudança da última comparação decodificada; sem referência, a grade inteira
+void scene_detector_change(const scene_detector_t *d, scene_change_t *out);
+
+#endif
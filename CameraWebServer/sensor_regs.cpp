@@ -0,0 +1,162 @@
+#include "sensor_regs.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+typedef struct {
+  uint16_t reg;
+  uint8_t value;  // byte inteiro (lido com máscara 0xff)
+  bool used;
+  uint32_t generation;
+  int64_t read_us;
+} reg_slot_t;
+
+// Ganho e exposição, atualizados pelo AGC/AEC do sensor: OV2640 (banco do
+// sensor) e OV3660/OV5640
+static const uint16_t volatile_regs[] = {0x100, 0x104, 0x110, 0x145, 0x3500, 0x3501, 0x3502, 0x350a, 0x350b};
+
+static SemaphoreHandle_t lock = NULL;
+static reg_slot_t slots[SENSOR_REGS_SLOTS];
+static int next_victim = 0;
+static uint32_t generation = 1;
+static sensor_regs_stats_t stats;
+
+void sensor_regs_begin() {
+  if (!lock) {
+    lock = xSemaphoreCreateMutex();
+  }
+}
+
+static bool is_volatile(int reg) {
+  for (size_t i = 0; i < sizeof(volatile_regs) / sizeof(volatile_regs[0]); i++) {
+    if (volatile_regs[i] == reg) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static reg_slot_t *find(int reg) {
+  for (int i = 0; i < SENSOR_REGS_SLOTS; i++) {
+    if (slots[i].used && slots[i].reg == reg) {
+      return &slots[i];
+    }
+  }
+  return NULL;
+}
+
+static bool fresh(const reg_slot_t *slot, int64_t now) {
+  if (slot->generation != __atomic_load_n(&generation, __ATOMIC_ACQUIRE)) {
+    return false;
+  }
+  return !is_volatile(slot->reg) || now - slot->read_us < SENSOR_REGS_VOLATILE_MS * 1000LL;
+}
+
+static void store(int reg, uint8_t value, uint32_t gen, int64_t now) {
+  reg_slot_t *slot = find(reg);
+  if (!slot) {
+    for (int i = 0; i < SENSOR_REGS_SLOTS && !slot; i++) {
+      if (!slots[i].used) {
+        slot = &slots[i];
+      }
+    }
+  }
+  if (!slot) {
+    slot = &slots[next_victim];
+    next_victim = (next_victim + 1) % SENSOR_REGS_SLOTS;
+  }
+  slot->reg = reg;
+  slot->value = value;
+  slot->used = true;
+  slot->generation = gen;
+  slot->read_us = now;
+}
+
+// Leitura pelo barramento com o lock tomado; sem insert só renova o que já
+// está na cópia
+static int bus_read(sensor_t *s, int reg, int64_t now, bool insert) {
+  uint32_t gen = __atomic_load_n(&generation, __ATOMIC_ACQUIRE);
+  int value = s->get_reg(s, reg, 0xff);
+  stats.bus_reads++;
+  if (value >= 0 && (insert || find(reg))) {
+    store(reg, value, gen, now);
+  }
+  return value;
+}
+
+int sensor_regs_get(sensor_t *s, int reg, int mask) {
+  if (mask > 0xff || !lock) {
+    return s->get_reg(s, reg, mask);
+  }
+  int64_t now = esp_timer_get_time();
+  xSemaphoreTake(lock, portMAX_DELAY);
+  reg_slot_t *slot = find(reg);
+  int value;
+  if (slot && fresh(slot, now)) {
+    stats.hits++;
+    value = slot->value;
+  } else {
+    value = bus_read(s, reg, now, true);
+  }
+  xSemaphoreGive(lock);
+  return value < 0 ? value : value & mask;
+}
+
+int sensor_regs_set(sensor_t *s, int reg, int mask, int value) {
+  if (!lock) {
+    return s->set_reg(s, reg, mask, value);
+  }
+  int64_t now = esp_timer_get_time();
+  xSemaphoreTake(lock, portMAX_DELAY);
+  uint32_t gen = __atomic_load_n(&generation, __ATOMIC_ACQUIRE);
+  reg_slot_t *slot = find(reg);
+  int res = s->set_reg(s, reg, mask, value);
+  stats.writes++;
+  if (mask > 0xff || res) {
+    if (slot) {
+      slot->used = false;
+    }
+  } else if ((mask & 0xff) == 0xff) {
+    store(reg, value, gen, now);
+  } else if (slot && fresh(slot, now)) {
+    // Os bits fora da máscara são os da cópia
+    slot->value = (slot->value & ~mask) | (value & mask);
+  } else if (slot) {
+    slot->used = false;
+  }
+  xSemaphoreGive(lock);
+  return res;
+}
+
+int sensor_regs_read_range(sensor_t *s, int first, int count, int *values) {
+  if (count > SENSOR_REGS_RANGE_MAX) {
+    count = SENSOR_REGS_RANGE_MAX;
+  }
+  if (!lock) {
+    return 0;
+  }
+  int64_t now = esp_timer_get_time();
+  int n = 0;
+  xSemaphoreTake(lock, portMAX_DELAY);
+  // Um dump não tira da cópia os registradores das consultas frequentes
+  for (; n < count; n++) {
+    values[n] = bus_read(s, first + n, now, false);
+    if (values[n] < 0) {
+      break;
+    }
+  }
+  xSemaphoreGive(lock);
+  return n;
+}
+
+void sensor_regs_invalidate() {
+  __atomic_add_fetch(&generation, 1, __ATOMIC_RELEASE);
+  __atomic_add_fetch(&stats.invalidations, 1, __ATOMIC_RELAXED);
+}
+
+void sensor_regs_get_stats(sensor_regs_stats_t *out) {
+  out->hits = stats.hits;
+  out->bus_reads = stats.bus_reads;
+  out->writes = stats.writes;
+  out->invalidations = __atomic_load_n(&stats.invalidations, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,42 @@
+#ifndef SENSOR_REGS_H
+#define SENSOR_REGS_H
+
+// Cópia em RAM dos registradores do sensor lidos pelo servidor (/status,
+// /greg, dia/noite), para que as consultas não disputem o SCCB com o driver
+// da câmera. Cada leitura pelo barramento entra na cópia; as escritas pelo
+// sensor_regs_set atualizam a cópia sem reler. Os setters do driver
+// (set_framesize, set_quality, set_pll...) mexem em registradores que a
+// cópia não acompanha: quem os chama avisa com sensor_regs_invalidate e as
+// próximas leituras voltam ao barramento. Os registradores que o próprio
+// sensor muda (ganho e exposição do AGC/AEC) valem por pouco tempo.
+
+#include <stdint.h>
+#include "esp_camera.h"
+
+#define SENSOR_REGS_SLOTS 32
+#define SENSOR_REGS_VOLATILE_MS 200
+#define SENSOR_REGS_RANGE_MAX 64
+
+typedef struct {
+  uint32_t hits;          // leituras respondidas pela cópia
+  uint32_t bus_reads;     // leituras que foram ao barramento
+  uint32_t writes;        // escritas pelo sensor_regs_set
+  uint32_t invalidations;
+} sensor_regs_stats_t;
+
+void sensor_regs_begin();
+
+// Como o get_reg/set_reg do driver (valor & mask; negativo em erro). Máscaras
+// acima de 0xff (leituras de vários bytes do OV3660/OV5640) vão direto ao
+// barramento.
+int sensor_regs_get(sensor_t *s, int reg, int mask);
+int sensor_regs_set(sensor_t *s, int reg, int mask, int value);
+// Lê count registradores (até SENSOR_REGS_RANGE_MAX) a partir de first pelo
+// barramento, renovando os que estão na cópia; retorna quantos foram lidos
+// antes do primeiro erro
+int sensor_regs_read_range(sensor_t *s, int first, int count, int *values);
+// Depois de qualquer setter do driver
+void sensor_regs_invalidate();
+void sensor_regs_get_stats(sensor_regs_stats_t *stats);
+
+#endif
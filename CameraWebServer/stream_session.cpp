@@ -0,0 +1,213 @@
+#include "stream_session.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+// Média móvel do intervalo entre quadros, peso 1/8 por quadro
+#define INTERVAL_SHIFT 3
+
+// Intervalo mínimo entre quadros em cada nível
+static const uint32_t level_interval_us[STREAM_SESSION_LEVELS] = {0, 100000, 200000, 500000};
+
+typedef struct {
+  bool active;
+  bool killed;
+  uint32_t id;
+  char endpoint[12];
+  char peer[48];
+  char params[48];
+  int sockfd;
+  int64_t started_us;
+  int64_t last_frame_us;
+  int64_t interval_avg_us;
+  uint32_t frames;
+  uint64_t bytes;
+  uint32_t send_us[STREAM_SESSION_SEND_SAMPLES];  // anel
+  uint8_t level;
+  int64_t last_slow_us;
+  int64_t level_changed_us;
+  uint32_t stale;
+  uint32_t downgrades;
+} session_t;
+
+static SemaphoreHandle_t lock = NULL;
+static session_t sessions[STREAM_SESSION_MAX];
+static uint32_t next_id = 1;
+static stream_session_totals_t totals;
+
+void stream_session_begin() {
+  if (!lock) {
+    lock = xSemaphoreCreateMutex();
+  }
+}
+
+int stream_session_open(const char *endpoint, const char *peer, const char *params, int sockfd, int64_t now_us) {
+  if (!lock) {
+    return -1;
+  }
+  int slot = -1;
+  xSemaphoreTake(lock, portMAX_DELAY);
+  for (int i = 0; i < STREAM_SESSION_MAX && slot < 0; i++) {
+    if (!sessions[i].active) {
+      slot = i;
+    }
+  }
+  if (slot >= 0) {
+    session_t *s = &sessions[slot];
+    memset(s, 0, sizeof(*s));
+    s->active = true;
+    s->id = next_id++;
+    snprintf(s->endpoint, sizeof(s->endpoint), "%s", endpoint);
+    snprintf(s->peer, sizeof(s->peer), "%s", peer);
+    snprintf(s->params, sizeof(s->params), "%s", params ? params : "");
+    s->sockfd = sockfd;
+    s->started_us = now_us;
+  }
+  xSemaphoreGive(lock);
+  return slot;
+}
+
+// Rebaixa ou promove a sessão; lock tomado
+static void adapt(session_t *s, uint32_t send_us, uint32_t stale, int64_t now_us) {
+  bool slow = stale || send_us > STREAM_SESSION_SLOW_SEND_MS * 1000;
+  if (slow) {
+    s->last_slow_us = now_us;
+    if (s->level < STREAM_SESSION_LEVELS - 1 && now_us - s->level_changed_us >= STREAM_SESSION_DOWNGRADE_HOLD_MS * 1000LL) {
+      s->level++;
+      s->level_changed_us = now_us;
+      s->downgrades++;
+      totals.downgrades++;
+    }
+  } else if (s->level && now_us - s->last_slow_us >= STREAM_SESSION_UPGRADE_MS * 1000LL
+             && now_us - s->level_changed_us >= STREAM_SESSION_UPGRADE_MS * 1000LL) {
+    s->level--;
+    s->level_changed_us = now_us;
+  }
+}
+
+uint32_t stream_session_frame(int slot, uint32_t bytes, uint32_t send_us, uint32_t stale, int64_t now_us) {
+  if (slot < 0) {
+    return 0;
+  }
+  session_t *s = &sessions[slot];
+  xSemaphoreTake(lock, portMAX_DELAY);
+  s->stale += stale;
+  totals.stale += stale;
+  adapt(s, send_us, stale, now_us);
+  if (s->frames) {
+    int64_t interval = now_us - s->last_frame_us;
+    s->interval_avg_us = s->frames == 1 ? interval : s->interval_avg_us + ((interval - s->interval_avg_us) >> INTERVAL_SHIFT);
+  }
+  s->send_us[s->frames % STREAM_SESSION_SEND_SAMPLES] = send_us;
+  s->frames++;
+  s->bytes += bytes;
+  s->last_frame_us = now_us;
+  uint32_t interval = level_interval_us[s->level];
+  xSemaphoreGive(lock);
+  return interval;
+}
+
+void stream_session_deadline(int slot) {
+  (void)slot;
+  xSemaphoreTake(lock, portMAX_DELAY);
+  totals.deadline_closes++;
+  xSemaphoreGive(lock);
+}
+
+bool stream_session_killed(int slot) {
+  return slot >= 0 && __atomic_load_n(&sessions[slot].killed, __ATOMIC_RELAXED);
+}
+
+void stream_session_close(int slot) {
+  if (slot < 0) {
+    return;
+  }
+  xSemaphoreTake(lock, portMAX_DELAY);
+  sessions[slot].active = false;
+  xSemaphoreGive(lock);
+}
+
+static int compare_u32(const void *a, const void *b) {
+  uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+  return x < y ? -1 : x > y;
+}
+
+static int compare_id(const void *a, const void *b) {
+  uint32_t x = ((const stream_session_info_t *)a)->id, y = ((const stream_session_info_t *)b)->id;
+  return x < y ? -1 : x > y;
+}
+
+// Percentil pelo posto mais próximo numa amostra ordenada
+static uint32_t percentile(const uint32_t *sorted, uint32_t n, uint32_t pct) {
+  if (!n) {
+    return 0;
+  }
+  uint32_t rank = (n * pct + 99) / 100;
+  return sorted[rank ? rank - 1 : 0];
+}
+
+int stream_session_list(stream_session_info_t *out, int max, int64_t now_us) {
+  if (!lock) {
+    return 0;
+  }
+  uint32_t samples[STREAM_SESSION_SEND_SAMPLES];
+  int n = 0;
+  xSemaphoreTake(lock, portMAX_DELAY);
+  for (int i = 0; i < STREAM_SESSION_MAX && n < max; i++) {
+    const session_t *s = &sessions[i];
+    if (!s->active) {
+      continue;
+    }
+    stream_session_info_t *info = &out[n++];
+    info->id = s->id;
+    memcpy(info->endpoint, s->endpoint, sizeof(info->endpoint));
+    memcpy(info->peer, s->peer, sizeof(info->peer));
+    memcpy(info->params, s->params, sizeof(info->params));
+    info->sockfd = s->sockfd;
+    info->age_ms = (now_us - s->started_us) / 1000;
+    info->frames = s->frames;
+    info->bytes = s->bytes;
+    info->fps_x10 = s->interval_avg_us > 0 ? 10000000LL / s->interval_avg_us : 0;
+    info->killed = s->killed;
+    info->level = s->level;
+    info->stale = s->stale;
+    info->downgrades = s->downgrades;
+    uint32_t count = s->frames < STREAM_SESSION_SEND_SAMPLES ? s->frames : STREAM_SESSION_SEND_SAMPLES;
+    memcpy(samples, s->send_us, count * sizeof(samples[0]));
+    qsort(samples, count, sizeof(samples[0]), compare_u32);
+    info->send_p50_us = percentile(samples, count, 50);
+    info->send_p95_us = percentile(samples, count, 95);
+    info->send_p99_us = percentile(samples, count, 99);
+  }
+  xSemaphoreGive(lock);
+  qsort(out, n, sizeof(out[0]), compare_id);
+  return n;
+}
+
+bool stream_session_kill(uint32_t id) {
+  if (!lock) {
+    return false;
+  }
+  bool found = false;
+  xSemaphoreTake(lock, portMAX_DELAY);
+  for (int i = 0; i < STREAM_SESSION_MAX; i++) {
+    if (sessions[i].active && sessions[i].id == id) {
+      __atomic_store_n(&sessions[i].killed, true, __ATOMIC_RELAXED);
+      found = true;
+    }
+  }
+  xSemaphoreGive(lock);
+  return found;
+}
+
+void stream_session_get_totals(stream_session_totals_t *out) {
+  if (!lock) {
+    memset(out, 0, sizeof(*out));
+    return;
+  }
+  xSemaphoreTake(lock, portMAX_DELAY);
+  *out = totals;
+  xSemaphoreGive(lock);
+}
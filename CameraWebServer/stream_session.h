@@ -0,0 +1,68 @@
+#ifndef STREAM_SESSION_H
+#define STREAM_SESSION_H
+
+// Registro das sessões de fluxo abertas (/stream, /delta): quem assiste,
+// com que parâmetros, quanto já recebeu, a taxa atual e os percentis do
+// tempo de envio. Cada sessão é atualizada só pela tarefa que a serve; a
+// listagem e o pedido de encerramento vêm de outras tarefas. O encerramento
+// é cooperativo: a sessão confere stream_session_killed a cada quadro.
+//
+// Cliente lento: um envio acima de STREAM_SESSION_SLOW_SEND_MS ou um quadro
+// velho descartado da fila da sessão rebaixa a sessão um nível (no máximo um
+// a cada STREAM_SESSION_DOWNGRADE_HOLD_MS); cada nível limita a taxa daquele
+// cliente (10, 5 e 2 quadros/s). Depois de STREAM_SESSION_UPGRADE_MS sem
+// sinal de lentidão, a sessão sobe um nível.
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define STREAM_SESSION_MAX 8
+#define STREAM_SESSION_SEND_SAMPLES 64  // últimos envios para os percentis
+#define STREAM_SESSION_LEVELS 4
+#define STREAM_SESSION_SLOW_SEND_MS 200
+#define STREAM_SESSION_DOWNGRADE_HOLD_MS 2000
+#define STREAM_SESSION_UPGRADE_MS 10000
+
+typedef struct {
+  uint32_t id;  // crescente desde o boot, nunca reaproveitado
+  char endpoint[12];
+  char peer[48];
+  char params[48];  // query string do pedido (truncada)
+  int sockfd;
+  uint32_t age_ms;
+  uint32_t frames;
+  uint64_t bytes;
+  uint32_t fps_x10;  // média móvel do intervalo entre quadros
+  uint32_t send_p50_us, send_p95_us, send_p99_us;
+  uint8_t level;  // 0 = todos os quadros
+  uint32_t stale;
+  uint32_t downgrades;
+  bool killed;
+} stream_session_info_t;
+
+typedef struct {
+  uint32_t stale;            // quadros velhos descartados, todas as sessões
+  uint32_t downgrades;
+  uint32_t deadline_closes;  // sessões encerradas por envio acima do prazo
+} stream_session_totals_t;
+
+void stream_session_begin();
+
+// Retorna o slot ou -1 com a tabela cheia (a sessão segue sem registro)
+int stream_session_open(const char *endpoint, const char *peer, const char *params, int sockfd, int64_t now_us);
+// Quadro enviado, com os quadros velhos descartados desde o anterior;
+// retorna o intervalo mínimo até o próximo quadro desta sessão (µs, 0 = sem
+// limite)
+uint32_t stream_session_frame(int slot, uint32_t bytes, uint32_t send_us, uint32_t stale, int64_t now_us);
+// Envio que passou do prazo: a sessão vai ser encerrada
+void stream_session_deadline(int slot);
+bool stream_session_killed(int slot);
+void stream_session_close(int slot);
+
+// Sessões abertas, em ordem de id; retorna quantas
+int stream_session_list(stream_session_info_t *out, int max, int64_t now_us);
+// Pede o encerramento; false se o id não está aberto
+bool stream_session_kill(uint32_t id);
+void stream_session_get_totals(stream_session_totals_t *totals);
+
+#endif
@@ -0,0 +1,233 @@
+#include "trace.h"
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include "esp_timer.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#else
+#include <pthread.h>
+#include <time.h>
+#endif
+
+typedef struct {
+  uint32_t seq;       // índice + 1 depois de publicado; 0 durante a escrita
+  char phase;         // 'B', 'E' ou 'i'
+  uint8_t thread;
+  uint32_t arg;
+  const char *name;
+  int64_t ts;
+} trace_event_t;
+
+typedef struct {
+  uintptr_t id;
+  bool used;  // false de novo depois do trace_thread_exit da tarefa
+  char name[16];
+} trace_thread_t;
+
+static trace_event_t *ring = NULL;
+static uint32_t ring_mask = 0;
+static uint32_t head = 0;
+static bool enabled = true;
+static trace_thread_t threads[TRACE_MAX_THREADS];
+static uint32_t thread_count = 0;  // slots já usados alguma vez
+static __thread int thread_slot = -1;
+static __thread bool thread_owned = false;  // false: dividindo o último slot
+
+static int64_t now_us() {
+#ifdef ESP_PLATFORM
+  return esp_timer_get_time();
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+#endif
+}
+
+static bool claim_slot(uint32_t slot) {
+  bool expected = false;
+  return __atomic_compare_exchange_n(&threads[slot].used, &expected, true, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+}
+
+// Tarefas recebem um índice pequeno na primeira vez que registram algo.
+// Slots nunca usados saem primeiro (os eventos antigos no anel guardam só o
+// índice, e o nome deles muda quando o slot é reaproveitado); esgotados,
+// vale um liberado por trace_thread_exit e, sem nenhum, o último é dividido.
+static int current_thread() {
+  if (thread_slot >= 0) {
+    return thread_slot;
+  }
+  uint32_t slot = __atomic_load_n(&thread_count, __ATOMIC_RELAXED);
+  while (slot < TRACE_MAX_THREADS && !__atomic_compare_exchange_n(&thread_count, &slot, slot + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+  }
+  if (slot >= TRACE_MAX_THREADS || !claim_slot(slot)) {
+    for (slot = 0; slot < TRACE_MAX_THREADS && !claim_slot(slot); slot++) {
+    }
+  }
+  if (slot >= TRACE_MAX_THREADS) {
+    thread_slot = TRACE_MAX_THREADS - 1;
+    return thread_slot;
+  }
+  trace_thread_t *t = &threads[slot];
+#ifdef ESP_PLATFORM
+  t->id = (uintptr_t)xTaskGetCurrentTaskHandle();
+  snprintf(t->name, sizeof(t->name), "%s", pcTaskGetName(NULL));
+#else
+  t->id = (uintptr_t)pthread_self();
+  if (pthread_getname_np(pthread_self(), t->name, sizeof(t->name)) != 0) {
+    snprintf(t->name, sizeof(t->name), "thread %u", (unsigned)slot);
+  }
+#endif
+  thread_slot = slot;
+  thread_owned = true;
+  return thread_slot;
+}
+
+void trace_thread_exit() {
+  if (thread_owned) {
+    __atomic_store_n(&threads[thread_slot].used, false, __ATOMIC_RELEASE);
+  }
+  thread_slot = -1;
+  thread_owned = false;
+}
+
+bool trace_init(size_t events) {
+  if (ring) {
+    return true;
+  }
+  size_t n = 1;
+  while (n < events) {
+    n <<= 1;
+  }
+#ifdef ESP_PLATFORM
+  trace_event_t *r = (trace_event_t *)heap_caps_calloc(n, sizeof(trace_event_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+  if (!r) {
+    r = (trace_event_t *)calloc(n, sizeof(trace_event_t));
+  }
+#else
+  trace_event_t *r = (trace_event_t *)calloc(n, sizeof(trace_event_t));
+#endif
+  if (!r) {
+    return false;
+  }
+  ring_mask = n - 1;
+  __atomic_store_n(&ring, r, __ATOMIC_RELEASE);
+  return true;
+}
+
+void trace_set_enabled(bool on) {
+  __atomic_store_n(&enabled, on, __ATOMIC_RELAXED);
+}
+
+bool trace_enabled() {
+  return __atomic_load_n(&enabled, __ATOMIC_RELAXED) && __atomic_load_n(&ring, __ATOMIC_ACQUIRE);
+}
+
+static void record(char phase, const char *name, uint32_t arg) {
+  trace_event_t *r = __atomic_load_n(&ring, __ATOMIC_ACQUIRE);
+  if (!r || !__atomic_load_n(&enabled, __ATOMIC_RELAXED)) {
+    return;
+  }
+  uint32_t idx = __atomic_fetch_add(&head, 1, __ATOMIC_RELAXED);
+  trace_event_t *ev = &r[idx & ring_mask];
+  __atomic_store_n(&ev->seq, 0, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  ev->phase = phase;
+  ev->thread = current_thread();
+  ev->arg = arg;
+  ev->name = name;
+  ev->ts = now_us();
+  __atomic_store_n(&ev->seq, idx + 1, __ATOMIC_RELEASE);
+}
+
+void trace_begin(const char *name, uint32_t arg) {
+  record('B', name, arg);
+}
+
+void trace_end(const char *name) {
+  record('E', name, 0);
+}
+
+void trace_instant(const char *name, uint32_t arg) {
+  record('i', name, arg);
+}
+
+__attribute__((format(printf, 3, 4)))
+static void emit(trace_write_fn write, void *ctx, const char *fmt, ...) {
+  char line[160];
+  va_list args;
+  va_start(args, fmt);
+  int n = vsnprintf(line, sizeof(line), fmt, args);
+  va_end(args);
+  if (n > 0) {
+    write(ctx, line, (size_t)n < sizeof(line) ? (size_t)n : sizeof(line) - 1);
+  }
+}
+
+size_t trace_foreach(trace_visit_fn visit, void *ctx, int64_t window_us) {
+  trace_event_t *r = __atomic_load_n(&ring, __ATOMIC_ACQUIRE);
+  size_t visited = 0;
+  if (!r) {
+    return 0;
+  }
+  uint32_t end = __atomic_load_n(&head, __ATOMIC_ACQUIRE);
+  uint32_t size = ring_mask + 1;
+  uint32_t start = end > size ? end - size : 0;
+  int64_t since = window_us > 0 ? now_us() - window_us : INT64_MIN;
+  for (uint32_t i = start; i != end; i++) {
+    trace_event_t *slot = &r[i & ring_mask];
+    uint32_t seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE);
+    if (seq != i + 1) {
+      continue;  // sobrescrito ou ainda em escrita
+    }
+    trace_record_t rec = {slot->name, slot->phase, slot->thread, slot->arg, slot->ts};
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&slot->seq, __ATOMIC_RELAXED) != seq || rec.ts < since) {
+      continue;
+    }
+    visit(ctx, &rec);
+    visited++;
+  }
+  return visited;
+}
+
+const char *trace_thread_name(int thread) {
+  return (thread >= 0 && thread < TRACE_MAX_THREADS) ? threads[thread].name : "";
+}
+
+typedef struct {
+  trace_write_fn write;
+  void *ctx;
+  const char *sep;
+} dump_ctx_t;
+
+static void dump_event(void *arg, const trace_record_t *ev) {
+  dump_ctx_t *d = (dump_ctx_t *)arg;
+  if (ev->phase == 'E') {
+    emit(d->write, d->ctx, "%s\n{\"name\":\"%s\",\"ph\":\"E\",\"ts\":%lld,\"pid\":1,\"tid\":%u}", d->sep, ev->name, (long long)ev->ts,
+         (unsigned)ev->thread);
+  } else {
+    emit(d->write, d->ctx, "%s\n{\"name\":\"%s\",\"ph\":\"%c\",%s\"ts\":%lld,\"pid\":1,\"tid\":%u,\"args\":{\"v\":%u}}", d->sep, ev->name,
+         ev->phase, ev->phase == 'i' ? "\"s\":\"t\"," : "", (long long)ev->ts, (unsigned)ev->thread, (unsigned)ev->arg);
+  }
+  d->sep = ",";
+}
+
+size_t trace_dump(trace_write_fn write, void *ctx, int64_t window_us) {
+  dump_ctx_t d = {write, ctx, ""};
+
+  emit(write, ctx, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+  uint32_t threads_used = __atomic_load_n(&thread_count, __ATOMIC_RELAXED);
+  for (uint32_t t = 0; t < threads_used && t < TRACE_MAX_THREADS; t++) {
+    emit(write, ctx, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}", d.sep, (unsigned)t,
+         threads[t].name);
+    d.sep = ",";
+  }
+  size_t written = trace_foreach(dump_event, &d, window_us);
+  emit(write, ctx, "\n]}\n");
+  return written;
+}
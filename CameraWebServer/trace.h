@@ -0,0 +1,49 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+// Registro de spans em um anel em memória, sem travas: cada tarefa reserva
+// um slot com um incremento atômico e publica o evento com um número de
+// sequência. O dump sai no formato JSON do Chrome/Perfetto (chrome://tracing,
+// ui.perfetto.dev). Código portável.
+//
+// Os nomes precisam ser strings estáticas: só o ponteiro é guardado.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#define TRACE_DEFAULT_EVENTS 2048   // potência de 2
+#define TRACE_MAX_THREADS    16
+
+typedef void (*trace_write_fn)(void *ctx, const char *data, size_t len);
+
+typedef struct {
+  const char *name;
+  char phase;       // 'B', 'E' ou 'i'
+  uint8_t thread;
+  uint32_t arg;
+  int64_t ts;       // µs
+} trace_record_t;
+
+typedef void (*trace_visit_fn)(void *ctx, const trace_record_t *rec);
+
+// Aloca o anel (PSRAM quando houver); antes disso os eventos são ignorados
+bool trace_init(size_t events);
+void trace_set_enabled(bool enabled);
+bool trace_enabled();
+
+void trace_begin(const char *name, uint32_t arg);
+void trace_end(const char *name);
+void trace_instant(const char *name, uint32_t arg);
+// Devolve o slot de linha do tempo da tarefa atual, que vai terminar
+// (sessões de fluxo e conexões RTSP: uma tarefa por cliente)
+void trace_thread_exit();
+
+// Percorre, em ordem, os eventos dos últimos window_us microssegundos
+// (0 = todo o anel) e retorna quantos foram visitados
+size_t trace_foreach(trace_visit_fn visit, void *ctx, int64_t window_us);
+const char *trace_thread_name(int thread);
+// Mesmo recorte de trace_foreach, escrito como JSON do Chrome/Perfetto
+size_t trace_dump(trace_write_fn write, void *ctx, int64_t window_us);
+
+#endif
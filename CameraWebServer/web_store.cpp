@@ -0,0 +1,143 @@
+#include "web_store.h"
+#include "webfs.h"
+#include <string.h>
+#include "esp_partition.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#include "esp32-hal-log.h"
+
+#define WEB_STORE_PARTITION "fr"
+#define WEB_STORE_SECTOR    4096
+
+static const esp_partition_t *part = NULL;
+static const void *map_ptr = NULL;
+static esp_partition_mmap_handle_t map_handle;
+static web_asset_t assets[WEBFS_MAX_ENTRIES];
+static int assets_count = 0;
+// Protege a tabela contra troca durante um upload concorrente
+static SemaphoreHandle_t lock = NULL;
+static size_t update_size = 0;
+static size_t update_written = 0;
+
+static void unmap() {
+  assets_count = 0;
+  if (map_ptr) {
+    esp_partition_munmap(map_handle);
+    map_ptr = NULL;
+  }
+}
+
+static bool map() {
+  if (esp_partition_mmap(part, 0, part->size, ESP_PARTITION_MMAP_DATA, &map_ptr, &map_handle) != ESP_OK) {
+    log_e("Falha ao mapear a partição '%s'", WEB_STORE_PARTITION);
+    map_ptr = NULL;
+    return false;
+  }
+  const uint8_t *base = (const uint8_t *)map_ptr;
+  const char *err = webfs_validate(base, part->size);
+  if (err) {
+    log_w("Partição '%s' sem páginas válidas (%s); usando as embutidas", WEB_STORE_PARTITION, err);
+    unmap();
+    return false;
+  }
+  const webfs_header_t *h = (const webfs_header_t *)base;
+  const webfs_entry_t *e = webfs_entries(base);
+  for (int i = 0; i < h->count; i++) {
+    assets[i].name = e[i].name;
+    assets[i].content_type = e[i].content_type;
+    assets[i].data = base + e[i].offset;
+    assets[i].len = e[i].len;
+    assets[i].etag = e[i].etag;
+  }
+  assets_count = h->count;
+  log_i("Partição '%s': %d páginas, %u bytes", WEB_STORE_PARTITION, assets_count, (unsigned)h->size);
+  return true;
+}
+
+bool web_store_begin() {
+  if (!lock) {
+    lock = xSemaphoreCreateMutex();
+  }
+  part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, WEB_STORE_PARTITION);
+  if (!part) {
+    log_w("Partição '%s' não encontrada; usando páginas embutidas", WEB_STORE_PARTITION);
+    return false;
+  }
+  xSemaphoreTake(lock, portMAX_DELAY);
+  unmap();
+  bool ok = map();
+  xSemaphoreGive(lock);
+  return ok;
+}
+
+const web_asset_t *web_store_get(const web_asset_t *builtin) {
+  const web_asset_t *found = builtin;
+  if (!lock || !xSemaphoreTake(lock, 0)) {
+    return builtin;
+  }
+  for (int i = 0; i < assets_count; i++) {
+    if (!strcmp(assets[i].name, builtin->name)) {
+      found = &assets[i];
+      break;
+    }
+  }
+  xSemaphoreGive(lock);
+  return found;
+}
+
+int web_store_count() {
+  return assets_count;
+}
+
+const web_asset_t *web_store_at(int i) {
+  return (i >= 0 && i < assets_count) ? &assets[i] : NULL;
+}
+
+esp_err_t web_store_update_begin(size_t size) {
+  if (!part || !lock) {
+    return ESP_ERR_NOT_FOUND;
+  }
+  if (size < sizeof(webfs_header_t) || size > part->size) {
+    return ESP_ERR_INVALID_SIZE;
+  }
+  xSemaphoreTake(lock, portMAX_DELAY);
+  // Mantido até update_end: web_store_get devolve as embutidas enquanto isso
+  unmap();
+  size_t erase = (size + WEB_STORE_SECTOR - 1) / WEB_STORE_SECTOR * WEB_STORE_SECTOR;
+  esp_err_t err = esp_partition_erase_range(part, 0, erase);
+  if (err != ESP_OK) {
+    xSemaphoreGive(lock);
+    return err;
+  }
+  update_size = size;
+  update_written = 0;
+  return ESP_OK;
+}
+
+esp_err_t web_store_update_write(const uint8_t *data, size_t len) {
+  if (update_written + len > update_size) {
+    return ESP_ERR_INVALID_SIZE;
+  }
+  esp_err_t err = esp_partition_write(part, update_written, data, len);
+  if (err == ESP_OK) {
+    update_written += len;
+  }
+  return err;
+}
+
+const char *web_store_update_end() {
+  const char *err = NULL;
+  if (update_written != update_size) {
+    err = "upload incompleto";
+  } else if (!map()) {
+    err = "arquivo inválido";
+  }
+  if (err) {
+    // Sem cabeçalho válido o boot seguinte também cai nas embutidas
+    esp_partition_erase_range(part, 0, WEB_STORE_SECTOR);
+  }
+  update_size = update_written = 0;
+  xSemaphoreGive(lock);
+  return err;
+}
@@ -0,0 +1,26 @@
+#ifndef WEB_STORE_H
+#define WEB_STORE_H
+
+// Páginas servidas direto da partição "fr" (formato em webfs.h), mapeada
+// na memória: sem cópia para a RAM e atualizáveis sem regravar o firmware.
+// Páginas ausentes ou arquivo inválido caem nas versões embutidas.
+
+#include "esp_err.h"
+#include "camera_index.h"
+
+// Mapeia a partição e valida o arquivo; retorna true se houver páginas nela
+bool web_store_begin();
+// Versão da partição com o mesmo nome, se houver; senão o próprio asset
+const web_asset_t *web_store_get(const web_asset_t *builtin);
+// Quantidade de páginas mapeadas (0 = usando só as embutidas)
+int web_store_count();
+const web_asset_t *web_store_at(int i);
+
+// Atualização em partes (upload HTTP): apaga a partição, grava e remapeia.
+// Durante a atualização as páginas embutidas são usadas.
+esp_err_t web_store_update_begin(size_t size);
+esp_err_t web_store_update_write(const uint8_t *data, size_t len);
+// Retorna NULL em caso de sucesso ou a descrição do erro
+const char *web_store_update_end();
+
+#endif
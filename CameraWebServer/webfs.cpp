@@ -0,0 +1,65 @@
+#include "webfs.h"
+#include <string.h>
+
+static_assert(sizeof(webfs_header_t) == 16, "webfs_header_t deve ter 16 bytes");
+static_assert(sizeof(webfs_entry_t) == 96, "webfs_entry_t deve ter 96 bytes");
+
+uint32_t webfs_crc32(uint32_t crc, const uint8_t *data, size_t len) {
+  // Tabela de 4 bits: compacta e rápida o bastante para 128 KB no boot
+  static const uint32_t table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+  };
+  crc = ~crc;
+  while (len--) {
+    crc ^= *data++;
+    crc = (crc >> 4) ^ table[crc & 0x0F];
+    crc = (crc >> 4) ^ table[crc & 0x0F];
+  }
+  return ~crc;
+}
+
+const webfs_entry_t *webfs_entries(const uint8_t *base) {
+  return (const webfs_entry_t *)(base + sizeof(webfs_header_t));
+}
+
+const char *webfs_validate(const uint8_t *base, size_t avail) {
+  const webfs_header_t *h = (const webfs_header_t *)base;
+  if (avail < sizeof(webfs_header_t) || memcmp(h->magic, WEBFS_MAGIC, 4) != 0) {
+    return "assinatura ausente";
+  }
+  if (h->version != WEBFS_VERSION) {
+    return "versão desconhecida";
+  }
+  size_t table_end = sizeof(webfs_header_t) + (size_t)h->count * sizeof(webfs_entry_t);
+  if (h->count > WEBFS_MAX_ENTRIES || h->size > avail || table_end > h->size) {
+    return "tamanho inválido";
+  }
+  if (webfs_crc32(0, base + sizeof(webfs_header_t), h->size - sizeof(webfs_header_t)) != h->crc32) {
+    return "CRC não confere";
+  }
+  const webfs_entry_t *e = webfs_entries(base);
+  for (int i = 0; i < h->count; i++) {
+    if (!memchr(e[i].name, 0, WEBFS_NAME_LEN) || !memchr(e[i].content_type, 0, WEBFS_TYPE_LEN) || !memchr(e[i].etag, 0, WEBFS_ETAG_LEN)) {
+      return "entrada sem terminador";
+    }
+    if (e[i].offset < table_end || e[i].offset > h->size || e[i].len > h->size - e[i].offset) {
+      return "entrada fora do arquivo";
+    }
+    if (!(e[i].flags & WEBFS_FLAG_GZIP)) {
+      return "entrada sem gzip";
+    }
+  }
+  return NULL;
+}
+
+const webfs_entry_t *webfs_find(const uint8_t *base, const char *name) {
+  const webfs_header_t *h = (const webfs_header_t *)base;
+  const webfs_entry_t *e = webfs_entries(base);
+  for (int i = 0; i < h->count; i++) {
+    if (!strcmp(e[i].name, name)) {
+      return &e[i];
+    }
+  }
+  return NULL;
+}
@@ -0,0 +1,44 @@
+#ifndef WEBFS_H
+#define WEBFS_H
+
+// Formato do arquivo de páginas gravado na partição "fr" (little endian).
+// Gerado e conferido no host por tools/mkwebfs; lido no lugar (mmap) pelo
+// firmware. Código portável.
+//
+//   cabeçalho (16 B) | entradas (96 B cada) | dados gzip alinhados em 4 B
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define WEBFS_MAGIC      "WFS1"
+#define WEBFS_VERSION    1
+#define WEBFS_NAME_LEN   40
+#define WEBFS_TYPE_LEN   24
+#define WEBFS_ETAG_LEN   20
+#define WEBFS_FLAG_GZIP  0x01
+#define WEBFS_MAX_ENTRIES 32
+
+typedef struct {
+  char magic[4];
+  uint16_t version;
+  uint16_t count;
+  uint32_t size;     // tamanho total do arquivo
+  uint32_t crc32;    // CRC-32 de tudo o que vem depois do cabeçalho
+} webfs_header_t;
+
+typedef struct {
+  char name[WEBFS_NAME_LEN];
+  char content_type[WEBFS_TYPE_LEN];
+  char etag[WEBFS_ETAG_LEN];
+  uint32_t offset;   // a partir do início do arquivo
+  uint32_t len;
+  uint32_t flags;
+} webfs_entry_t;
+
+uint32_t webfs_crc32(uint32_t crc, const uint8_t *data, size_t len);
+// Retorna NULL se o arquivo for válido ou a descrição do problema.
+const char *webfs_validate(const uint8_t *base, size_t avail);
+const webfs_entry_t *webfs_entries(const uint8_t *base);
+const webfs_entry_t *webfs_find(const uint8_t *base, const char *name);
+
+#endif
@@ -1,4 +1,20 @@
 #include "wifi_manager.h"
+#include "web_store.h"
+#include "trace.h"
+#include "metrics.h"
+#include "esp_timer.h"
+
+// Na reconexão, uma varredura completa a cada tantas falhas da conexão direta
+// (o AP pode ter mudado de canal)
+#define DIRECT_FAILURES_PER_SCAN 10
+
+// Tarefa do portal: acima do loop(), para responder em poucos ms mesmo com o
+// loop() ocupado; entre as rodadas de HTTP/DNS só dorme PORTAL_POLL_MS
+#define PORTAL_TASK_STACK 6144
+#define PORTAL_TASK_PRIORITY 2
+#define PORTAL_POLL_MS 5
+// Lista de redes mais velha que isso: o /scan pede outra varredura
+#define PORTAL_SCAN_MAX_AGE_MS 30000
 
 WiFiManager::WiFiManager() {
     server = nullptr;
@@ -10,12 +26,52 @@ WiFiManager::WiFiManager() {
     configMode = false;
     connectionAttempts = 0;
     maxConnectionAttempts = 5;
+    connectTimeoutMs = 10000;
+    directTimeoutMs = 3000;
+    backoffMinMs = 250;
+    backoffMaxMs = 4000;
+    hasNetworkCache = false;
+    memset(cachedBSSID, 0, sizeof(cachedBSSID));
+    cachedChannel = 0;
+    state = WIFI_STATE_IDLE;
+    stateCallback = nullptr;
+    stateSince = 0;
+    phaseDeadline = 0;
+    attemptDeadline = 0;
+    directAttempt = false;
+    directFailures = 0;
+    cachedIPStale = false;
+    attemptActive = false;
+    retryCount = 0;
+    nextAttemptAt = 0;
+    reconnectCount = 0;
+    downtimeMs = 0;
+    linkDownSince = 0;
+    restartAt = 0;
+    gotIP = false;
+    linkLost = false;
+    lastDisconnectReason = 0;
+    portalTask = nullptr;
+    portalStopped = nullptr;
+    portalRunning = false;
+    pendingConnect = false;
+    resetRequested = false;
+    resetRestartMs = 0;
+    statusLock = nullptr;
+    statusState = WIFI_STATE_IDLE;
+    statusSince = 0;
+    statusSSID[0] = '\0';
+    scanRequested = false;
+    scanRunning = false;
+    scanCount = 0;
+    scanAt = 0;
     desiredStaticHost = 200; // padrão: último octeto 200
     defaultPrimaryDNS = IPAddress(8,8,8,8);
     defaultSecondaryDNS = IPAddress(8,8,4,4);
 }
 
 WiFiManager::~WiFiManager() {
+    stopPortalTask();
     if (server) {
         delete server;
     }
@@ -24,8 +80,43 @@ WiFiManager::~WiFiManager() {
     }
 }
 
+// Eventos do WiFi aparecem no /trace junto com as tarefas da câmera
+static void traceWiFiEvent(arduino_event_id_t event) {
+    switch (event) {
+        case ARDUINO_EVENT_WIFI_STA_START: trace_instant("wifi sta start", event); break;
+        case ARDUINO_EVENT_WIFI_STA_CONNECTED: trace_instant("wifi connected", event); break;
+        case ARDUINO_EVENT_WIFI_STA_DISCONNECTED: trace_instant("wifi disconnected", event); break;
+        case ARDUINO_EVENT_WIFI_STA_GOT_IP: trace_instant("wifi got ip", event); break;
+        case ARDUINO_EVENT_WIFI_STA_LOST_IP: trace_instant("wifi lost ip", event); break;
+        case ARDUINO_EVENT_WIFI_AP_START: trace_instant("wifi ap start", event); break;
+        case ARDUINO_EVENT_WIFI_AP_STACONNECTED: trace_instant("wifi ap client", event); break;
+        default: trace_instant("wifi event", event); break;
+    }
+}
+
+// Falhas de autenticação não se resolvem esperando: senha errada
+static bool isAuthFailure(uint8_t reason) {
+    switch (reason) {
+        case 2:    // WIFI_REASON_AUTH_EXPIRE
+        case 15:   // WIFI_REASON_4WAY_HANDSHAKE_TIMEOUT
+        case 202:  // WIFI_REASON_AUTH_FAIL
+        case 204:  // WIFI_REASON_HANDSHAKE_TIMEOUT
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Retorna true se há uma conexão em andamento com as credenciais salvas; o
+// servidor da câmera pode subir já, sem esperar o IP. false: portal no ar.
 bool WiFiManager::begin() {
     preferences.begin("wifi_config", false);
+    WiFi.onEvent(traceWiFiEvent);
+    WiFi.onEvent([this](arduino_event_id_t event, arduino_event_info_t info) {
+        onWiFiEvent(event, info);
+    });
+    // As novas tentativas são desta classe (conexão direta primeiro)
+    WiFi.setAutoReconnect(false);
     
     // Carregar credenciais salvas
     loadStoredCredentials();
@@ -37,20 +128,12 @@ bool WiFiManager::begin() {
         return false;
     }
     
-    // Tentar conectar com credenciais salvas
-    if (connectToWiFi()) {
-        Serial.println("Conectado ao WiFi salvo!");
-        hasConnectedOnce = true;
-        return true;
-    } else {
-        Serial.println("Falha ao conectar com WiFi salvo. Iniciando modo AP...");
-        startAP();
-        return false;
-    }
+    return connectToWiFi();
 }
 
 void WiFiManager::startAP() {
-    WiFi.mode(WIFI_AP);
+    // Estação ligada (sem conectar) para a varredura da lista de redes
+    WiFi.mode(WIFI_AP_STA);
     WiFi.softAP(apSSID.c_str(), apPassword.c_str());
     
     IPAddress apIP(192, 168, 4, 1);
@@ -62,13 +145,20 @@ void WiFiManager::startAP() {
     Serial.print("IP: ");
     Serial.println(WiFi.softAPIP());
     
-    Serial.println("Inicializando servidor de configuração...");
     configMode = true;
+    // Antes de subir o portal: quem usa a porta 80 precisa liberá-la
+    setState(WIFI_STATE_PORTAL);
+    Serial.println("Inicializando servidor de configuração...");
     startConfigServer();
 }
 
 void WiFiManager::stopAP() {
     Serial.println("Parando modo AP e servidor de configuração...");
+    stopPortalTask();
+    if (scanRunning) {
+        WiFi.scanDelete();
+        scanRunning = false;
+    }
     if (server) {
         server->stop();
         delete server;
@@ -98,17 +188,72 @@ bool WiFiManager::loadStoredCredentials() {
     savedPassword = preferences.getString("password", "");
     hasStoredCredentials = (savedSSID.length() > 0);
     hasConnectedOnce = preferences.getBool("connected_once", false);
+    loadNetworkCache();
+    publishStatus();
     return hasStoredCredentials;
 }
 
+void WiFiManager::loadNetworkCache() {
+    hasNetworkCache = preferences.getBytes("bssid", cachedBSSID, sizeof(cachedBSSID)) == sizeof(cachedBSSID);
+    cachedChannel = preferences.getUChar("channel", 0);
+    cachedIP = IPAddress(preferences.getUInt("ip", 0));
+    cachedGateway = IPAddress(preferences.getUInt("gateway", 0));
+    cachedSubnet = IPAddress(preferences.getUInt("subnet", 0));
+    hasNetworkCache = hasNetworkCache && cachedChannel > 0 && (uint32_t)cachedIP != 0 && (uint32_t)cachedSubnet != 0;
+}
+
+// Grava só o que mudou: a cada conexão direta nada vai para a flash
+void WiFiManager::saveNetworkCache() {
+    uint8_t* bssid = WiFi.BSSID();
+    uint8_t channel = WiFi.channel();
+    IPAddress ip = WiFi.localIP();
+    IPAddress gw = WiFi.gatewayIP();
+    IPAddress mask = WiFi.subnetMask();
+    if (!bssid || !channel || (uint32_t)ip == 0) {
+        return;
+    }
+    if (hasNetworkCache && !memcmp(bssid, cachedBSSID, 6) && channel == cachedChannel && ip == cachedIP && gw == cachedGateway &&
+        mask == cachedSubnet) {
+        return;
+    }
+    preferences.putBytes("bssid", bssid, 6);
+    preferences.putUChar("channel", channel);
+    preferences.putUInt("ip", (uint32_t)ip);
+    preferences.putUInt("gateway", (uint32_t)gw);
+    preferences.putUInt("subnet", (uint32_t)mask);
+    memcpy(cachedBSSID, bssid, 6);
+    cachedChannel = channel;
+    cachedIP = ip;
+    cachedGateway = gw;
+    cachedSubnet = mask;
+    hasNetworkCache = true;
+    Serial.printf("Enlace salvo para conexão direta: canal %u, IP %s\n", channel, ip.toString().c_str());
+}
+
+void WiFiManager::clearNetworkCache() {
+    if (hasNetworkCache) {
+        preferences.remove("bssid");
+        preferences.remove("channel");
+        preferences.remove("ip");
+        preferences.remove("gateway");
+        preferences.remove("subnet");
+    }
+    hasNetworkCache = false;
+}
+
 void WiFiManager::saveCredentials(const String& ssid, const String& password) {
     preferences.putString("ssid", ssid);
     preferences.putString("password", password);
-    preferences.putBool("connected_once", true);
+    // connected_once só depois do primeiro IP com esta rede
+    preferences.putBool("connected_once", false);
+    if (ssid != savedSSID) {
+        clearNetworkCache();
+    }
     savedSSID = ssid;
     savedPassword = password;
     hasStoredCredentials = true;
-    hasConnectedOnce = true;
+    hasConnectedOnce = false;
+    publishStatus();
     Serial.println("Credenciais salvas!");
 }
 
@@ -118,7 +263,9 @@ void WiFiManager::clearCredentials() {
     savedPassword = "";
     hasStoredCredentials = false;
     hasConnectedOnce = false;
+    hasNetworkCache = false;
     connectionAttempts = 0;
+    publishStatus();
     Serial.println("Credenciais WiFi removidas!");
 }
 
@@ -133,29 +280,159 @@ bool WiFiManager::connectToWiFi(const String& ssid, const String& password) {
     Serial.print("Tentando conectar ao WiFi: ");
     Serial.println(ssid);
     
-    WiFi.mode(WIFI_STA);
-    WiFi.begin(ssid.c_str(), password.c_str());
-    
-    int attempts = 0;
-    while (WiFi.status() != WL_CONNECTED && attempts < 20) {
-        delay(500);
-        Serial.print(".");
-        attempts++;
+    savedSSID = ssid;
+    savedPassword = password;
+    publishStatus();
+    phaseDeadline = millis() + connectTimeoutMs;
+    setState(configMode ? WIFI_STATE_PORTAL_CONNECTING : WIFI_STATE_CONNECTING);
+    beginAttempt(hasNetworkCache && !configMode);
+    return true;
+}
+
+// Direta: BSSID/canal conhecidos, sem varredura. Com o enlace no cache, o IP
+// fixo é aplicado antes de associar (o endereço não muda depois e não há
+// DHCP). Depois de uma tentativa que falhou (roteador trocado, outra rede)
+// o IP do cache não é mais confiável: direta ou varredura, vai por DHCP.
+void WiFiManager::beginAttempt(bool direct) {
+    gotIP = false;
+    linkLost = false;
+    lastDisconnectReason = 0;
+    directAttempt = direct;
+    attemptActive = true;
+    // No portal a estação sobe junto com o softAP, que continua respondendo
+    WiFi.mode(configMode ? WIFI_AP_STA : WIFI_STA);
+    if (hasNetworkCache && !cachedIPStale) {
+        WiFi.config(cachedIP, cachedGateway, cachedSubnet, defaultPrimaryDNS, defaultSecondaryDNS);
+    } else {
+        WiFi.config(IPAddress(), IPAddress(), IPAddress());
     }
-    
-    if (WiFi.status() == WL_CONNECTED) {
-        Serial.println("");
-        Serial.println("WiFi conectado!");
-        Serial.print("IP: ");
-        Serial.println(WiFi.localIP());
-        connectionAttempts = 0;
-        return true;
+    if (direct) {
+        WiFi.begin(savedSSID.c_str(), savedPassword.c_str(), cachedChannel, cachedBSSID);
     } else {
-        Serial.println("");
-        Serial.println("Falha na conexão WiFi!");
-        connectionAttempts++;
-        return false;
+        WiFi.begin(savedSSID.c_str(), savedPassword.c_str());
     }
+    unsigned long now = millis();
+    attemptDeadline = now + (direct ? directTimeoutMs : connectTimeoutMs);
+    metrics_wifi_attempt(esp_timer_get_time());
+    trace_instant(direct ? "wifi attempt direct" : "wifi attempt scan", 0);
+}
+
+// Tarefa de eventos do WiFi: só anota; quem decide é handleWiFiConnection()
+void WiFiManager::onWiFiEvent(arduino_event_id_t event, arduino_event_info_t info) {
+    switch (event) {
+        case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+            gotIP = true;
+            break;
+        case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+            lastDisconnectReason = info.wifi_sta_disconnected.reason;
+            linkLost = true;
+            break;
+        default:
+            break;
+    }
+}
+
+void WiFiManager::setState(wifi_state_t next) {
+    if (next == state) {
+        return;
+    }
+    wifi_state_t previous = state;
+    state = next;
+    stateSince = millis();
+    publishStatus();
+    Serial.printf("WiFi: %s -> %s\n", stateName(previous), stateName(next));
+    trace_instant("wifi state", next);
+    if (stateCallback) {
+        stateCallback(next, previous);
+    }
+}
+
+void WiFiManager::onConnected() {
+    metrics_wifi_connected(esp_timer_get_time(), directAttempt);
+    Serial.printf("WiFi conectado (%s)! IP: %s\n", directAttempt ? "direto" : "varredura", WiFi.localIP().toString().c_str());
+    connectionAttempts = 0;
+    directFailures = 0;
+    retryCount = 0;
+    attemptActive = false;
+    if (state == WIFI_STATE_RECONNECTING) {
+        reconnectCount++;
+        downtimeMs += millis() - linkDownSince;
+        Serial.printf("Reconexão %u após %lu ms sem enlace\n", reconnectCount, millis() - linkDownSince);
+    }
+    if (!hasConnectedOnce) {
+        preferences.putBool("connected_once", true);
+        hasConnectedOnce = true;
+    }
+    if (hasNetworkCache && cachedIPStale && WiFi.gatewayIP() == cachedGateway && WiFi.subnetMask() == cachedSubnet) {
+        // DHCP na mesma rede de antes: volta ao IP fixo do cache
+        if (!setStaticIP(cachedIP, cachedGateway, cachedSubnet, defaultPrimaryDNS, defaultSecondaryDNS)) {
+            Serial.println("Não foi possível aplicar IP fixo; permanecendo em DHCP.");
+        }
+    } else if (!hasNetworkCache || cachedIPStale || !(WiFi.localIP() == cachedIP)) {
+        // Veio do DHCP (primeira conexão ou gateway diferente do cache): IP
+        // fixo calculado a partir do gateway real; fica no cache e nas
+        // próximas conexões já é aplicado antes de associar
+        if (computeAndApplyStaticIP()) {
+            Serial.println("IP fixo aplicado com sucesso após conexão.");
+        } else {
+            Serial.println("Não foi possível aplicar IP fixo; permanecendo em DHCP.");
+        }
+    }
+    cachedIPStale = false;
+    saveNetworkCache();
+    if (state == WIFI_STATE_PORTAL_CONNECTING) {
+        stopAP();
+    }
+    setState(WIFI_STATE_CONNECTED);
+}
+
+void WiFiManager::onAttemptFailed(const char* why) {
+    Serial.printf("Falha na conexão WiFi (%s, motivo %u)\n", why, lastDisconnectReason);
+    bool authFailure = isAuthFailure(lastDisconnectReason);
+    cachedIPStale = true;
+    if (state == WIFI_STATE_RECONNECTING) {
+        // Já conectou com esta rede: nova tentativa depois do backoff
+        // Depois de uma varredura, volta às tentativas diretas
+        directFailures = directAttempt ? directFailures + 1 : 0;
+        attemptActive = false;
+        uint32_t wait = nextBackoffMs();
+        nextAttemptAt = millis() + wait;
+        Serial.printf("Nova tentativa em %lu ms\n", (unsigned long)wait);
+        return;
+    }
+    if (directAttempt && !authFailure) {
+        Serial.println("Conexão direta falhou; fazendo varredura completa...");
+        beginAttempt(false);
+        return;
+    }
+    if (!authFailure && (long)(millis() - phaseDeadline) < 0) {
+        beginAttempt(false);
+        return;
+    }
+    connectionAttempts++;
+    if (state == WIFI_STATE_CONNECTING && hasConnectedOnce && !authFailure) {
+        // Rede conhecida fora do ar (o roteador demora mais que a câmera
+        // para voltar de uma queda de energia): segue tentando, sem portal
+        Serial.println("WiFi salvo não respondeu; tentando em segundo plano...");
+        linkDownSince = millis();
+        setState(WIFI_STATE_RECONNECTING);
+        attemptActive = false;
+        nextAttemptAt = millis() + nextBackoffMs();
+        return;
+    }
+    if (state == WIFI_STATE_PORTAL_CONNECTING) {
+        // Credenciais do formulário não funcionaram: o portal segue no ar
+        // (a estação continua ligada para as próximas varreduras)
+        WiFi.disconnect();
+        setState(WIFI_STATE_PORTAL);
+        return;
+    }
+    if (!hasConnectedOnce && connectionAttempts >= maxConnectionAttempts) {
+        Serial.println("Muitas tentativas de conexão. Resetando WiFi...");
+        clearCredentials();
+    }
+    Serial.println("Falha ao conectar com WiFi salvo. Iniciando modo AP...");
+    startAP();
 }
 
 void WiFiManager::setDesiredStaticHost(uint8_t host) {
@@ -183,26 +460,154 @@ bool WiFiManager::computeAndApplyStaticIP() {
 }
 
 void WiFiManager::handleWiFiConnection() {
-    // Se estivermos no modo de configuração, não tentar reconectar nem imprimir mensagens
-    if (configMode) {
-        return;
+    unsigned long now = millis();
+    if (restartAt && (long)(now - restartAt) >= 0) {
+        ESP.restart();
     }
-    if (WiFi.status() != WL_CONNECTED) {
-        if (hasStoredCredentials && !hasConnectedOnce) {
-            // Primeira tentativa com novo WiFi
-            if (connectionAttempts >= maxConnectionAttempts) {
-                Serial.println("Muitas tentativas de conexão. Resetando WiFi...");
-                clearCredentials();
-                startAP();
+    if (__atomic_load_n(&resetRequested, __ATOMIC_ACQUIRE)) {
+        // Pedido por um /reset, que já respondeu
+        resetRequested = false;
+        clearCredentials();
+        scheduleRestart(resetRestartMs);
+    }
+    
+    bool up = gotIP;
+    if (up) {
+        gotIP = false;
+    }
+    bool lost = linkLost;
+    if (lost) {
+        linkLost = false;
+    }
+    // O GOT_IP pode ter sido seguido de uma queda ainda não vista
+    up = up && WiFi.status() == WL_CONNECTED;
+    
+    switch (state) {
+        case WIFI_STATE_RECONNECTING:
+            if (!attemptActive) {
+                if ((long)(now - nextAttemptAt) >= 0) {
+                    bool direct = hasNetworkCache && !isAuthFailure(lastDisconnectReason) &&
+                                  (directFailures == 0 || directFailures % DIRECT_FAILURES_PER_SCAN != 0);
+                    beginAttempt(direct);
+                }
+                break;
             }
-        } else if (hasStoredCredentials && hasConnectedOnce) {
-            // Já conectou antes, não resetar automaticamente
-            Serial.println("WiFi desconectado, mas credenciais mantidas.");
-        }
+            // fall through
+        case WIFI_STATE_CONNECTING:
+        case WIFI_STATE_PORTAL_CONNECTING:
+            // Sem reconexão automática do driver, cada queda encerra a tentativa
+            if (up) {
+                onConnected();
+            } else if (lost) {
+                onAttemptFailed(isAuthFailure(lastDisconnectReason) ? "autenticação" : "desconectado");
+            } else if ((long)(now - attemptDeadline) >= 0) {
+                onAttemptFailed("tempo esgotado");
+            }
+            break;
+        case WIFI_STATE_CONNECTED:
+            if (lost) {
+                // Já conectou antes, não resetar: reconecta direto pelo cache
+                Serial.printf("WiFi desconectado (motivo %u), credenciais mantidas.\n", lastDisconnectReason);
+                linkDownSince = now;
+                retryCount = 0;
+                directFailures = 0;
+                setState(WIFI_STATE_RECONNECTING);
+                beginAttempt(hasNetworkCache);
+            }
+            break;
+        case WIFI_STATE_PORTAL:
+            // /save: a conexão começa aqui, depois de uma varredura em curso
+            // (a tarefa do portal não inicia outra com pendingConnect)
+            if (__atomic_load_n(&pendingConnect, __ATOMIC_ACQUIRE) && !scanRunning) {
+                String ssid = pendingSSID;
+                String password = pendingPassword;
+                __atomic_store_n(&pendingConnect, false, __ATOMIC_RELEASE);
+                saveCredentials(ssid, password);
+                connectToWiFi(ssid, password);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void WiFiManager::onStateChange(wifi_state_cb_t callback) {
+    stateCallback = callback;
+}
+
+wifi_state_t WiFiManager::getState() {
+    return state;
+}
+
+const char* WiFiManager::stateName(wifi_state_t state) {
+    switch (state) {
+        case WIFI_STATE_IDLE: return "idle";
+        case WIFI_STATE_CONNECTING: return "connecting";
+        case WIFI_STATE_CONNECTED: return "connected";
+        case WIFI_STATE_RECONNECTING: return "reconnecting";
+        case WIFI_STATE_PORTAL: return "portal";
+        case WIFI_STATE_PORTAL_CONNECTING: return "portal_connecting";
+    }
+    return "unknown";
+}
+
+// Só o loop() chama; a tarefa do portal lê a cópia no /wifi
+void WiFiManager::publishStatus() {
+    if (!statusLock) {
+        statusLock = xSemaphoreCreateMutex();
+    }
+    xSemaphoreTake(statusLock, portMAX_DELAY);
+    statusState = state;
+    statusSince = stateSince;
+    snprintf(statusSSID, sizeof(statusSSID), "%s", savedSSID.c_str());
+    xSemaphoreGive(statusLock);
+}
+
+unsigned long WiFiManager::getStateAge() {
+    return millis() - stateSince;
+}
+
+uint8_t WiFiManager::getLastDisconnectReason() {
+    return lastDisconnectReason;
+}
+
+uint32_t WiFiManager::getReconnectCount() {
+    return reconnectCount;
+}
+
+unsigned long WiFiManager::getDowntimeMs() {
+    if (state == WIFI_STATE_RECONNECTING) {
+        return downtimeMs + (millis() - linkDownSince);
+    }
+    return downtimeMs;
+}
+
+// Exponencial a partir de backoffMinMs até backoffMaxMs; metade fixa e
+// metade aleatória, para várias câmeras não tentarem juntas quando o
+// roteador volta
+uint32_t WiFiManager::nextBackoffMs() {
+    uint32_t ceiling = backoffMaxMs;
+    if (retryCount < 16 && (backoffMinMs << retryCount) < backoffMaxMs) {
+        ceiling = backoffMinMs << retryCount;
+    }
+    retryCount++;
+    return ceiling / 2 + random(ceiling / 2 + 1);
+}
+
+void WiFiManager::requestReset(uint32_t delayMs) {
+    resetRestartMs = delayMs;
+    __atomic_store_n(&resetRequested, true, __ATOMIC_RELEASE);
+}
+
+void WiFiManager::scheduleRestart(uint32_t delayMs) {
+    restartAt = millis() + delayMs;
+    if (restartAt == 0) {
+        restartAt = 1;
     }
 }
 
 void WiFiManager::startConfigServer() {
+    stopPortalTask();
     if (server) {
         delete server;
     }
@@ -213,6 +618,10 @@ void WiFiManager::startConfigServer() {
     server = new WebServer(80);
     dnsServer = new DNSServer();
     
+    // Necessário para responder 304 às páginas já em cache
+    const char* cacheHeaders[] = {"If-None-Match"};
+    server->collectHeaders(cacheHeaders, 1);
+    
     // Configurar DNS para capturar todas as requisições
     IPAddress apIp = WiFi.softAPIP();
     Serial.print("DNS será iniciado apontando para ");
@@ -221,7 +630,7 @@ void WiFiManager::startConfigServer() {
     
     // Rota principal - página de configuração
     server->on("/", [this]() {
-        server->send(200, "text/html", getConfigPageHTML());
+        sendAsset(asset_wifi_config_html);
     });
     
     // Rota para salvar configuração
@@ -230,47 +639,193 @@ void WiFiManager::startConfigServer() {
         String password = server->arg("password");
         
         if (ssid.length() > 0) {
-            saveCredentials(ssid, password);
-            server->send(200, "text/html", getSuccessPageHTML());
-            
-            // Aguardar um pouco e tentar conectar
-            delay(2000);
-            if (connectToWiFi(ssid, password)) {
-                Serial.println("Conectado! Parando servidor de configuração...");
-                // Aplicar IP fixo calculado baseado no gateway real
-                if (computeAndApplyStaticIP()) {
-                    Serial.println("IP fixo aplicado com sucesso após conexão.");
-                } else {
-                    Serial.println("Não foi possível aplicar IP fixo; permanecendo em DHCP.");
-                }
-                stopAP();
+            // Gravação e conexão ficam com o loop(), em handleWiFiConnection();
+            // um segundo envio antes disso não troca as credenciais
+            if (!__atomic_load_n(&pendingConnect, __ATOMIC_ACQUIRE)) {
+                pendingSSID = ssid;
+                pendingPassword = password;
+                __atomic_store_n(&pendingConnect, true, __ATOMIC_RELEASE);
             }
+            sendAsset(asset_wifi_success_html);
         } else {
-            server->send(200, "text/html", getErrorPageHTML());
+            sendAsset(asset_wifi_error_html);
+        }
+    });
+    
+    // Progresso da conexão, para a página de sucesso acompanhar
+    server->on("/wifi", [this]() {
+        char ssid[sizeof(statusSSID)];
+        xSemaphoreTake(statusLock, portMAX_DELAY);
+        wifi_state_t current = statusState;
+        unsigned long age = millis() - statusSince;
+        memcpy(ssid, statusSSID, sizeof(ssid));
+        xSemaphoreGive(statusLock);
+        char json[160];
+        snprintf(json, sizeof(json), "{\"state\":\"%s\",\"ssid\":\"%s\",\"ms\":%lu,\"reason\":%u,\"ip\":\"%s\"}",
+                 stateName(current), ssid, age, lastDisconnectReason, WiFi.localIP().toString().c_str());
+        server->send(200, "application/json", json);
+    });
+    
+    // Redes da última varredura, já prontas; lista velha pede outra
+    server->on("/scan", [this]() {
+        if (!scanRunning && (server->hasArg("refresh") || scanCount == 0 || millis() - scanAt > PORTAL_SCAN_MAX_AGE_MS)) {
+            scanRequested = true;
         }
+        sendScanResults();
     });
     
-    // Rota para resetar WiFi
+    // Rota para resetar WiFi: a NVS é apagada pelo loop(), como no /save
     server->on("/reset", [this]() {
-        clearCredentials();
-        server->send(200, "text/html", 
-            "<html><body><h1>WiFi Resetado!</h1><p>Reiniciando em 3 segundos...</p>"
-            "<script>setTimeout(function(){window.location.href='/';}, 3000);</script>"
-            "</body></html>");
-        delay(3000);
-        ESP.restart();
+        requestReset(3000);
+        sendAsset(asset_portal_reset_html);
+    });
+    
+    // Qualquer outra URL (checagens de conectividade do celular, como
+    // /generate_204) leva à página do portal, que o sistema então abre
+    server->onNotFound([this]() {
+        server->sendHeader("Location", "http://" + WiFi.softAPIP().toString() + "/", true);
+        server->send(302, "text/plain", "");
     });
     
     server->begin();
     Serial.println("Servidor de configuração iniciado!");
-    if (server && dnsServer) {
-        Serial.println("Servidor web e DNS ativos para configuração.");
-    } else {
-        Serial.println("Falha ao iniciar servidor web ou DNS.");
+    
+    // Lista de redes pronta quando a página abrir
+    scanRequested = true;
+    if (!portalStopped) {
+        portalStopped = xSemaphoreCreateBinary();
+    }
+    portalRunning = true;
+    if (xTaskCreate(portalTaskMain, "portal", PORTAL_TASK_STACK, this, PORTAL_TASK_PRIORITY, &portalTask) != pdPASS) {
+        portalRunning = false;
+        portalTask = nullptr;
+        Serial.println("Falha ao criar a tarefa do portal.");
+        return;
+    }
+    Serial.println("Servidor web e DNS ativos para configuração.");
+}
+
+void WiFiManager::portalTaskMain(void* arg) {
+    WiFiManager* self = (WiFiManager*)arg;
+    while (self->portalRunning) {
+        self->handleConfigServer();
+        self->serviceScan();
+        vTaskDelay(PORTAL_POLL_MS / portTICK_PERIOD_MS);
+    }
+    xSemaphoreGive(self->portalStopped);
+    vTaskDelete(NULL);
+}
+
+// Espera a tarefa terminar a rodada em curso (o WebServer tem timeouts
+// próprios) antes de server/dnsServer serem apagados
+void WiFiManager::stopPortalTask() {
+    if (!portalTask) {
+        return;
+    }
+    portalRunning = false;
+    xSemaphoreTake(portalStopped, portMAX_DELAY);
+    portalTask = nullptr;
+}
+
+// Só com o portal ocioso: durante PORTAL_CONNECTING a estação está ocupada e
+// com um /save pendente a varredura atrasaria a conexão
+void WiFiManager::serviceScan() {
+    if (scanRunning) {
+        int16_t found = WiFi.scanComplete();
+        if (found == WIFI_SCAN_RUNNING) {
+            return;
+        }
+        if (found >= 0) {
+            collectScanResults(found);
+        }
+        // Falha: fica a lista anterior
+        scanRunning = false;
+        return;
+    }
+    if (scanRequested && state == WIFI_STATE_PORTAL && !__atomic_load_n(&pendingConnect, __ATOMIC_ACQUIRE)) {
+        scanRequested = false;
+        scanRunning = WiFi.scanNetworks(true) == WIFI_SCAN_RUNNING;
+    }
+}
+
+// Uma entrada por SSID (o AP mais forte), redes ocultas fora, ordenadas
+// pelo sinal; com mais de PORTAL_SCAN_MAX ficam as mais fortes
+void WiFiManager::collectScanResults(int found) {
+    scanCount = 0;
+    for (int i = 0; i < found; i++) {
+        String ssid = WiFi.SSID(i);
+        if (ssid.length() == 0 || ssid.length() > 32) {
+            continue;
+        }
+        int32_t rssi = WiFi.RSSI(i);
+        int slot = -1;
+        for (int j = 0; j < scanCount; j++) {
+            if (ssid == scanList[j].ssid) {
+                slot = j;
+                break;
+            }
+        }
+        if (slot < 0 && scanCount < PORTAL_SCAN_MAX) {
+            slot = scanCount++;
+            scanList[slot].rssi = -128;
+        } else if (slot < 0) {
+            slot = scanCount - 1;  // a mais fraca (lista ordenada)
+        }
+        if (rssi <= scanList[slot].rssi) {
+            continue;
+        }
+        portal_network_t net;
+        snprintf(net.ssid, sizeof(net.ssid), "%s", ssid.c_str());
+        net.rssi = rssi;
+        net.channel = WiFi.channel(i);
+        net.secure = WiFi.encryptionType(i) != WIFI_AUTH_OPEN;
+        // Sobe até a posição do sinal
+        while (slot > 0 && scanList[slot - 1].rssi < net.rssi) {
+            scanList[slot] = scanList[slot - 1];
+            slot--;
+        }
+        scanList[slot] = net;
     }
+    WiFi.scanDelete();
+    scanAt = millis();
+    Serial.printf("Portal: %d redes na varredura\n", scanCount);
+}
+
+void WiFiManager::sendScanResults() {
+    String json;
+    json.reserve(48 + scanCount * 80);
+    json += "{\"scanning\":";
+    json += scanRunning || scanRequested ? "true" : "false";
+    json += ",\"age_ms\":";
+    json += scanCount ? (long)(millis() - scanAt) : -1L;
+    json += ",\"networks\":[";
+    for (int i = 0; i < scanCount; i++) {
+        const portal_network_t& net = scanList[i];
+        // SSID vem do ar: aspas e barras escapadas, controles descartados
+        char ssid[sizeof(net.ssid) * 2];
+        size_t n = 0;
+        for (const char* c = net.ssid; *c; c++) {
+            if ((uint8_t)*c < 0x20) {
+                continue;
+            }
+            if (*c == '"' || *c == '\\') {
+                ssid[n++] = '\\';
+            }
+            ssid[n++] = *c;
+        }
+        ssid[n] = 0;
+        char item[128];
+        snprintf(item, sizeof(item), "%s{\"ssid\":\"%s\",\"rssi\":%d,\"channel\":%u,\"secure\":%s}", i ? "," : "", ssid, net.rssi,
+                 net.channel, net.secure ? "true" : "false");
+        json += item;
+    }
+    json += "]}";
+    server->sendHeader("Cache-Control", "no-store");
+    server->send(200, "application/json", json);
 }
 
 void WiFiManager::stopConfigServer() {
+    stopPortalTask();
     if (server) {
         server->stop();
     }
@@ -280,129 +835,30 @@ void WiFiManager::stopConfigServer() {
 }
 
 void WiFiManager::handleConfigServer() {
-    // Processar requisições do servidor e DNS se estiverem ativos
-    if (!server) {
-        Serial.println("handleConfigServer: servidor web não inicializado");
-    } else {
+    // No máximo uma requisição de cada por rodada
+    if (server) {
         server->handleClient();
     }
-    if (!dnsServer) {
-        Serial.println("handleConfigServer: DNS não inicializado");
-    } else {
+    if (dnsServer) {
         dnsServer->processNextRequest();
     }
 }
 
-String WiFiManager::getConfigPageHTML() {
-    const char* html = 
-        "<!DOCTYPE html>"
-        "<html>"
-        "<head>"
-        "<meta charset=\"UTF-8\">"
-        "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1.0\">"
-        "<title>Configuração WiFi - ESP32-CAM</title>"
-        "<style>"
-        "body{font-family:Arial,sans-serif;max-width:400px;margin:50px auto;padding:20px;background:#f5f5f5}"
-        ".container{background:white;padding:30px;border-radius:10px;box-shadow:0 2px 10px rgba(0,0,0,0.1)}"
-        "h1{color:#333;text-align:center;margin-bottom:30px}"
-        ".form-group{margin-bottom:20px}"
-        "label{display:block;margin-bottom:5px;font-weight:bold;color:#555}"
-        "input[type=\"text\"],input[type=\"password\"]{width:100%;padding:12px;border:2px solid #ddd;border-radius:5px;font-size:16px;box-sizing:border-box}"
-        "input[type=\"text\"]:focus,input[type=\"password\"]:focus{border-color:#007bff;outline:none}"
-        ".btn{width:100%;padding:12px;background:#007bff;color:white;border:none;border-radius:5px;font-size:16px;cursor:pointer;margin-bottom:10px}"
-        ".btn:hover{background:#0056b3}"
-        ".btn-reset{background:#dc3545}"
-        ".btn-reset:hover{background:#c82333}"
-        ".info{background:#e7f3ff;padding:15px;border-radius:5px;margin-bottom:20px;border-left:4px solid #007bff}"
-        "</style>"
-        "</head>"
-        "<body>"
-        "<div class=\"container\">"
-        "<h1>🔧 Configuração WiFi</h1>"
-        "<div class=\"info\">"
-        "<strong>ESP32-CAM</strong><br>"
-        "Configure sua rede WiFi para acessar a câmera remotamente."
-        "</div>"
-        "<form action=\"/save\" method=\"POST\">"
-        "<div class=\"form-group\">"
-        "<label for=\"ssid\">Nome da Rede (SSID):</label>"
-        "<input type=\"text\" id=\"ssid\" name=\"ssid\" required>"
-        "</div>"
-        "<div class=\"form-group\">"
-        "<label for=\"password\">Senha:</label>"
-        "<input type=\"password\" id=\"password\" name=\"password\">"
-        "</div>"
-        "<button type=\"submit\" class=\"btn\">Conectar</button>"
-        "</form>"
-        "<button onclick=\"resetWiFi()\" class=\"btn btn-reset\">Resetar WiFi</button>"
-        "</div>"
-        "<script>"
-        "function resetWiFi(){if(confirm('Tem certeza que deseja resetar as configurações WiFi?')){window.location.href='/reset'}}"
-        "</script>"
-        "</body>"
-        "</html>";
-    return String(html);
-}
-
-String WiFiManager::getSuccessPageHTML() {
-    const char* html = 
-        "<!DOCTYPE html>"
-        "<html>"
-        "<head>"
-        "<meta charset=\"UTF-8\">"
-        "<title>Sucesso - ESP32-CAM</title>"
-        "<style>"
-        "body{font-family:Arial,sans-serif;max-width:400px;margin:50px auto;padding:20px;background:#f5f5f5}"
-        ".container{background:white;padding:30px;border-radius:10px;box-shadow:0 2px 10px rgba(0,0,0,0.1);text-align:center}"
-        ".success{color:#28a745;font-size:48px;margin-bottom:20px}"
-        "h1{color:#333;margin-bottom:20px}"
-        ".info{background:#d4edda;padding:15px;border-radius:5px;margin:20px 0;border-left:4px solid #28a745}"
-        "</style>"
-        "</head>"
-        "<body>"
-        "<div class=\"container\">"
-        "<div class=\"success\">✅</div>"
-        "<h1>Configuração Salva!</h1>"
-        "<div class=\"info\">"
-        "<strong>Conectando ao WiFi...</strong><br>"
-        "Aguarde alguns segundos e acesse a câmera pelo IP da rede."
-        "</div>"
-        "<p>Se a conexão for bem-sucedida, você será redirecionado automaticamente.</p>"
-        "</div>"
-        "</body>"
-        "</html>";
-    return String(html);
-}
-
-String WiFiManager::getErrorPageHTML() {
-    const char* html = 
-        "<!DOCTYPE html>"
-        "<html>"
-        "<head>"
-        "<meta charset=\"UTF-8\">"
-        "<title>Erro - ESP32-CAM</title>"
-        "<style>"
-        "body{font-family:Arial,sans-serif;max-width:400px;margin:50px auto;padding:20px;background:#f5f5f5}"
-        ".container{background:white;padding:30px;border-radius:10px;box-shadow:0 2px 10px rgba(0,0,0,0.1);text-align:center}"
-        ".error{color:#dc3545;font-size:48px;margin-bottom:20px}"
-        "h1{color:#333;margin-bottom:20px}"
-        ".info{background:#f8d7da;padding:15px;border-radius:5px;margin:20px 0;border-left:4px solid #dc3545}"
-        ".btn{display:inline-block;padding:10px 20px;background:#007bff;color:white;text-decoration:none;border-radius:5px;margin-top:10px}"
-        "</style>"
-        "</head>"
-        "<body>"
-        "<div class=\"container\">"
-        "<div class=\"error\">❌</div>"
-        "<h1>Erro na Configuração</h1>"
-        "<div class=\"info\">"
-        "<strong>Dados inválidos!</strong><br>"
-        "Por favor, verifique o nome da rede e tente novamente."
-        "</div>"
-        "<a href=\"/\" class=\"btn\">Tentar Novamente</a>"
-        "</div>"
-        "</body>"
-        "</html>";
-    return String(html);
+void WiFiManager::sendAsset(const web_asset_t& builtin) {
+    // Versão da partição "fr", se houver (ver web_store.h)
+    const web_asset_t& asset = *web_store_get(&builtin);
+    if (!asset.data) {
+        server->send(404, "text/plain", "Pagina nao encontrada");
+        return;
+    }
+    server->sendHeader("ETag", asset.etag);
+    server->sendHeader("Cache-Control", "no-cache");
+    if (server->header("If-None-Match") == asset.etag) {
+        server->send(304);
+        return;
+    }
+    server->sendHeader("Content-Encoding", "gzip");
+    server->send_P(200, asset.content_type, (const char*)asset.data, asset.len);
 }
 
 String WiFiManager::getCurrentSSID() {
@@ -455,7 +911,6 @@ bool WiFiManager::setStaticIP(IPAddress localIP, IPAddress gateway, IPAddress su
         Serial.println(")");
         // Use o gateway real ao aplicar a configuração
         if (WiFi.config(localIP, realGateway, subnet, primaryDNS, secondaryDNS)) {
-            delay(1000);
             Serial.print("IP estático configurado: ");
             Serial.println(WiFi.localIP());
             return true;
@@ -464,4 +919,6 @@ bool WiFiManager::setStaticIP(IPAddress localIP, IPAddress gateway, IPAddress su
             return false;
         }
     }
+    Serial.println("setStaticIP: WiFi não conectado, abortando.");
+    return false;
 }
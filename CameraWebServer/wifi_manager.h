@@ -5,6 +5,34 @@
 #include <Preferences.h>
 #include <WebServer.h>
 #include <DNSServer.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "camera_index.h"
+
+// Redes guardadas da última varredura do portal (uma por SSID, a mais forte)
+#define PORTAL_SCAN_MAX 16
+
+typedef struct {
+    char ssid[33];
+    int8_t rssi;
+    uint8_t channel;
+    bool secure;
+} portal_network_t;
+
+// Estados da conexão. As transições acontecem em handleWiFiConnection(),
+// chamado pelo loop(); os eventos do WiFi só registram o que aconteceu.
+typedef enum {
+    WIFI_STATE_IDLE,
+    WIFI_STATE_CONNECTING,         // credenciais salvas, aguardando IP
+    WIFI_STATE_CONNECTED,
+    WIFI_STATE_RECONNECTING,       // enlace caiu; novas tentativas com backoff
+    WIFI_STATE_PORTAL,             // softAP + portal de configuração
+    WIFI_STATE_PORTAL_CONNECTING,  // portal no ar testando as credenciais enviadas
+} wifi_state_t;
+
+// Chamado no loop() a cada mudança de estado
+typedef void (*wifi_state_cb_t)(wifi_state_t state, wifi_state_t previous);
 
 class WiFiManager {
 private:
@@ -24,14 +52,91 @@ private:
     bool configMode;
     int connectionAttempts;
     int maxConnectionAttempts;
+    uint32_t connectTimeoutMs;
+    uint32_t directTimeoutMs;
+    uint32_t backoffMinMs;
+    uint32_t backoffMaxMs;
+    
+    // Último enlace bom (NVS): BSSID, canal e IP fixo para conectar direto,
+    // sem varredura nem DHCP
+    bool hasNetworkCache;
+    uint8_t cachedBSSID[6];
+    uint8_t cachedChannel;
+    IPAddress cachedIP;
+    IPAddress cachedGateway;
+    IPAddress cachedSubnet;
     uint8_t desiredStaticHost;
+    // Uma tentativa falhou desde a última conexão: a rede pode ter mudado, as
+    // próximas usam DHCP e o gateway entregue confirma ou refaz o IP fixo
+    bool cachedIPStale;
     IPAddress defaultPrimaryDNS;
     IPAddress defaultSecondaryDNS;
     
-    // HTML da página de configuração
-    String getConfigPageHTML();
-    String getSuccessPageHTML();
-    String getErrorPageHTML();
+    // Máquina de estados
+    wifi_state_t state;
+    wifi_state_cb_t stateCallback;
+    unsigned long stateSince;
+    unsigned long phaseDeadline;    // desiste do CONNECTING/PORTAL_CONNECTING
+    unsigned long attemptDeadline;  // tentativa atual
+    bool directAttempt;             // tentativa atual usa o cache
+    int directFailures;             // seguidas, durante a reconexão
+    bool attemptActive;             // false: esperando o backoff
+    int retryCount;
+    unsigned long nextAttemptAt;
+    // Reconexões concluídas e tempo total sem enlace depois da primeira conexão
+    uint32_t reconnectCount;
+    unsigned long downtimeMs;
+    unsigned long linkDownSince;
+    volatile unsigned long restartAt;  // escrito também pela tarefa do httpd
+    // Escritos pela tarefa de eventos do WiFi, consumidos no loop()
+    volatile bool gotIP;
+    volatile bool linkLost;
+    volatile uint8_t lastDisconnectReason;
+    
+    // Portal (HTTP + DNS) atendido numa tarefa própria, sem esperar o loop()
+    TaskHandle_t portalTask;
+    SemaphoreHandle_t portalStopped;
+    volatile bool portalRunning;
+    // /save entrega as credenciais ao loop(), que faz a conexão: a tarefa do
+    // portal escreve pendingSSID/pendingPassword só com pendingConnect false
+    bool pendingConnect;  // __atomic: publica as duas strings
+    String pendingSSID;
+    String pendingPassword;
+    // /reset também (do portal e do servidor da câmera): quem atende só pede via
+    // requestReset(), o loop() apaga a NVS e agenda o reinício
+    volatile bool resetRequested;
+    volatile uint32_t resetRestartMs;
+    // O que o /wifi mostra, copiado pelo loop() sob statusLock (savedSSID é
+    // String e pode ser realocada no meio da leitura)
+    SemaphoreHandle_t statusLock;
+    wifi_state_t statusState;
+    unsigned long statusSince;
+    char statusSSID[33];
+    // Varredura em segundo plano; a lista só é tocada pela tarefa do portal
+    volatile bool scanRequested;
+    volatile bool scanRunning;
+    portal_network_t scanList[PORTAL_SCAN_MAX];
+    int scanCount;
+    unsigned long scanAt;
+    
+    void setState(wifi_state_t next);
+    void publishStatus();
+    void onWiFiEvent(arduino_event_id_t event, arduino_event_info_t info);
+    void beginAttempt(bool direct);
+    void onConnected();
+    void onAttemptFailed(const char* why);
+    uint32_t nextBackoffMs();
+    void loadNetworkCache();
+    void saveNetworkCache();
+    void clearNetworkCache();
+    static void portalTaskMain(void* arg);
+    void stopPortalTask();
+    void serviceScan();
+    void collectScanResults(int found);
+    void sendScanResults();
+    
+    // Envia uma página pré-comprimida (camera_index.h), com 304 via ETag
+    void sendAsset(const web_asset_t& asset);
     
 public:
     WiFiManager();
@@ -48,14 +153,30 @@ public:
     void saveCredentials(const String& ssid, const String& password);
     void clearCredentials();
     
-    // Conexão WiFi
+    // Conexão WiFi: só dispara a tentativa; o resultado chega pelos eventos
     bool connectToWiFi();
     bool connectToWiFi(const String& ssid, const String& password);
+    // Avança a máquina de estados; nunca bloqueia
     void handleWiFiConnection();
+    void onStateChange(wifi_state_cb_t callback);
+    wifi_state_t getState();
+    static const char* stateName(wifi_state_t state);
+    // ms no estado atual e motivo da última desconexão (0 se nenhuma)
+    unsigned long getStateAge();
+    uint8_t getLastDisconnectReason();
+    uint32_t getReconnectCount();
+    // Inclui a queda em andamento
+    unsigned long getDowntimeMs();
+    // Reinício agendado, feito pelo loop() depois que a resposta saiu
+    void scheduleRestart(uint32_t delayMs);
+    // Apaga as credenciais e reinicia delayMs depois, tudo pelo loop(); pode
+    // ser chamado de qualquer tarefa
+    void requestReset(uint32_t delayMs);
     
     // Servidor web para configuração
     void startConfigServer();
     void stopConfigServer();
+    // Uma rodada do HTTP e do DNS; chamado pela tarefa do portal
     void handleConfigServer();
     bool isConfigModeActive();
     
@@ -0,0 +1,124 @@
+#!/usr/bin/env python3
+"""Gera camera_index.h/.cpp a partir das páginas em CameraWebServer/web/.
+
+Cada arquivo é comprimido com gzip (determinístico, mtime=0) e recebe um ETag
+derivado do conteúdo, usado pelos servidores para responder 304. Com
+WEB_ASSETS_BUILTIN=0 os bytes ficam fora do firmware e as páginas vêm só da
+partição "fr" (tools/mkwebfs); nome e ETag continuam na tabela.
+
+    python3 tools/build_assets.py          # regenera os arquivos
+    python3 tools/build_assets.py --check  # falha se estiverem desatualizados
+"""
+
+import argparse
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SKETCH = os.path.join(ROOT, "CameraWebServer")
+WEB = os.path.join(SKETCH, "web")
+
+CONTENT_TYPES = {
+    ".html": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".ico": "image/x-icon",
+    ".png": "image/png",
+}
+
+HEADER = """// Gerado por tools/build_assets.py a partir de CameraWebServer/web/ - não editar
+#ifndef CAMERA_INDEX_H
+#define CAMERA_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 0 = páginas só na partição "fr" (tools/mkwebfs); data fica NULL
+#ifndef WEB_ASSETS_BUILTIN
+#define WEB_ASSETS_BUILTIN 1
+#endif
+
+typedef struct {
+  const char *name;          // nome do arquivo em web/
+  const char *content_type;
+  const uint8_t *data;       // conteúdo comprimido com gzip (NULL se não embutido)
+  size_t len;
+  const char *etag;
+} web_asset_t;
+
+"""
+
+
+def load_assets():
+    assets = []
+    for name in sorted(os.listdir(WEB)):
+        ext = os.path.splitext(name)[1]
+        if ext not in CONTENT_TYPES:
+            continue
+        with open(os.path.join(WEB, name), "rb") as f:
+            raw = f.read()
+        gz = gzip.compress(raw, compresslevel=9, mtime=0)
+        symbol = re.sub(r"[^0-9A-Za-z]", "_", name)
+        etag = '"%s"' % hashlib.sha1(gz).hexdigest()[:16]
+        assets.append((name, symbol, CONTENT_TYPES[ext], gz, etag))
+    return assets
+
+
+def render(assets):
+    h = [HEADER]
+    for name, symbol, _, gz, _ in assets:
+        h.append("//File: %s.gz, Size: %d\n" % (name, len(gz)))
+        h.append("extern const web_asset_t asset_%s;\n" % symbol)
+    h.append("\nextern const web_asset_t *const web_assets[];\n")
+    h.append("extern const size_t web_assets_count;\n\n#endif\n")
+
+    c = ['// Gerado por tools/build_assets.py a partir de CameraWebServer/web/ - não editar\n#include "camera_index.h"\n']
+    for name, symbol, ctype, gz, etag in assets:
+        c.append("\n//File: %s.gz, Size: %d\n" % (name, len(gz)))
+        c.append("#if WEB_ASSETS_BUILTIN\n")
+        c.append("static const unsigned char %s_gz[] = {\n" % symbol)
+        for i in range(0, len(gz), 26):
+            c.append("  " + ", ".join("0x%02X" % b for b in gz[i:i + 26]) + ",\n")
+        c.append("};\n")
+        c.append('const web_asset_t asset_%s = {"%s", "%s", %s_gz, %d, "%s"};\n' % (symbol, name, ctype, symbol, len(gz), etag.replace('"', '\\"')))
+        c.append("#else\n")
+        c.append('const web_asset_t asset_%s = {"%s", "%s", NULL, 0, "%s"};\n' % (symbol, name, ctype, etag.replace('"', '\\"')))
+        c.append("#endif\n")
+    c.append("\nconst web_asset_t *const web_assets[] = {\n")
+    for _, symbol, _, _, _ in assets:
+        c.append("  &asset_%s,\n" % symbol)
+    c.append("};\nconst size_t web_assets_count = %d;\n" % len(assets))
+    return "".join(h), "".join(c)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--check", action="store_true", help="não grava; falha se os arquivos gerados estiverem desatualizados")
+    args = parser.parse_args()
+
+    assets = load_assets()
+    outputs = dict(zip(("camera_index.h", "camera_index.cpp"), render(assets)))
+    stale = []
+    for name, text in outputs.items():
+        path = os.path.join(SKETCH, name)
+        current = open(path).read() if os.path.exists(path) else None
+        if current != text:
+            stale.append(name)
+            if not args.check:
+                with open(path, "w") as f:
+                    f.write(text)
+    for name, _, _, gz, etag in assets:
+        print("%-22s %7d B gzip  ETag %s" % (name, len(gz), etag))
+    if args.check and stale:
+        print("desatualizado: %s (rode tools/build_assets.py)" % ", ".join(stale), file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
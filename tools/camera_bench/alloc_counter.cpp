@@ -0,0 +1,72 @@
+// Conta as alocações de heap do processo inteiro substituindo malloc e
+// companhia (glibc exporta __libc_malloc para isso). As threads do próprio
+// benchmark marcam alloc_counter_ignore para não entrar na conta.
+
+#include "alloc_counter.h"
+
+#include <stdint.h>
+#include <string.h>
+
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t n, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void *__libc_memalign(size_t align, size_t size);
+void __libc_free(void *ptr);
+}
+
+static uint64_t alloc_count;
+static uint64_t alloc_bytes;
+static __thread bool ignore_thread;
+
+static inline void count(size_t size) {
+  if (!ignore_thread) {
+    __atomic_fetch_add(&alloc_count, 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&alloc_bytes, size, __ATOMIC_RELAXED);
+  }
+}
+
+extern "C" void *malloc(size_t size) {
+  count(size);
+  return __libc_malloc(size);
+}
+
+extern "C" void *calloc(size_t n, size_t size) {
+  count(n * size);
+  return __libc_calloc(n, size);
+}
+
+extern "C" void *realloc(void *ptr, size_t size) {
+  count(size);
+  return __libc_realloc(ptr, size);
+}
+
+extern "C" int posix_memalign(void **out, size_t align, size_t size) {
+  count(size);
+  void *p = __libc_memalign(align, size);
+  if (!p) {
+    return 12;  // ENOMEM
+  }
+  *out = p;
+  return 0;
+}
+
+extern "C" void *aligned_alloc(size_t align, size_t size) {
+  count(size);
+  return __libc_memalign(align, size);
+}
+
+extern "C" void free(void *ptr) {
+  __libc_free(ptr);
+}
+
+void alloc_counter_ignore(bool ignore) {
+  ignore_thread = ignore;
+}
+
+alloc_stats_t alloc_counter_read(void) {
+  alloc_stats_t s;
+  s.count = __atomic_load_n(&alloc_count, __ATOMIC_RELAXED);
+  s.bytes = __atomic_load_n(&alloc_bytes, __ATOMIC_RELAXED);
+  return s;
+}
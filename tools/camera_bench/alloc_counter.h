@@ -0,0 +1,12 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+  uint64_t count;
+  uint64_t bytes;
+} alloc_stats_t;
+
+// Liga/desliga a contagem para a thread atual (clientes do benchmark)
+void alloc_counter_ignore(bool ignore);
+alloc_stats_t alloc_counter_read(void);
@@ -0,0 +1,315 @@
+// Benchmark de host do servidor da câmera: compila app_httpd.cpp contra os
+// stand-ins de tools/host (esp_http_server sobre sockets, câmera falsa que
+// reproduz JPEGs na taxa do sensor) e mede cada endpoint com clientes reais.
+//
+//   camera_bench [--frames dir | --synthetic 800x600] [--fps 25] [--seconds 5]
+//                [--endpoints stream,capture,bmp] [--clients 1] [--quality 12]
+//                [--port-offset 8000]
+//
+// Para cada endpoint: quadros/s recebidos, MB/s, alocações de heap por quadro
+// (processo inteiro, exceto as threads de cliente), latência vista pelo
+// cliente e a duração de cada etapa do handler, tirada dos spans do /trace.
+
+#include <strings.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "alloc_counter.h"
+#include "esp_camera.h"
+#include "esp_host.h"
+#include "esp_timer.h"
+#include "http_client.h"
+#include "trace.h"
+
+void startCameraServer();
+
+namespace {
+
+struct Options {
+  std::string frames_dir;
+  int width = 800;
+  int height = 600;
+  int quality = 12;
+  float fps = 25;
+  int seconds = 5;
+  int clients = 1;
+  int port_offset = 8000;
+  std::vector<std::string> endpoints = {"stream", "capture", "bmp"};
+};
+
+struct ClientStats {
+  uint64_t frames = 0;
+  uint64_t bytes = 0;
+  uint64_t errors = 0;
+  std::vector<int64_t> latency_us;
+};
+
+// /stream: uma conexão, partes multipart até o prazo
+void run_stream(int port, int64_t until, ClientStats *st) {
+  int fd = http::connect_tcp("127.0.0.1", port);
+  if (fd < 0 || !http::send_request(fd, "GET", "/stream", "localhost")) {
+    st->errors++;
+    if (fd >= 0) {
+      close(fd);
+    }
+    return;
+  }
+  http::Reader rd(fd);
+  int status = 0;
+  std::map<std::string, std::string> headers;
+  if (!rd.read_headers(&status, &headers) || status != 200) {
+    st->errors++;
+    close(fd);
+    return;
+  }
+  http::MultipartReader parts(&rd);
+  http::Part part;
+  const char *data;
+  while (esp_timer_get_time() < until) {
+    if (!parts.next(&part, &data)) {
+      st->errors++;
+      break;
+    }
+    st->frames++;
+    st->bytes += part.len;
+    if (part.timestamp_us) {
+      st->latency_us.push_back(http::wall_us() - part.timestamp_us);
+    }
+  }
+  close(fd);
+}
+
+// /capture e /bmp: pedidos em sequência na mesma conexão keep-alive
+void run_requests(int port, const std::string &path, int64_t until, ClientStats *st) {
+  int fd = -1;
+  while (esp_timer_get_time() < until) {
+    if (fd < 0 && (fd = http::connect_tcp("127.0.0.1", port)) < 0) {
+      st->errors++;
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      continue;
+    }
+    int64_t start = esp_timer_get_time();
+    http::Reader rd(fd);
+    int status = 0;
+    std::map<std::string, std::string> headers;
+    if (!http::send_request(fd, "GET", path, "localhost") || !rd.read_headers(&status, &headers)) {
+      st->errors++;
+      close(fd);
+      fd = -1;
+      continue;
+    }
+    std::string body = rd.read_body();
+    if (status != 200) {
+      st->errors++;
+      continue;
+    }
+    st->frames++;
+    st->bytes += body.size();
+    st->latency_us.push_back(esp_timer_get_time() - start);
+    auto conn = headers.find("connection");
+    if (conn != headers.end() && strcasecmp(conn->second.c_str(), "close") == 0) {
+      close(fd);
+      fd = -1;
+    }
+  }
+  if (fd >= 0) {
+    close(fd);
+  }
+}
+
+int64_t percentile(std::vector<int64_t> v, double p) {
+  if (v.empty()) {
+    return 0;
+  }
+  std::sort(v.begin(), v.end());
+  size_t i = std::min(v.size() - 1, (size_t)(p * (v.size() - 1) + 0.5));
+  return v[i];
+}
+
+// Casa os pares B/E de cada thread e agrupa as durações pelo nome do span
+struct StageCollector {
+  std::map<int, std::vector<const trace_record_t *>> open;
+  std::map<std::string, std::vector<int64_t>> durations;
+  std::vector<trace_record_t> records;
+};
+
+void collect_record(void *ctx, const trace_record_t *rec) {
+  ((StageCollector *)ctx)->records.push_back(*rec);
+}
+
+std::map<std::string, std::vector<int64_t>> stage_durations(int64_t window_us) {
+  StageCollector c;
+  trace_foreach(collect_record, &c, window_us);
+  for (const trace_record_t &r : c.records) {
+    auto &stack = c.open[r.thread];
+    if (r.phase == 'B') {
+      stack.push_back(&r);
+    } else if (r.phase == 'E') {
+      // Um E sem B (span aberto antes da janela) é descartado
+      for (size_t i = stack.size(); i-- > 0;) {
+        if (strcmp(stack[i]->name, r.name) == 0) {
+          c.durations[r.name].push_back(r.ts - stack[i]->ts);
+          stack.resize(i);
+          break;
+        }
+      }
+    }
+  }
+  return c.durations;
+}
+
+void report(const std::string &endpoint, const Options &opt, double seconds, const std::vector<ClientStats> &clients,
+            const alloc_stats_t &allocs, const std::map<std::string, std::vector<int64_t>> &stages) {
+  ClientStats total;
+  for (const ClientStats &c : clients) {
+    total.frames += c.frames;
+    total.bytes += c.bytes;
+    total.errors += c.errors;
+    total.latency_us.insert(total.latency_us.end(), c.latency_us.begin(), c.latency_us.end());
+  }
+  printf("\n== /%s  (%d cliente%s, %.1f s, câmera a %.1f fps)\n", endpoint.c_str(), opt.clients, opt.clients > 1 ? "s" : "", seconds,
+         opt.fps);
+  printf("  quadros        %8llu   erros %llu\n", (unsigned long long)total.frames, (unsigned long long)total.errors);
+  printf("  fps            %8.2f\n", total.frames / seconds);
+  printf("  MB/s           %8.2f   (%.1f KB/quadro)\n", total.bytes / seconds / 1e6, total.frames ? total.bytes / 1024.0 / total.frames : 0.0);
+  if (total.frames) {
+    printf("  alocações      %8.1f/quadro   %.1f KB/quadro\n", (double)allocs.count / total.frames, allocs.bytes / 1024.0 / total.frames);
+  }
+  if (!total.latency_us.empty()) {
+    printf("  latência (ms)  p50 %.2f  p95 %.2f  p99 %.2f  máx %.2f\n", percentile(total.latency_us, 0.5) / 1e3,
+           percentile(total.latency_us, 0.95) / 1e3, percentile(total.latency_us, 0.99) / 1e3,
+           percentile(total.latency_us, 1.0) / 1e3);
+  }
+  if (!stages.empty()) {
+    printf("  %-16s %8s %9s %9s %9s\n", "etapa", "n", "p50 ms", "p95 ms", "p99 ms");
+    for (const auto &s : stages) {
+      printf("  %-16s %8zu %9.3f %9.3f %9.3f\n", s.first.c_str(), s.second.size(), percentile(s.second, 0.5) / 1e3,
+             percentile(s.second, 0.95) / 1e3, percentile(s.second, 0.99) / 1e3);
+    }
+  }
+}
+
+void usage() {
+  fprintf(stderr,
+          "uso: camera_bench [--frames dir | --synthetic LxA] [--fps N] [--seconds N]\n"
+          "                  [--endpoints stream,capture,bmp] [--clients N] [--quality N]\n"
+          "                  [--port-offset N]\n");
+  exit(2);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  alloc_counter_ignore(true);
+  Options opt;
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    auto next = [&]() -> const char * {
+      if (i + 1 >= argc) {
+        usage();
+      }
+      return argv[++i];
+    };
+    if (a == "--frames") {
+      opt.frames_dir = next();
+    } else if (a == "--synthetic") {
+      if (sscanf(next(), "%dx%d", &opt.width, &opt.height) != 2) {
+        usage();
+      }
+    } else if (a == "--fps") {
+      opt.fps = atof(next());
+    } else if (a == "--seconds") {
+      opt.seconds = atoi(next());
+    } else if (a == "--clients") {
+      opt.clients = std::max(1, atoi(next()));
+    } else if (a == "--quality") {
+      opt.quality = atoi(next());
+    } else if (a == "--port-offset") {
+      opt.port_offset = atoi(next());
+    } else if (a == "--endpoints") {
+      opt.endpoints.clear();
+      std::string list = next();
+      size_t start = 0;
+      while (start <= list.size()) {
+        size_t comma = list.find(',', start);
+        if (comma == std::string::npos) {
+          comma = list.size();
+        }
+        if (comma > start) {
+          opt.endpoints.push_back(list.substr(start, comma - start));
+        }
+        start = comma + 1;
+      }
+    } else {
+      usage();
+    }
+  }
+
+  int loaded = opt.frames_dir.empty() ? fake_camera_synthesize(opt.width, opt.height, 50, opt.quality) : fake_camera_load_dir(opt.frames_dir.c_str());
+  if (loaded <= 0) {
+    fprintf(stderr, "nenhum quadro para reproduzir\n");
+    return 1;
+  }
+  fake_camera_set_fps(opt.fps);
+
+  camera_config_t config = {};
+  config.pixel_format = PIXFORMAT_JPEG;
+  config.frame_size = FRAMESIZE_SVGA;
+  config.jpeg_quality = opt.quality;
+  config.fb_count = 2;
+  config.grab_mode = CAMERA_GRAB_LATEST;
+  if (esp_camera_init(&config) != ESP_OK) {
+    return 1;
+  }
+
+  char offset[16];
+  snprintf(offset, sizeof(offset), "%d", opt.port_offset);
+  setenv("ESP_HOST_PORT_OFFSET", offset, 1);
+  trace_init(1 << 16);
+  startCameraServer();
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+  printf("camera_bench: %d quadros %s, portas %d/%d\n", loaded, opt.frames_dir.empty() ? "sintéticos" : opt.frames_dir.c_str(),
+         80 + opt.port_offset, 81 + opt.port_offset);
+  for (const std::string &ep : opt.endpoints) {
+    if (ep != "stream" && ep != "capture" && ep != "bmp") {
+      fprintf(stderr, "endpoint desconhecido: %s\n", ep.c_str());
+      continue;
+    }
+    std::vector<ClientStats> stats(opt.clients);
+    std::vector<std::thread> threads;
+    int64_t start = esp_timer_get_time();
+    int64_t until = start + (int64_t)opt.seconds * 1000000;
+    alloc_stats_t before = alloc_counter_read();
+    for (int c = 0; c < opt.clients; c++) {
+      threads.emplace_back([&, c] {
+        alloc_counter_ignore(true);
+        if (ep == "stream") {
+          run_stream(81 + opt.port_offset, until, &stats[c]);
+        } else {
+          run_requests(80 + opt.port_offset, "/" + ep, until, &stats[c]);
+        }
+      });
+    }
+    for (auto &t : threads) {
+      t.join();
+    }
+    int64_t elapsed = esp_timer_get_time() - start;
+    alloc_stats_t after = alloc_counter_read();
+    alloc_stats_t delta = {after.count - before.count, after.bytes - before.bytes};
+    report(ep, opt, elapsed / 1e6, stats, delta, stage_durations(elapsed));
+    // O handler do /stream só percebe o fechamento no próximo envio
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  }
+  fflush(stdout);
+  _exit(0);
+}
@@ -0,0 +1,51 @@
+// O benchmark exercita só o servidor da câmera: o WiFiManager fica reduzido
+// ao que app_httpd.cpp referencia (/reset pede a limpeza das credenciais
+// e o reinício, /status e /metrics mostram o estado da conexão e o
+// /stream só envia com enlace).
+
+#include "wifi_manager.h"
+
+WiFiManager wifiManager;
+
+WiFiManager::WiFiManager() {
+  server = nullptr;
+  dnsServer = nullptr;
+  hasStoredCredentials = false;
+  hasConnectedOnce = false;
+  configMode = false;
+  connectionAttempts = 0;
+  maxConnectionAttempts = 5;
+  desiredStaticHost = 200;
+  state = WIFI_STATE_CONNECTED;
+  stateCallback = nullptr;
+  restartAt = 0;
+}
+
+WiFiManager::~WiFiManager() {}
+
+// Sem loop() no benchmark: limpa e agenda na hora
+void WiFiManager::requestReset(uint32_t delayMs) {
+  hasStoredCredentials = false;
+  hasConnectedOnce = false;
+  restartAt = millis() + delayMs;
+}
+
+wifi_state_t WiFiManager::getState() {
+  return state;
+}
+
+const char *WiFiManager::stateName(wifi_state_t state) {
+  return state == WIFI_STATE_CONNECTED ? "connected" : "other";
+}
+
+bool WiFiManager::isConnected() {
+  return true;
+}
+
+uint32_t WiFiManager::getReconnectCount() {
+  return 0;
+}
+
+unsigned long WiFiManager::getDowntimeMs() {
+  return 0;
+}
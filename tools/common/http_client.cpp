@@ -0,0 +1,208 @@
+#include "http_client.h"
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace http {
+
+int connect_tcp(const std::string &host, uint16_t port, int timeout_ms, int rcvbuf) {
+  addrinfo hints = {};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo *res = NULL;
+  if (getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &res) != 0) {
+    return -1;
+  }
+  int fd = socket(res->ai_family, res->ai_socktype, 0);
+  timeval tv = {timeout_ms / 1000, (timeout_ms % 1000) * 1000};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv));
+  int one = 1;
+  setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+  // A janela é anunciada no SYN: depois do connect já é tarde
+  if (rcvbuf > 0) {
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+  }
+  if (connect(fd, res->ai_addr, res->ai_addrlen) != 0) {
+    close(fd);
+    fd = -1;
+  }
+  freeaddrinfo(res);
+  return fd;
+}
+
+bool send_request(int fd, const std::string &method, const std::string &path, const std::string &host, const std::string &body,
+                  const std::string &content_type) {
+  std::string req = method + " " + path + " HTTP/1.1\r\nHost: " + host + "\r\nConnection: keep-alive\r\n";
+  if (!body.empty() || method == "POST") {
+    if (!content_type.empty()) {
+      req += "Content-Type: " + content_type + "\r\n";
+    }
+    req += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+  }
+  req += "\r\n" + body;
+  return send(fd, req.data(), req.size(), MSG_NOSIGNAL) == (ssize_t)req.size();
+}
+
+int64_t wall_us() {
+  timeval tv;
+  gettimeofday(&tv, NULL);
+  return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+bool Reader::read_headers(int *status, std::map<std::string, std::string> *headers) {
+  std::string line;
+  if (!raw_line(&line) || sscanf(line.c_str(), "HTTP/1.%*d %d", status) != 1) {
+    return false;
+  }
+  while (raw_line(&line) && !line.empty()) {
+    size_t colon = line.find(':');
+    if (colon == std::string::npos) {
+      continue;
+    }
+    std::string key = line.substr(0, colon);
+    std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+    size_t v = line.find_first_not_of(' ', colon + 1);
+    (*headers)[key] = v == std::string::npos ? "" : line.substr(v);
+  }
+  auto te = headers->find("transfer-encoding");
+  chunked_ = te != headers->end() && te->second == "chunked";
+  auto cl = headers->find("content-length");
+  remaining_ = cl != headers->end() ? strtoull(cl->second.c_str(), NULL, 10) : 0;
+  // Sem tamanho nem chunked (ex.: WebServer antigo), o corpo vai até o fechamento
+  until_close_ = !chunked_ && cl == headers->end() && *status != 204 && *status != 304;
+  return true;
+}
+
+bool Reader::body_more(std::string *body) {
+  if (until_close_) {
+    if (pos_ == raw_.size() && !recv_more()) {
+      return false;
+    }
+    body->append(raw_, pos_, raw_.size() - pos_);
+    pos_ = raw_.size();
+    return true;
+  }
+  if (chunked_ && remaining_ == 0) {
+    std::string line;
+    if (!raw_line(&line)) {
+      return false;
+    }
+    if (line.empty() && !raw_line(&line)) {  // CRLF do fim do pedaço anterior
+      return false;
+    }
+    remaining_ = strtoull(line.c_str(), NULL, 16);
+    if (remaining_ == 0) {
+      raw_line(&line);
+      return false;
+    }
+  }
+  if (remaining_ == 0) {
+    return false;
+  }
+  if (pos_ == raw_.size() && !recv_more()) {
+    return false;
+  }
+  size_t n = std::min(remaining_, raw_.size() - pos_);
+  body->append(raw_, pos_, n);
+  pos_ += n;
+  remaining_ -= n;
+  return true;
+}
+
+std::string Reader::read_body() {
+  std::string body;
+  while (body_more(&body)) {
+  }
+  return body;
+}
+
+bool Reader::recv_more() {
+  if (pos_ > 65536) {
+    raw_.erase(0, pos_);
+    pos_ = 0;
+  }
+  char buf[16384];
+  ssize_t n = recv(fd_, buf, sizeof(buf), 0);
+  if (n <= 0) {
+    return false;
+  }
+  raw_.append(buf, n);
+  return true;
+}
+
+bool Reader::raw_line(std::string *line) {
+  size_t eol;
+  while ((eol = raw_.find("\r\n", pos_)) == std::string::npos) {
+    if (!recv_more()) {
+      return false;
+    }
+  }
+  line->assign(raw_, pos_, eol - pos_);
+  pos_ = eol + 2;
+  return true;
+}
+
+static std::string part_header(const std::string &head, const char *name) {
+  size_t at = 0;
+  size_t len = strlen(name);
+  while ((at = head.find(name, at)) != std::string::npos) {
+    if ((at == 0 || head[at - 1] == '\n') && head.compare(at + len, 2, ": ") == 0) {
+      size_t end = head.find("\r\n", at);
+      return head.substr(at + len + 2, end == std::string::npos ? std::string::npos : end - at - len - 2);
+    }
+    at += len;
+  }
+  return "";
+}
+
+bool MultipartReader::next(Part *part, const char **data) {
+  if (pos_ > (1 << 20)) {
+    body_.erase(0, pos_);
+    pos_ = 0;
+  }
+  size_t head_end;
+  while ((head_end = body_.find("\r\n\r\n", pos_)) == std::string::npos) {
+    if (!reader_->body_more(&body_)) {
+      return false;
+    }
+  }
+  std::string head = body_.substr(pos_, head_end - pos_);
+  // A fronteira ("--...") vem antes dos cabeçalhos da parte
+  size_t first = head.find("\r\n--");
+  if (first != std::string::npos) {
+    size_t eol = head.find("\r\n", first + 2);
+    head = eol == std::string::npos ? "" : head.substr(eol + 2);
+  } else if (head.compare(0, 2, "--") == 0) {
+    size_t eol = head.find("\r\n");
+    head = eol == std::string::npos ? "" : head.substr(eol + 2);
+  }
+  part->content_type = part_header(head, "Content-Type");
+  part->len = strtoul(part_header(head, "Content-Length").c_str(), NULL, 10);
+  part->timestamp_us = 0;
+  std::string ts = part_header(head, "X-Timestamp");
+  long sec = 0, usec = 0;
+  if (sscanf(ts.c_str(), "%ld.%ld", &sec, &usec) == 2) {
+    part->timestamp_us = (int64_t)sec * 1000000 + usec;
+  }
+  size_t start = head_end + 4;
+  while (body_.size() < start + part->len) {
+    if (!reader_->body_more(&body_)) {
+      return false;
+    }
+  }
+  *data = body_.data() + start;
+  pos_ = start + part->len;
+  return true;
+}
+
+}  // namespace http
@@ -0,0 +1,63 @@
+#pragma once
+// Cliente HTTP/1.1 mínimo das ferramentas de host: conexão TCP, pedidos,
+// corpo com Content-Length ou chunked e as partes multipart do /stream.
+
+#include <stdint.h>
+
+#include <map>
+#include <string>
+
+namespace http {
+
+// Conecta em host:porta (nome ou IP); -1 em erro. Recepção com timeout;
+// rcvbuf limita a janela de recepção (0 = padrão do sistema).
+int connect_tcp(const std::string &host, uint16_t port, int timeout_ms = 5000, int rcvbuf = 0);
+bool send_request(int fd, const std::string &method, const std::string &path, const std::string &host,
+                  const std::string &body = "", const std::string &content_type = "");
+
+// Tempo de parede em µs: o X-Timestamp do firmware vem do gettimeofday
+int64_t wall_us();
+
+class Reader {
+ public:
+  explicit Reader(int fd) : fd_(fd) {}
+
+  // Chaves em minúsculas
+  bool read_headers(int *status, std::map<std::string, std::string> *headers);
+  // Acrescenta ao corpo decodificado o que houver; false no fim ou em erro
+  bool body_more(std::string *body);
+  // Corpo inteiro (até o fim da resposta)
+  std::string read_body();
+
+ private:
+  bool recv_more();
+  bool raw_line(std::string *line);
+
+  int fd_;
+  std::string raw_;
+  size_t pos_ = 0;
+  bool chunked_ = false;
+  bool until_close_ = false;
+  size_t remaining_ = 0;
+};
+
+struct Part {
+  std::string content_type;
+  size_t len = 0;
+  int64_t timestamp_us = 0;  // X-Timestamp, 0 se ausente
+};
+
+// Partes de um corpo multipart/x-mixed-replace, na ordem em que chegam
+class MultipartReader {
+ public:
+  explicit MultipartReader(Reader *reader) : reader_(reader) {}
+  // Próxima parte completa; `data` aponta para o corpo dela até a próxima chamada
+  bool next(Part *part, const char **data);
+
+ private:
+  Reader *reader_;
+  std::string body_;
+  size_t pos_ = 0;
+};
+
+}  // namespace http
@@ -0,0 +1,389 @@
+#include "rtsp_client.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "http_client.h"
+
+namespace rtsp {
+
+namespace {
+
+const size_t kMaxFrame = 512 * 1024;
+
+uint32_t be32(const uint8_t *p) {
+  return (uint32_t)p[0] << 24 | p[1] << 16 | p[2] << 8 | p[3];
+}
+
+// Socket UDP numa porta efêmera; retorna a porta ou 0
+uint16_t open_udp(int *fd) {
+  *fd = socket(AF_INET, SOCK_DGRAM, 0);
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  socklen_t len = sizeof(addr);
+  if (*fd < 0 || bind(*fd, (sockaddr *)&addr, sizeof(addr)) != 0 || getsockname(*fd, (sockaddr *)&addr, &len) != 0) {
+    return 0;
+  }
+  // Um quadro inteiro chega de rajada
+  int rcvbuf = 1 << 20;
+  setsockopt(*fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+  return ntohs(addr.sin_port);
+}
+
+// Socket na porta do grupo, que pode ter outros receptores no mesmo host
+bool open_group(int *fd, const std::string &group, uint16_t port, const std::string &iface) {
+  *fd = socket(AF_INET, SOCK_DGRAM, 0);
+  int one = 1;
+  setsockopt(*fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  int rcvbuf = 1 << 20;
+  setsockopt(*fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  ip_mreq mreq = {};
+  if (*fd < 0 || inet_pton(AF_INET, group.c_str(), &addr.sin_addr) != 1 || inet_pton(AF_INET, iface.c_str(), &mreq.imr_interface) != 1) {
+    return false;
+  }
+  mreq.imr_multiaddr = addr.sin_addr;
+  return bind(*fd, (sockaddr *)&addr, sizeof(addr)) == 0 && setsockopt(*fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) == 0;
+}
+
+// Valor de um parâmetro do Transport (destination=..., port=...)
+std::string transport_param(const std::string &transport, const std::string &name) {
+  size_t p = transport.find(name + "=");
+  if (p == std::string::npos) {
+    return "";
+  }
+  p += name.size() + 1;
+  return transport.substr(p, transport.find(';', p) - p);
+}
+
+}  // namespace
+
+Client::Client() : jpeg_(kMaxFrame) {
+  rtp_jpeg_receiver_init(&receiver_, jpeg_.data(), jpeg_.size());
+}
+
+Client::~Client() {
+  for (int fd : {fd_, rtp_fd_, rtcp_fd_}) {
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+}
+
+bool Client::recv_more(int timeout_ms) {
+  pollfd p = {fd_, POLLIN, 0};
+  if (poll(&p, 1, timeout_ms) <= 0) {
+    return false;
+  }
+  char buf[4096];
+  ssize_t n = recv(fd_, buf, sizeof(buf), 0);
+  if (n <= 0) {
+    return false;
+  }
+  in_.append(buf, n);
+  return true;
+}
+
+bool Client::request(const std::string &method, const std::string &url, const std::string &headers, int *status,
+                     std::map<std::string, std::string> *response, std::string *body) {
+  std::string req = method + " " + url + " RTSP/1.0\r\nCSeq: " + std::to_string(++cseq_) + "\r\nUser-Agent: esp32cam-tools\r\n";
+  if (!session_.empty()) {
+    req += "Session: " + session_ + "\r\n";
+  }
+  req += headers + "\r\n";
+  if (send(fd_, req.data(), req.size(), MSG_NOSIGNAL) != (ssize_t)req.size()) {
+    return false;
+  }
+
+  // Os blocos intercalados que chegarem antes da resposta são aplicados
+  Frame ignored;
+  size_t end;
+  while (true) {
+    drain_interleaved(&ignored);
+    if (!in_.empty() && in_[0] != '$' && (end = in_.find("\r\n\r\n")) != std::string::npos) {
+      break;
+    }
+    if (!recv_more(5000)) {
+      return false;
+    }
+  }
+  std::string head = in_.substr(0, end + 2);
+  if (sscanf(head.c_str(), "RTSP/1.0 %d", status) != 1) {
+    return false;
+  }
+  size_t pos = head.find("\r\n") + 2;
+  while (pos < head.size()) {
+    size_t eol = head.find("\r\n", pos);
+    std::string line = head.substr(pos, eol - pos);
+    pos = eol + 2;
+    size_t colon = line.find(':');
+    if (colon == std::string::npos) {
+      continue;
+    }
+    std::string key = line.substr(0, colon);
+    std::transform(key.begin(), key.end(), key.begin(), ::tolower);
+    size_t v = line.find_first_not_of(' ', colon + 1);
+    (*response)[key] = v == std::string::npos ? "" : line.substr(v);
+  }
+  size_t length = response->count("content-length") ? strtoul((*response)["content-length"].c_str(), NULL, 10) : 0;
+  while (in_.size() < end + 4 + length) {
+    if (!recv_more(5000)) {
+      return false;
+    }
+  }
+  if (body) {
+    *body = in_.substr(end + 4, length);
+  }
+  in_.erase(0, end + 4 + length);
+  return response->count("cseq") && atoi((*response)["cseq"].c_str()) == cseq_;
+}
+
+bool Client::join(const std::string &group, uint16_t port, const std::string &iface) {
+  return open_group(&rtp_fd_, group, port, iface) && open_group(&rtcp_fd_, group, port + 1, iface);
+}
+
+bool Client::listen(const std::string &group, uint16_t port, const std::string &iface, std::string *error) {
+  transport_ = kMulticast;
+  if (!join(group, port, iface)) {
+    *error = "join " + group + " failed";
+    return false;
+  }
+  return true;
+}
+
+bool Client::open(const std::string &url, Transport transport, std::string *error) {
+  std::string host = url.substr(url.find("://") + 3);
+  host = host.substr(0, host.find('/'));
+  uint16_t port = 554;
+  if (host.find(':') != std::string::npos) {
+    port = atoi(host.substr(host.find(':') + 1).c_str());
+    host = host.substr(0, host.find(':'));
+  }
+  fd_ = http::connect_tcp(host, port);
+  if (fd_ < 0) {
+    *error = "connect failed";
+    return false;
+  }
+  transport_ = transport;
+
+  int status = 0;
+  std::map<std::string, std::string> h;
+  if (!request("DESCRIBE", url, "Accept: application/sdp\r\n", &status, &h, &sdp_) || status != 200) {
+    *error = "DESCRIBE -> " + std::to_string(status);
+    return false;
+  }
+  // Controle da faixa relativo ao Content-Base
+  std::string base = h.count("content-base") ? h["content-base"] : url + "/";
+  size_t control = sdp_.rfind("a=control:");
+  std::string track = control == std::string::npos ? "" : sdp_.substr(control + 10, sdp_.find_first_of("\r\n", control) - control - 10);
+  control_url_ = track.find("://") != std::string::npos ? track : base + track;
+  if (sdp_.find("RTP/AVP 26") == std::string::npos) {
+    *error = "SDP without a JPEG track";
+    return false;
+  }
+
+  std::string spec;
+  if (transport == kTcp) {
+    spec = "RTP/AVP/TCP;unicast;interleaved=0-1";
+  } else if (transport == kMulticast) {
+    spec = "RTP/AVP;multicast";
+  } else {
+    uint16_t rtp_port = open_udp(&rtp_fd_);
+    uint16_t rtcp_port = open_udp(&rtcp_fd_);
+    if (!rtp_port || !rtcp_port) {
+      *error = "UDP sockets";
+      return false;
+    }
+    spec = "RTP/AVP;unicast;client_port=" + std::to_string(rtp_port) + "-" + std::to_string(rtcp_port);
+  }
+  h.clear();
+  if (!request("SETUP", control_url_, "Transport: " + spec + "\r\n", &status, &h, NULL) || status != 200 || !h.count("session")) {
+    *error = "SETUP -> " + std::to_string(status);
+    return false;
+  }
+  session_ = h["session"].substr(0, h["session"].find(';'));
+  const std::string &t = h["transport"];
+  size_t ssrc = t.find("ssrc=");
+  ssrc_ = ssrc == std::string::npos ? 0 : strtoul(t.c_str() + ssrc + 5, NULL, 16);
+  std::string server_port = transport_param(t, "server_port");
+  if (transport == kMulticast) {
+    // O grupo pela interface da conexão RTSP
+    std::string group = transport_param(t, "destination");
+    sockaddr_in local;
+    socklen_t len = sizeof(local);
+    char iface[INET_ADDRSTRLEN] = "0.0.0.0";
+    if (getsockname(fd_, (sockaddr *)&local, &len) == 0) {
+      inet_ntop(AF_INET, &local.sin_addr, iface, sizeof(iface));
+    }
+    if (group.empty() || !join(group, atoi(transport_param(t, "port").c_str()), iface)) {
+      *error = "join " + group + " failed";
+      return false;
+    }
+  } else if (transport == kUdp && !server_port.empty()) {
+    uint16_t server_rtcp = atoi(server_port.c_str() + server_port.find('-') + 1);
+    // O RTCP do cliente (RR) vai para a porta RTCP do servidor
+    sockaddr_in peer;
+    socklen_t len = sizeof(peer);
+    getpeername(fd_, (sockaddr *)&peer, &len);
+    peer.sin_port = htons(server_rtcp);
+    connect(rtcp_fd_, (sockaddr *)&peer, sizeof(peer));
+  }
+
+  h.clear();
+  if (!request("PLAY", url, "Range: npt=0.000-\r\n", &status, &h, NULL) || status != 200) {
+    *error = "PLAY -> " + std::to_string(status);
+    return false;
+  }
+  return true;
+}
+
+void Client::on_rtcp(const uint8_t *packet, size_t len) {
+  // Pacote composto: só o SR interessa
+  while (len >= 8) {
+    size_t n = 4 * ((size_t)(packet[2] << 8 | packet[3]) + 1);
+    if (n > len) {
+      return;
+    }
+    if (packet[1] == 200 && n >= RTCP_SR_SIZE) {
+      uint32_t ssrc = be32(packet + 4);
+      uint64_t ntp = (uint64_t)be32(packet + 8) << 32 | be32(packet + 12);
+      int64_t unix_us = (int64_t)((ntp >> 32) - 2208988800ULL) * 1000000 + (int64_t)(((ntp & 0xffffffff) * 1000000) >> 32);
+      uint32_t rtp = be32(packet + 16);
+      // Os dois relógios avançam juntos entre SRs
+      bool ok = (!ssrc_ || ssrc == ssrc_) && (!have_sr_ || (unix_us > sr_unix_us_ && (int32_t)(rtp - sr_rtp_) > 0));
+      if (ok) {
+        have_sr_ = true;
+        sr_unix_us_ = unix_us;
+        sr_rtp_ = rtp;
+        stats_.sender_reports++;
+      } else {
+        stats_.bad_reports++;
+      }
+    }
+    packet += n;
+    len -= n;
+  }
+}
+
+bool Client::on_rtp(const uint8_t *packet, size_t len, Frame *frame) {
+  stats_.packets++;
+  if (len >= RTP_HEADER_SIZE) {
+    uint16_t seq = packet[2] << 8 | packet[3];
+    if (seq_valid_ && (int16_t)(seq - next_seq_) > 0) {
+      stats_.packets_lost += (uint16_t)(seq - next_seq_);
+    }
+    seq_valid_ = true;
+    next_seq_ = seq + 1;
+  }
+  size_t n = rtp_jpeg_receive(&receiver_, packet, len);
+  stats_.lost = receiver_.lost;
+  stats_.errors = receiver_.errors;
+  if (!n) {
+    return false;
+  }
+  stats_.frames++;
+  frame->jpeg = jpeg_.data();
+  frame->len = n;
+  frame->timestamp = receiver_.timestamp;
+  frame->received_us = http::wall_us();
+  frame->wall_us = have_sr_ ? sr_unix_us_ + (int64_t)(int32_t)(frame->timestamp - sr_rtp_) * 1000000 / RTP_JPEG_CLOCK_HZ : 0;
+  return true;
+}
+
+bool Client::drain_interleaved(Frame *frame) {
+  while (in_.size() >= 4 && in_[0] == '$') {
+    size_t n = (uint8_t)in_[2] << 8 | (uint8_t)in_[3];
+    if (in_.size() < 4 + n) {
+      return false;
+    }
+    uint8_t channel = in_[1];
+    std::string packet = in_.substr(4, n);
+    in_.erase(0, 4 + n);
+    if (channel == 1) {
+      on_rtcp((const uint8_t *)packet.data(), n);
+    } else if (channel == 0 && on_rtp((const uint8_t *)packet.data(), n, frame)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Relatório do receptor vazio (sem blocos): mantém a sessão UDP viva
+void Client::send_receiver_report() {
+  uint8_t rr[8] = {0x80, 201, 0, 1, 0, 0, 0, 0};
+  uint32_t ssrc = ssrc_ ^ 0x5a5a5a5a;
+  rr[4] = ssrc >> 24;
+  rr[5] = ssrc >> 16;
+  rr[6] = ssrc >> 8;
+  rr[7] = ssrc;
+  send(rtcp_fd_, rr, sizeof(rr), 0);
+}
+
+bool Client::next_frame(Frame *frame, int timeout_ms) {
+  int64_t deadline = http::wall_us() + (int64_t)timeout_ms * 1000;
+  while (true) {
+    int64_t left = (deadline - http::wall_us()) / 1000;
+    if (transport_ == kTcp) {
+      if (drain_interleaved(frame)) {
+        return true;
+      }
+      if (left <= 0 || !recv_more((int)left)) {
+        return false;
+      }
+      continue;
+    }
+
+    // Sessão viva: RR em unicast; no grupo o servidor não ouve o RTCP e o
+    // keepalive vai pela conexão RTSP
+    if (transport_ == kUdp && http::wall_us() - last_rr_us_ > 5000000) {
+      send_receiver_report();
+      last_rr_us_ = http::wall_us();
+    }
+    if (transport_ == kMulticast && fd_ >= 0 && http::wall_us() - last_keepalive_us_ > 20000000) {
+      int status = 0;
+      std::map<std::string, std::string> h;
+      if (last_keepalive_us_ && !request("GET_PARAMETER", control_url_, "", &status, &h, NULL)) {
+        return false;
+      }
+      last_keepalive_us_ = http::wall_us();
+    }
+    pollfd p[2] = {{rtp_fd_, POLLIN, 0}, {rtcp_fd_, POLLIN, 0}};
+    if (left <= 0 || poll(p, 2, (int)left) <= 0) {
+      return false;
+    }
+    uint8_t buf[2048];
+    if (p[1].revents & POLLIN) {
+      ssize_t n = recv(rtcp_fd_, buf, sizeof(buf), 0);
+      if (n > 0) {
+        on_rtcp(buf, n);
+      }
+    }
+    if (p[0].revents & POLLIN) {
+      ssize_t n = recv(rtp_fd_, buf, sizeof(buf), 0);
+      if (n > 0 && on_rtp(buf, n, frame)) {
+        return true;
+      }
+    }
+  }
+}
+
+bool Client::teardown() {
+  if (fd_ < 0) {
+    return true;
+  }
+  int status = 0;
+  std::map<std::string, std::string> h;
+  return request("TEARDOWN", control_url_, "", &status, &h, NULL) && status == 200;
+}
+
+}  // namespace rtsp
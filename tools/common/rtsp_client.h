@@ -0,0 +1,88 @@
+#pragma once
+// Cliente RTSP mínimo das ferramentas de host: DESCRIBE, SETUP e PLAY de uma
+// faixa RTP/JPEG (RFC 2435) em UDP, intercalada no TCP ou pelo grupo
+// multicast (também só ouvindo o grupo, sem RTSP), quadros remontados
+// com o receptor do firmware (rtp_jpeg.h) e os relatórios do remetente (RTCP
+// SR) para pôr cada quadro no relógio de parede. Quem usa compila junto
+// CameraWebServer/rtp_jpeg.cpp e jpeg_mcu.cpp.
+
+#include <stdint.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "rtp_jpeg.h"
+
+namespace rtsp {
+
+enum Transport { kUdp, kTcp, kMulticast };
+
+struct Frame {
+  const uint8_t *jpeg = nullptr;  // válido até o próximo next_frame
+  size_t len = 0;
+  uint32_t timestamp = 0;  // relógio de 90 kHz
+  int64_t wall_us = 0;     // captura no relógio de parede pelo último SR (0 sem SR)
+  int64_t received_us = 0;
+};
+
+struct Stats {
+  uint32_t frames = 0;
+  uint32_t lost = 0;    // quadros perdidos (pacote faltando)
+  uint32_t errors = 0;  // pacotes inválidos
+  uint32_t packets = 0;
+  uint32_t packets_lost = 0;  // buracos na sequência RTP
+  uint32_t sender_reports = 0;
+  uint32_t bad_reports = 0;  // SR de outro SSRC ou com o relógio voltando
+};
+
+class Client {
+ public:
+  Client();
+  ~Client();
+
+  // Conecta e negocia até o PLAY; url é rtsp://host:porta/caminho
+  bool open(const std::string &url, Transport transport, std::string *error);
+  // Só entra no grupo (sem RTSP), pela interface do endereço local iface
+  bool listen(const std::string &group, uint16_t port, const std::string &iface, std::string *error);
+  // Próximo quadro completo; false no timeout ou com a conexão fechada
+  bool next_frame(Frame *frame, int timeout_ms);
+  bool teardown();
+
+  const Stats &stats() const { return stats_; }
+  const std::string &sdp() const { return sdp_; }
+
+ private:
+  bool request(const std::string &method, const std::string &url, const std::string &headers, int *status,
+               std::map<std::string, std::string> *response, std::string *body);
+  bool recv_more(int timeout_ms);
+  // Aplica os blocos intercalados do buffer; true se um quadro fechou
+  bool drain_interleaved(Frame *frame);
+  bool on_rtp(const uint8_t *packet, size_t len, Frame *frame);
+  void on_rtcp(const uint8_t *packet, size_t len);
+  void send_receiver_report();
+  bool join(const std::string &group, uint16_t port, const std::string &iface);
+
+  int fd_ = -1;
+  int rtp_fd_ = -1, rtcp_fd_ = -1;  // UDP
+  Transport transport_ = kUdp;
+  int cseq_ = 0;
+  std::string session_;
+  std::string control_url_;
+  std::string sdp_;
+  std::string in_;
+  uint32_t ssrc_ = 0;
+  int64_t last_rr_us_ = 0;
+  int64_t last_keepalive_us_ = 0;
+  bool seq_valid_ = false;
+  uint16_t next_seq_ = 0;
+
+  std::vector<uint8_t> jpeg_;
+  rtp_jpeg_receiver_t receiver_;
+  bool have_sr_ = false;
+  int64_t sr_unix_us_ = 0;
+  uint32_t sr_rtp_ = 0;
+  Stats stats_;
+};
+
+}  // namespace rtsp
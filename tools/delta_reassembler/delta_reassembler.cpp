@@ -0,0 +1,460 @@
+// Reagrupador de referência do fluxo /delta (reposição condicional de MCUs).
+//
+//   delta_reassembler [-o dir] [-q "key=30&dc=2&ac=24"] host[:porta]
+//   delta_reassembler [-o dir] -f captura.bin
+//   delta_reassembler [-o dir] [--key N] [--dc N] [--ac N] --roundtrip a.jpg b.jpg ...
+//
+// No modo --roundtrip o codificador do firmware roda no próprio host sobre
+// uma sequência de JPEGs; com dc=0 e ac=0 cada quadro remontado é conferido
+// MCU a MCU contra o original.
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <strings.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "jpeg_delta.h"
+#include "jpeg_mcu.h"
+
+namespace {
+
+uint16_t get_u16(const uint8_t *p) {
+  return p[0] | (p[1] << 8);
+}
+
+uint32_t get_u32(const uint8_t *p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+struct PlainBits {
+  const uint8_t *p;
+  size_t pos;
+
+  uint32_t get(int n) {
+    uint32_t v = 0;
+    while (n--) {
+      v = (v << 1) | ((p[pos >> 3] >> (7 - (pos & 7))) & 1);
+      pos++;
+    }
+    return v;
+  }
+};
+
+class DeltaReassembler {
+ public:
+  // Aplica um pacote e remonta o JPEG completo em `jpeg`.
+  bool feed(const uint8_t *pkt, size_t len, std::vector<uint8_t> &jpeg) {
+    if (len < JPEG_DELTA_HEADER_SIZE || memcmp(pkt, JPEG_DELTA_MAGIC, 4) != 0) {
+      return fail("pacote inválido");
+    }
+    bool key = pkt[4] & JPEG_DELTA_FLAG_KEYFRAME;
+    uint8_t blocks = pkt[5];
+    uint32_t seq = get_u32(pkt + 8);
+    uint32_t mcus = get_u32(pkt + 12);
+    uint32_t changed = get_u32(pkt + 16);
+    uint16_t hdr_len = get_u16(pkt + 20);
+    const uint8_t *p = pkt + JPEG_DELTA_HEADER_SIZE;
+    const uint8_t *end = pkt + len;
+
+    if (key) {
+      if (p + hdr_len > end) {
+        return fail("cabeçalho truncado");
+      }
+      header_.assign(p, p + hdr_len);
+      if (!jpeg_parse_header(header_.data(), header_.size(), &info_)) {
+        return fail("cabeçalho JPEG não suportado");
+      }
+      dc_.assign((size_t)mcus * blocks, 0);
+      bits_.assign((size_t)mcus * blocks, 0);
+      ac_.assign(mcus, std::vector<uint8_t>());
+      p += hdr_len;
+      have_key_ = true;
+    } else if (!have_key_) {
+      return fail("aguardando keyframe");
+    } else if (seq != last_seq_ + 1) {
+      lost_ += seq - last_seq_ - 1;
+    }
+    if (info_.mcu_count != mcus || info_.blocks_per_mcu != blocks) {
+      have_key_ = false;
+      return fail("geometria diverge do keyframe");
+    }
+    last_seq_ = seq;
+
+    for (uint32_t i = 0; i < changed; i++) {
+      if (p + 2 + 4 * blocks > end) {
+        return fail("registro truncado");
+      }
+      uint16_t m = get_u16(p);
+      p += 2;
+      if (m >= mcus) {
+        return fail("índice de MCU inválido");
+      }
+      size_t total = 0;
+      for (int b = 0; b < blocks; b++) {
+        dc_[(size_t)m * blocks + b] = (int16_t)get_u16(p);
+        bits_[(size_t)m * blocks + b] = get_u16(p + 2);
+        total += get_u16(p + 2);
+        p += 4;
+      }
+      size_t nbytes = (total + 7) / 8;
+      if (p + nbytes > end) {
+        return fail("bits AC truncados");
+      }
+      ac_[m].assign(p, p + nbytes);
+      p += nbytes;
+    }
+    return rebuild(jpeg);
+  }
+
+  uint32_t lost() const {
+    return lost_;
+  }
+
+ private:
+  bool fail(const char *why) {
+    fprintf(stderr, "delta: %s\n", why);
+    return false;
+  }
+
+  bool rebuild(std::vector<uint8_t> &jpeg) {
+    size_t bound = header_.size() + 2;
+    for (const auto &a : ac_) {
+      bound += a.size() * 2 + info_.blocks_per_mcu * 6;
+    }
+    jpeg.assign(bound, 0);
+    memcpy(jpeg.data(), header_.data(), header_.size());
+
+    jpeg_bit_writer_t w;
+    jpeg_bit_writer_init(&w, jpeg.data() + header_.size(), bound - header_.size() - 2, true);
+    int pred[JPEG_MCU_MAX_COMPONENTS] = {0};
+    const uint8_t blocks = info_.blocks_per_mcu;
+    for (uint32_t m = 0; m < info_.mcu_count; m++) {
+      PlainBits in = {ac_[m].data(), 0};
+      for (int b = 0; b < blocks; b++) {
+        int c = info_.block_comp[b];
+        int dc = dc_[(size_t)m * blocks + b];
+        jpeg_encode_dc(&w, &info_.dc[info_.comp_td[c]], dc - pred[c]);
+        pred[c] = dc;
+        for (int left = bits_[(size_t)m * blocks + b]; left > 0; left -= 16) {
+          int n = left > 16 ? 16 : left;
+          jpeg_bit_writer_put(&w, in.get(n), n);
+        }
+      }
+    }
+    size_t n = jpeg_bit_writer_flush(&w);
+    if (w.error) {
+      return fail("falha ao regravar o fluxo entrópico");
+    }
+    size_t total = header_.size() + n;
+    jpeg[total++] = 0xFF;
+    jpeg[total++] = 0xD9;
+    jpeg.resize(total);
+    return true;
+  }
+
+  std::vector<uint8_t> header_;
+  jpeg_info_t info_;
+  std::vector<int16_t> dc_;
+  std::vector<uint16_t> bits_;
+  std::vector<std::vector<uint8_t>> ac_;
+  bool have_key_ = false;
+  uint32_t last_seq_ = 0;
+  uint32_t lost_ = 0;
+};
+
+// Leitor bufferizado sobre um descritor (socket ou arquivo)
+class FdReader {
+ public:
+  explicit FdReader(int fd) : fd_(fd) {}
+
+  bool line(std::string &out) {
+    out.clear();
+    char c;
+    while (get(&c)) {
+      if (c == '\n') {
+        if (!out.empty() && out.back() == '\r') {
+          out.pop_back();
+        }
+        return true;
+      }
+      out.push_back(c);
+    }
+    return !out.empty();
+  }
+
+  bool read(uint8_t *dst, size_t n) {
+    while (n) {
+      if (pos_ == len_ && !refill()) {
+        return false;
+      }
+      size_t k = std::min(n, len_ - pos_);
+      memcpy(dst, buf_ + pos_, k);
+      pos_ += k;
+      dst += k;
+      n -= k;
+    }
+    return true;
+  }
+
+ private:
+  bool get(char *c) {
+    if (pos_ == len_ && !refill()) {
+      return false;
+    }
+    *c = buf_[pos_++];
+    return true;
+  }
+
+  bool refill() {
+    ssize_t r = ::read(fd_, buf_, sizeof(buf_));
+    if (r <= 0) {
+      return false;
+    }
+    pos_ = 0;
+    len_ = r;
+    return true;
+  }
+
+  int fd_;
+  uint8_t buf_[16384];
+  size_t pos_ = 0;
+  size_t len_ = 0;
+};
+
+int connect_to(const std::string &target, const std::string &query) {
+  std::string host = target;
+  std::string port = "81";
+  size_t colon = target.rfind(':');
+  if (colon != std::string::npos) {
+    host = target.substr(0, colon);
+    port = target.substr(colon + 1);
+  }
+  addrinfo hints = {};
+  hints.ai_family = AF_INET;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo *res = nullptr;
+  if (getaddrinfo(host.c_str(), port.c_str(), &hints, &res) != 0) {
+    fprintf(stderr, "não foi possível resolver %s\n", host.c_str());
+    return -1;
+  }
+  int fd = socket(res->ai_family, res->ai_socktype, 0);
+  if (fd < 0 || connect(fd, res->ai_addr, res->ai_addrlen) != 0) {
+    perror("connect");
+    freeaddrinfo(res);
+    return -1;
+  }
+  freeaddrinfo(res);
+  std::string req = "GET /delta" + (query.empty() ? "" : "?" + query) + " HTTP/1.1\r\nHost: " + host + "\r\n\r\n";
+  if (write(fd, req.data(), req.size()) != (ssize_t)req.size()) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+bool write_file(const std::string &path, const std::vector<uint8_t> &data) {
+  FILE *f = fopen(path.c_str(), "wb");
+  if (!f) {
+    return false;
+  }
+  bool ok = fwrite(data.data(), 1, data.size(), f) == data.size();
+  fclose(f);
+  return ok;
+}
+
+bool read_file(const char *path, std::vector<uint8_t> &data) {
+  FILE *f = fopen(path, "rb");
+  if (!f) {
+    return false;
+  }
+  data.clear();
+  uint8_t buf[8192];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+    data.insert(data.end(), buf, buf + n);
+  }
+  fclose(f);
+  return true;
+}
+
+void save_frame(const std::string &outdir, uint32_t index, const std::vector<uint8_t> &jpeg) {
+  if (outdir.empty()) {
+    return;
+  }
+  char name[32];
+  snprintf(name, sizeof(name), "/frame_%06u.jpg", index);
+  if (!write_file(outdir + name, jpeg)) {
+    fprintf(stderr, "falha ao gravar %s%s\n", outdir.c_str(), name);
+  }
+}
+
+// Compara MCU a MCU (DC absoluto e bits AC) dois JPEGs baseline
+bool same_scan(const std::vector<uint8_t> &a, const std::vector<uint8_t> &b) {
+  static jpeg_info_t ia, ib;
+  if (!jpeg_parse_header(a.data(), a.size(), &ia) || !jpeg_parse_header(b.data(), b.size(), &ib) || ia.mcu_count != ib.mcu_count) {
+    return false;
+  }
+  jpeg_scan_t sa, sb;
+  jpeg_scan_begin(&sa, &ia);
+  jpeg_scan_begin(&sb, &ib);
+  uint8_t ba[JPEG_MCU_MAX_BLOCKS * 208], bb[JPEG_MCU_MAX_BLOCKS * 208];
+  jpeg_block_t ka[JPEG_MCU_MAX_BLOCKS], kb[JPEG_MCU_MAX_BLOCKS];
+  for (uint32_t m = 0; m < ia.mcu_count; m++) {
+    jpeg_bit_writer_t wa, wb;
+    jpeg_bit_writer_init(&wa, ba, sizeof(ba), false);
+    jpeg_bit_writer_init(&wb, bb, sizeof(bb), false);
+    if (!jpeg_scan_mcu(&sa, ka, &wa) || !jpeg_scan_mcu(&sb, kb, &wb)) {
+      return false;
+    }
+    size_t na = jpeg_bit_writer_flush(&wa);
+    size_t nb = jpeg_bit_writer_flush(&wb);
+    if (na != nb || memcmp(ba, bb, na) != 0 || memcmp(ka, kb, sizeof(jpeg_block_t) * ia.blocks_per_mcu) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int run_stream(int fd, const std::string &outdir) {
+  FdReader in(fd);
+  DeltaReassembler re;
+  std::string line;
+  std::vector<uint8_t> pkt, jpeg;
+  uint32_t frames = 0;
+  uint64_t bytes_in = 0, bytes_out = 0;
+
+  while (in.line(line)) {
+    size_t len = 0;
+    if (strncasecmp(line.c_str(), "Content-Length:", 15) == 0) {
+      len = strtoul(line.c_str() + 15, nullptr, 10);
+    }
+    if (!len) {
+      continue;
+    }
+    // Demais cabeçalhos da parte até a linha em branco
+    while (in.line(line) && !line.empty()) {
+    }
+    pkt.resize(len);
+    if (!in.read(pkt.data(), len)) {
+      break;
+    }
+    if (!re.feed(pkt.data(), pkt.size(), jpeg)) {
+      continue;
+    }
+    bytes_in += len;
+    bytes_out += jpeg.size();
+    save_frame(outdir, frames, jpeg);
+    frames++;
+    if (frames % 30 == 0) {
+      fprintf(stderr, "%u quadros, %.1f%% dos bytes de JPEG completos, %u perdidos\n", frames, 100.0 * bytes_in / bytes_out, re.lost());
+    }
+  }
+  fprintf(stderr, "fim: %u quadros, %llu B recebidos para %llu B de JPEG\n", frames, (unsigned long long)bytes_in, (unsigned long long)bytes_out);
+  return frames ? 0 : 1;
+}
+
+int run_roundtrip(const std::vector<const char *> &files, const jpeg_delta_params_t &params, const std::string &outdir) {
+  jpeg_delta_encoder_t *enc = jpeg_delta_encoder_new(&params);
+  DeltaReassembler re;
+  std::vector<uint8_t> src, jpeg;
+  bool exact = !params.dc_threshold && !params.ac_threshold;
+  int failures = 0;
+
+  for (size_t i = 0; i < files.size(); i++) {
+    if (!read_file(files[i], src)) {
+      fprintf(stderr, "não foi possível ler %s\n", files[i]);
+      failures++;
+      continue;
+    }
+    const uint8_t *pkt = nullptr;
+    size_t len = jpeg_delta_encode(enc, src.data(), src.size(), &pkt);
+    if (!len || !re.feed(pkt, len, jpeg)) {
+      fprintf(stderr, "%s: falha na codificação\n", files[i]);
+      failures++;
+      continue;
+    }
+    bool ok = !exact || same_scan(src, jpeg);
+    failures += !ok;
+    printf("%s: %zu -> %zu B, %u MCUs alteradas%s\n", files[i], src.size(), len, jpeg_delta_get_stats(enc)->last_changed, ok ? "" : " DIVERGENTE");
+    save_frame(outdir, i, jpeg);
+  }
+  const jpeg_delta_stats_t *st = jpeg_delta_get_stats(enc);
+  printf("total: %llu -> %llu B (%.1f%%), %u keyframes, %u erros\n", (unsigned long long)st->bytes_in, (unsigned long long)st->bytes_out,
+         st->bytes_in ? 100.0 * st->bytes_out / st->bytes_in : 0.0, st->keyframes, st->errors);
+  jpeg_delta_encoder_free(enc);
+  return failures ? 1 : 0;
+}
+
+void usage() {
+  fprintf(stderr,
+          "uso: delta_reassembler [-o dir] [-q query] host[:porta]\n"
+          "     delta_reassembler [-o dir] -f captura.bin\n"
+          "     delta_reassembler [-o dir] [--key N] [--dc N] [--ac N] --roundtrip a.jpg ...\n");
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::string outdir, query, file, target;
+  jpeg_delta_params_t params = {30, 0, 0};
+  bool roundtrip = false;
+  std::vector<const char *> files;
+
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    bool has_value = i + 1 < argc;
+    if (a == "-o" && has_value) {
+      outdir = argv[++i];
+    } else if (a == "-q" && has_value) {
+      query = argv[++i];
+    } else if (a == "-f" && has_value) {
+      file = argv[++i];
+    } else if (a == "--key" && has_value) {
+      params.keyframe_interval = atoi(argv[++i]);
+    } else if (a == "--dc" && has_value) {
+      params.dc_threshold = atoi(argv[++i]);
+    } else if (a == "--ac" && has_value) {
+      params.ac_threshold = atoi(argv[++i]);
+    } else if (a == "--roundtrip") {
+      roundtrip = true;
+    } else if (roundtrip) {
+      files.push_back(argv[i]);
+    } else if (target.empty() && a[0] != '-') {
+      target = a;
+    } else {
+      usage();
+      return 2;
+    }
+  }
+
+  if (roundtrip) {
+    return run_roundtrip(files, params, outdir);
+  }
+  int fd = -1;
+  if (!file.empty()) {
+    fd = open(file.c_str(), O_RDONLY);
+    if (fd < 0) {
+      perror(file.c_str());
+    }
+  } else if (!target.empty()) {
+    fd = connect_to(target, query);
+  } else {
+    usage();
+    return 2;
+  }
+  if (fd < 0) {
+    return 1;
+  }
+  int rc = run_stream(fd, outdir);
+  close(fd);
+  return rc;
+}
@@ -0,0 +1,1182 @@
+// Simulador do firmware inteiro no Linux: setup()/loop() do sketch, o
+// WiFiManager e o servidor da câmera rodam sobre os stand-ins de tools/host,
+// com a rede WiFi, a NVS e os clientes controlados por um script.
+//
+//   firmware_sim [--script cenario.sim] [--frames dir | --synthetic LxA] [--fps N]
+//                [--nvs arquivo] [--seconds N] [--report saida.json] [--port-offset N]
+//                [--no-viewer]
+//
+// Script (uma diretiva por linha, '#' comenta; tempos em s ou ms):
+//
+//   ap CasaNet pass=segredo channel=6 rssi=-55 gateway=192.168.15.1 subnet=255.255.255.0
+//   timing scan=1500ms auth=250ms dhcp=400ms beacon=3s
+//   nvs wifi_config ssid=CasaNet password=segredo   # gravado antes do boot
+//   at 30s ap CasaNet down                          # AP some (queda de energia)
+//   at 40s ap CasaNet up
+//   at 50s ap CasaNet gateway=10.0.0.1              # próximo DHCP em outra rede
+//   at 5s portal CasaNet segredo                    # cliente envia o formulário
+//   at 20s get /reset                               # GET na porta 80
+//   at 10s scrape                                   # GET /metrics conferido no formato do Prometheus
+//   at 5s drag brightness -2 2 steps=100 every=20ms # slider arrastado no /control
+//   at 5s poll /status count=50 every=100ms         # página consultando o estado
+//   at 10s light 0.05                               # anoitecer (quadros sintéticos)
+//   at 12s mark zoom                                # próximos quadros em frame_bytes_zoom
+//   at 5s slow_viewer rate=8KB for=20s              # segundo /stream lendo 8 KB/s (rate=0: parado)
+//   at 5s rtsp transport=udp for=10s                # cliente RTSP (RTP/JPEG em udp, tcp ou multicast)
+//   at 0s broker up port=9883                       # broker MQTT do simulador (nvs mqtt host=127.0.0.1 port=9883)
+//   at 20s broker down                              # broker cai: conexões derrubadas, porta fechada
+//   at 8s scene still                               # o quadro atual se repete (cena estática); moving volta
+//   at 2s evlog fill count=40000 every=1s           # histórico sintético no log da flash, terminando agora
+//   at 9s flash fail_after=8                        # queda de energia: a flash para depois de 8 bytes
+//   at 10s flash ok                                 # ... e volta
+//   at 10s evlog remount                            # remonta o log como depois do reboot
+//   at 12s evlog query name=recent from=-1h to=0s   # GET /events (from/to relativos a agora)
+//   expect first_frame < 5s
+//   expect reconnect_max < 10s
+//   end 60s
+//
+// Um cliente de /stream (porta 81) fica conectado sempre que a estação está
+// alcançável na rede do AP (--no-viewer o desliga, para que o tools/loadgen
+// seja o único visualizador); outro testa o portal (DNS e página) enquanto o
+// softAP está no ar. Métricas, em ms desde o boot ou de duração:
+//
+//   wifi_connected       boot até o primeiro IP
+//   first_frame          boot até o primeiro quadro recebido no /stream
+//   reconnects           quedas de enlace seguidas de novo IP
+//   reconnect_max        pior queda -> novo IP
+//   reconnect_frame_max  pior queda -> primeiro quadro depois dela
+//   ap_up_frame_max      pior volta do AP (at .. up) -> primeiro quadro
+//   portal_dns           softAP no ar -> DNS respondendo com o IP do portal
+//   portal_page          softAP no ar -> GET / com 200
+//   portal_page_max      pior GET / com o portal no ar (inclui a conexão do /save)
+//   portal_scan          softAP no ar -> /scan listando alguma rede
+//   portal_probe_status  status do /generate_204 (302 leva o celular ao portal)
+//   portal_to_wifi       formulário enviado -> IP na rede nova
+//   sensor_reconfigs     mudanças de resolução/XCLK depois da inicialização da câmera
+//   drag_requests        GETs do drag respondidos com 200
+//   drag_nvs_writes      gravações na NVS do início do primeiro drag até o fim
+//   poll_requests        GETs do poll respondidos com 200
+//   poll_reg_reads       leituras de registrador no SCCB do início do primeiro poll até o fim
+//   light_switches       trocas do gainceiling do sensor depois do primeiro light
+//   light_switch_max     pior light -> troca do gainceiling
+//   frame_gap_max        maior intervalo entre quadros no /stream com o enlace de pé
+//   frame_bytes_<mark>   tamanho médio dos quadros desde o mark (antes do primeiro: start)
+//   stream_sessions      conexões do /stream aceitas (o cliente reconecta 200 ms depois de cair)
+//   slow_viewer_frames   quadros recebidos pelos slow_viewer
+//   stream_stale         quadros velhos descartados das filas das sessões (firmware)
+//   stream_downgrades    rebaixamentos de taxa de sessões lentas (firmware)
+//   stream_deadline_closes  sessões encerradas pelo prazo de envio (firmware)
+//   stream_writes_per_frame  sendmsg por quadro enviado (1 sem envio parcial)
+//   rtsp_first_frame     rtsp -> primeiro quadro remontado
+//   rtsp_frames          quadros RTP/JPEG remontados pelos clientes rtsp
+//   rtsp_bad_frames      remontados que o libjpeg não decodifica limpo (erro ou aviso)
+//   rtsp_lost            quadros perdidos por pacote faltando
+//   rtsp_sender_reports  RTCP SR coerentes recebidos (os incoerentes contam em rtsp_bad_reports)
+//   rtsp_latency_max     pior captura (pelo SR) -> quadro remontado no cliente
+//   rtsp_packets_lost    buracos na sequência RTP vistos pelos clientes rtsp
+//   rtsp_multicast_frames  quadros recebidos pelos clientes rtsp do grupo multicast
+//   rtsp_multicast_sent  quadros enviados ao grupo multicast (firmware, uma cópia cada)
+//   mqtt_events          eventos recebidos pelo broker (seq distintos)
+//   mqtt_duplicates      eventos com seq repetido (reenvio depois de uma queda)
+//   mqtt_missing         seq que nunca chegaram (anel cheio no firmware)
+//   mqtt_<tipo>_starts   eventos motion/tamper com "state":"start"
+//   mqtt_backlog_events  eventos de antes da conexão que os trouxe (o lote guardado)
+//   mqtt_live_latency_max  pior detecção -> broker dos eventos com a conexão de pé
+//   mqtt_heartbeats, mqtt_snapshots, mqtt_bad_snapshots (JPEG que o libjpeg recusa)
+//   mqtt_online          1 se a última disponibilidade retida foi "online"
+//   mqtt_flush_ms        CONNACK -> PUBACK do último evento guardado (firmware, última volta)
+//   mqtt_dropped         eventos perdidos com a fila do firmware cheia
+//   metrics_lines        linhas do último scrape
+//   metrics_bad_lines    linhas fora do formato de exposição em todos os scrape
+//   events_<name>        registros devolvidos pelo evlog query com esse nome
+//   events_query_max     pior GET /events (pedido inteiro)
+//   events_lookup_us_max pior busca no log (query_us do firmware, µs)
+//   events_logged, events_records, events_erases, events_write_errors
+//                        gravados desde a última montagem, no log, setores apagados, falhas
+//   events_torn          registros pela metade achados na última montagem
+//   frames, restarts
+//
+// Sai com 0 se todas as expectativas passaram, 1 caso contrário.
+
+// WiFi.h antes dos cabeçalhos de rede (macro INADDR_NONE, ver web_server.cpp)
+#include "WiFi.h"
+
+#include <arpa/inet.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "esp_camera.h"
+#include "esp_host.h"
+#include "esp_timer.h"
+#include "event_log.h"
+#include "http_client.h"
+#include "mqtt_broker.h"
+#include "mqtt_client.h"
+#include "rtsp_client.h"
+#include "stream_session.h"
+#include "mjpeg_writer.h"
+#include "rtsp_server.h"
+
+void setup();
+void loop();
+// jpeg_check.cpp (o jpeglib.h não convive com o boolean do Arduino.h)
+bool jpeg_decodes_clean(const uint8_t *jpeg, size_t len);
+
+namespace {
+
+struct Action {
+  int64_t at_ms;
+  std::vector<std::string> words;
+};
+
+struct Expectation {
+  std::string metric;
+  std::string op;
+  double value;
+  std::string text;
+};
+
+struct Scenario {
+  std::vector<Action> actions;
+  std::vector<Expectation> expects;
+  int64_t end_ms = 30000;
+};
+
+struct Metrics {
+  std::mutex lock;
+  std::map<std::string, double> values;
+  std::vector<std::pair<int64_t, std::string>> events;
+  bool connected = false;
+  int64_t link_lost_at = -1;
+  bool frame_pending = false;  // primeiro quadro depois de uma queda
+  int64_t ap_up_at = -1;
+  bool ap_up_pending = false;  // primeiro quadro depois de o AP voltar
+  int64_t portal_submit_at = -1;
+  int64_t ap_start_at = -1;
+  int64_t drag_nvs_start = -1;  // esp_host_nvs_writes() no primeiro drag
+  int64_t poll_reg_start = -1;  // fake_camera_reg_reads() no primeiro poll
+  int64_t light_at = -1;        // último light
+  int gainceiling = -1;         // do sensor, no último quadro
+  int64_t last_frame_at = -1;
+  std::string mark = "start";
+  std::map<std::string, std::pair<double, int>> frame_bytes;  // soma, quadros
+  std::set<uint32_t> mqtt_seqs;  // eventos recebidos pelo broker
+};
+
+Metrics metrics;
+Scenario scenario;
+std::string report_path;
+
+// Tempos do simulador contam do boot (a geração dos quadros vem antes)
+int64_t boot_us;
+
+int64_t now_ms() {
+  return (esp_timer_get_time() - boot_us) / 1000;
+}
+
+// Chamado com metrics.lock
+void event(const std::string &text) {
+  int64_t t = esp_timer_get_time() - boot_us;
+  metrics.events.push_back({t / 1000, text});
+  fprintf(stderr, "[sim %8.3f] %s\n", t / 1e6, text.c_str());
+}
+
+void set_once(const char *name, double value) {
+  if (!metrics.values.count(name)) {
+    metrics.values[name] = value;
+  }
+}
+
+void set_max(const char *name, double value) {
+  auto it = metrics.values.find(name);
+  if (it == metrics.values.end() || it->second < value) {
+    metrics.values[name] = value;
+  }
+}
+
+bool parse_duration_ms(const std::string &text, int64_t *out) {
+  char *end;
+  double v = strtod(text.c_str(), &end);
+  std::string unit = end;
+  if (end == text.c_str()) {
+    return false;
+  }
+  if (unit == "ms") {
+    *out = v;
+  } else if (unit == "s" || unit.empty()) {
+    *out = v * 1000;
+  } else if (unit == "min") {
+    *out = v * 60000;
+  } else if (unit == "h") {
+    *out = v * 3600000;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+std::map<std::string, std::string> key_values(const std::vector<std::string> &words, size_t from) {
+  std::map<std::string, std::string> kv;
+  for (size_t i = from; i < words.size(); i++) {
+    size_t eq = words[i].find('=');
+    if (eq != std::string::npos) {
+      kv[words[i].substr(0, eq)] = words[i].substr(eq + 1);
+    }
+  }
+  return kv;
+}
+
+bool load_scenario(const std::string &path) {
+  std::ifstream in(path);
+  if (!in) {
+    fprintf(stderr, "firmware_sim: não abriu %s\n", path.c_str());
+    return false;
+  }
+  std::string line;
+  int lineno = 0;
+  while (std::getline(in, line)) {
+    lineno++;
+    line = line.substr(0, line.find('#'));
+    std::istringstream ss(line);
+    std::vector<std::string> w;
+    std::string word;
+    while (ss >> word) {
+      w.push_back(word);
+    }
+    if (w.empty()) {
+      continue;
+    }
+    bool ok = true;
+    if (w[0] == "ap" && w.size() >= 2) {
+      auto kv = key_values(w, 2);
+      esp_host_wifi_add_ap(w[1].c_str(), kv["pass"].c_str(), atoi(kv["channel"].c_str()),
+                           kv.count("rssi") ? atoi(kv["rssi"].c_str()) : -60, kv.count("gateway") ? kv["gateway"].c_str() : NULL,
+                           kv.count("subnet") ? kv["subnet"].c_str() : NULL);
+    } else if (w[0] == "timing") {
+      auto kv = key_values(w, 1);
+      int64_t scan = 1500, auth = 250, dhcp = 400, beacon = 3000;
+      ok = (!kv.count("scan") || parse_duration_ms(kv["scan"], &scan)) && (!kv.count("auth") || parse_duration_ms(kv["auth"], &auth)) &&
+           (!kv.count("dhcp") || parse_duration_ms(kv["dhcp"], &dhcp)) && (!kv.count("beacon") || parse_duration_ms(kv["beacon"], &beacon));
+      esp_host_wifi_set_timing(scan, auth, dhcp, beacon);
+    } else if (w[0] == "nvs" && w.size() >= 3) {
+      for (const auto &kv : key_values(w, 2)) {
+        esp_host_nvs_set_string(w[1].c_str(), kv.first.c_str(), kv.second.c_str());
+      }
+    } else if (w[0] == "at" && w.size() >= 3) {
+      Action a;
+      ok = parse_duration_ms(w[1], &a.at_ms);
+      a.words.assign(w.begin() + 2, w.end());
+      scenario.actions.push_back(a);
+    } else if (w[0] == "expect" && w.size() == 4) {
+      Expectation e;
+      e.metric = w[1];
+      e.op = w[2];
+      e.text = w[1] + " " + w[2] + " " + w[3];
+      int64_t ms;
+      bool is_time = w[3].find_first_not_of("0123456789.") != std::string::npos;
+      ok = is_time ? parse_duration_ms(w[3], &ms) : true;
+      e.value = is_time ? ms : atof(w[3].c_str());
+      scenario.expects.push_back(e);
+    } else if (w[0] == "end" && w.size() == 2) {
+      ok = parse_duration_ms(w[1], &scenario.end_ms);
+    } else {
+      ok = false;
+    }
+    if (!ok) {
+      fprintf(stderr, "%s:%d: diretiva inválida: %s\n", path.c_str(), lineno, line.c_str());
+      return false;
+    }
+  }
+  std::sort(scenario.actions.begin(), scenario.actions.end(), [](const Action &a, const Action &b) { return a.at_ms < b.at_ms; });
+  return true;
+}
+
+void on_wifi_event(arduino_event_id_t id, arduino_event_info_t info) {
+  std::lock_guard<std::mutex> guard(metrics.lock);
+  int64_t t = now_ms();
+  switch (id) {
+    case ARDUINO_EVENT_WIFI_STA_GOT_IP: {
+      IPAddress ip(info.got_ip.ip_info.ip.addr);
+      event("wifi got ip " + std::string(ip.toString().c_str()));
+      set_once("wifi_connected", t);
+      // Um GOT_IP com o enlace já de pé é só troca de endereço (IP fixo)
+      if (metrics.link_lost_at >= 0 && !metrics.connected) {
+        metrics.values["reconnects"] += 1;
+        set_max("reconnect_max", t - metrics.link_lost_at);
+      }
+      if (metrics.portal_submit_at >= 0) {
+        set_once("portal_to_wifi", t - metrics.portal_submit_at);
+      }
+      metrics.connected = true;
+      break;
+    }
+    case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+      event("wifi disconnected reason " + std::to_string(info.wifi_sta_disconnected.reason));
+      if (metrics.connected) {
+        metrics.connected = false;
+        metrics.link_lost_at = t;
+        metrics.frame_pending = true;
+      }
+      break;
+    case ARDUINO_EVENT_WIFI_AP_START:
+      event("softap start");
+      metrics.ap_start_at = t;
+      break;
+    case ARDUINO_EVENT_WIFI_AP_STOP:
+      event("softap stop");
+      break;
+    default:
+      break;
+  }
+}
+
+void on_frame(size_t len) {
+  std::lock_guard<std::mutex> guard(metrics.lock);
+  int64_t t = now_ms();
+  if (!metrics.values.count("first_frame")) {
+    event("first frame");
+    metrics.values["first_frame"] = t;
+  }
+  if (metrics.frame_pending && metrics.link_lost_at >= 0) {
+    event("first frame after reconnect");
+    set_max("reconnect_frame_max", t - metrics.link_lost_at);
+    metrics.frame_pending = false;
+  }
+  if (metrics.ap_up_pending) {
+    set_max("ap_up_frame_max", t - metrics.ap_up_at);
+    metrics.ap_up_pending = false;
+  }
+  metrics.values["frames"] += 1;
+  auto &bytes = metrics.frame_bytes[metrics.mark];
+  bytes.first += len;
+  bytes.second++;
+  metrics.values["frame_bytes_" + metrics.mark] = bytes.first / bytes.second;
+
+  // O perfil de noite muda o teto do AGC: cada troca conta a partir do light
+  sensor_t *s = esp_camera_sensor_get();
+  if (s && metrics.light_at >= 0 && metrics.gainceiling >= 0 && s->status.gainceiling != metrics.gainceiling) {
+    event("gainceiling " + std::to_string(metrics.gainceiling) + " -> " + std::to_string(s->status.gainceiling));
+    metrics.values["light_switches"] += 1;
+    set_max("light_switch_max", t - metrics.light_at);
+  }
+  if (s) {
+    metrics.gainceiling = s->status.gainceiling;
+  }
+  if (metrics.last_frame_at >= 0 && metrics.connected && !metrics.frame_pending) {
+    set_max("frame_gap_max", t - metrics.last_frame_at);
+  }
+  metrics.last_frame_at = t;
+}
+
+// Cliente da rede local: assiste ao /stream enquanto a estação é alcançável
+void stream_client() {
+  pthread_setname_np(pthread_self(), "sim stream");
+  for (;;) {
+    if (!esp_host_wifi_sta_reachable_ip()) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      continue;
+    }
+    int fd = http::connect_tcp("127.0.0.1", esp_host_port(81), 2000);
+    if (fd < 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      continue;
+    }
+    http::Reader rd(fd);
+    int status = 0;
+    std::map<std::string, std::string> headers;
+    if (http::send_request(fd, "GET", "/stream", "esp32-cam") && rd.read_headers(&status, &headers) && status == 200) {
+      {
+        std::lock_guard<std::mutex> guard(metrics.lock);
+        metrics.values["stream_sessions"] += 1;
+      }
+      http::MultipartReader parts(&rd);
+      http::Part part;
+      const char *data;
+      // Quadro que chega depois da queda do enlace não conta
+      while (parts.next(&part, &data) && esp_host_wifi_sta_reachable_ip()) {
+        on_frame(part.len);
+      }
+    }
+    close(fd);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  }
+}
+
+// Consulta A de um nome qualquer ao DNS do portal; devolve o IP respondido
+uint32_t dns_query(const char *name) {
+  int fd = socket(AF_INET, SOCK_DGRAM, 0);
+  timeval tv = {2, 0};  // o celular espera alguns segundos antes de repetir
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+  uint8_t q[512] = {0x12, 0x34, 0x01, 0x00, 0, 1, 0, 0, 0, 0, 0, 0};
+  size_t len = 12;
+  for (const char *label = name; *label;) {
+    const char *dot = strchr(label, '.');
+    size_t n = dot ? (size_t)(dot - label) : strlen(label);
+    q[len++] = n;
+    memcpy(q + len, label, n);
+    len += n;
+    label += n + (dot ? 1 : 0);
+  }
+  const uint8_t tail[] = {0, 0, 1, 0, 1};
+  memcpy(q + len, tail, sizeof(tail));
+  len += sizeof(tail);
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(esp_host_port(53));
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  sendto(fd, q, len, 0, (sockaddr *)&addr, sizeof(addr));
+  uint8_t r[512];
+  ssize_t n = recv(fd, r, sizeof(r), 0);
+  close(fd);
+  // Resposta com uma pergunta igual à enviada e o registro A logo depois
+  if (n < (ssize_t)len + 16 || r[0] != 0x12 || r[1] != 0x34 || r[7] < 1) {
+    return 0;
+  }
+  uint32_t ip;
+  memcpy(&ip, r + len + 12, 4);
+  return ip;
+}
+
+int http_status(const std::string &method, const std::string &path, const std::string &body = "",
+                std::string *response = NULL) {
+  int fd = http::connect_tcp("127.0.0.1", esp_host_port(80), 5000);
+  if (fd < 0) {
+    return -1;
+  }
+  http::Reader rd(fd);
+  int status = -1;
+  std::map<std::string, std::string> headers;
+  if (!http::send_request(fd, method, path, "192.168.4.1", body, body.empty() ? "" : "application/x-www-form-urlencoded") ||
+      !rd.read_headers(&status, &headers)) {
+    status = -1;
+  } else {
+    std::string text = rd.read_body();
+    if (response) {
+      *response = text;
+    }
+  }
+  close(fd);
+  return status;
+}
+
+// Celular conectado ao softAP: DNS cativo, página de configuração e a
+// checagem de conectividade que decide se o sistema abre o portal
+void portal_client() {
+  pthread_setname_np(pthread_self(), "sim portal");
+  bool dns_ok = false, page_ok = false, probed = false, scanned = false;
+  for (;;) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    if (!esp_host_wifi_softap_active()) {
+      dns_ok = page_ok = probed = scanned = false;
+      continue;
+    }
+    if (!dns_ok) {
+      IPAddress ip(dns_query("connectivitycheck.gstatic.com"));
+      if (ip == IPAddress(192, 168, 4, 1) || (uint32_t)ip == (uint32_t)WiFi.softAPIP()) {
+        std::lock_guard<std::mutex> guard(metrics.lock);
+        dns_ok = true;
+        event("portal dns ok");
+        set_once("portal_dns", now_ms() - metrics.ap_start_at);
+      }
+    }
+    {
+      // Depois da primeira, cada página mede a latência do portal
+      int64_t start = esp_timer_get_time();
+      int status = http_status("GET", "/");
+      double took_ms = (esp_timer_get_time() - start) / 1000.0;
+      std::lock_guard<std::mutex> guard(metrics.lock);
+      if (status == 200 && page_ok) {
+        set_max("portal_page_max", took_ms);
+      } else if (status == 200) {
+        page_ok = true;
+        event("portal page ok");
+        set_once("portal_page", now_ms() - metrics.ap_start_at);
+      }
+    }
+    if (page_ok && !scanned) {
+      std::string body;
+      if (http_status("GET", "/scan", "", &body) == 200 && body.find("\"ssid\"") != std::string::npos) {
+        std::lock_guard<std::mutex> guard(metrics.lock);
+        scanned = true;
+        event("portal scan ok");
+        set_once("portal_scan", now_ms() - metrics.ap_start_at);
+      }
+    }
+    if (page_ok && !probed) {
+      int status = http_status("GET", "/generate_204");
+      std::lock_guard<std::mutex> guard(metrics.lock);
+      probed = true;
+      event("portal probe /generate_204 -> " + std::to_string(status));
+      set_once("portal_probe_status", status);
+    }
+  }
+}
+
+bool metric_name_ok(const std::string &name) {
+  if (name.empty() || !(isalpha((unsigned char)name[0]) || name[0] == '_' || name[0] == ':')) {
+    return false;
+  }
+  for (char c : name) {
+    if (!(isalnum((unsigned char)c) || c == '_' || c == ':')) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Confere o texto do /metrics no formato de exposição do Prometheus: HELP e
+// TYPE bem formados e um por família, TYPE antes das amostras, rótulos entre
+// aspas e valor numérico. Retorna as linhas inválidas (a primeira em *first_bad).
+int exposition_errors(const std::string &text, int *lines, std::string *first_bad) {
+  std::map<std::string, std::string> types;
+  std::set<std::string> helps;
+  std::istringstream in(text);
+  std::string line;
+  int bad = 0;
+  *lines = 0;
+  while (std::getline(in, line)) {
+    (*lines)++;
+    bool ok = false;
+    if (line.compare(0, 7, "# HELP ") == 0) {
+      std::string name = line.substr(7, line.find(' ', 7) - 7);
+      ok = metric_name_ok(name) && line.size() > 8 + name.size() && helps.insert(name).second;
+    } else if (line.compare(0, 7, "# TYPE ") == 0) {
+      std::istringstream ss(line.substr(7));
+      std::string name, type, extra;
+      ss >> name >> type;
+      ok = metric_name_ok(name) && !(ss >> extra) && !types.count(name) &&
+           (type == "counter" || type == "gauge" || type == "histogram" || type == "summary" || type == "untyped");
+      types[name] = type;
+    } else if (!line.empty() && line[0] != '#') {
+      size_t end = line.find_first_of("{ ");
+      std::string name = line.substr(0, end);
+      std::string family = name;
+      for (const char *suffix : {"_bucket", "_sum", "_count"}) {
+        size_t n = strlen(suffix);
+        if (!types.count(family) && name.size() > n && name.compare(name.size() - n, n, suffix) == 0 &&
+            types.count(name.substr(0, name.size() - n)) && types[name.substr(0, name.size() - n)] == "histogram") {
+          family = name.substr(0, name.size() - n);
+        }
+      }
+      ok = metric_name_ok(name) && types.count(family) && end != std::string::npos;
+      size_t pos = end;
+      if (ok && line[pos] == '{') {
+        // k="v" separados por vírgula, com \\, \" e \n escapados
+        pos++;
+        while (ok && line[pos] != '}') {
+          size_t eq = line.find('=', pos);
+          ok = eq != std::string::npos && metric_name_ok(line.substr(pos, eq - pos)) && line[eq + 1] == '"';
+          pos = eq + 2;
+          while (ok && pos < line.size() && line[pos] != '"') {
+            pos += line[pos] == '\\' ? 2 : 1;
+          }
+          ok = ok && pos < line.size();
+          pos++;
+          if (ok && line[pos] == ',') {
+            pos++;
+          }
+          ok = ok && pos < line.size();
+        }
+        pos++;
+      }
+      if (ok) {
+        ok = line[pos] == ' ';
+        std::string value = line.substr(pos + 1);
+        value = value.substr(0, value.find(' '));  // timestamp opcional depois
+        char *stop = nullptr;
+        strtod(value.c_str(), &stop);
+        ok = ok && !value.empty() && (*stop == 0 || value == "+Inf" || value == "-Inf" || value == "NaN");
+      }
+    }
+    if (!ok) {
+      if (!bad) {
+        *first_bad = line;
+      }
+      bad++;
+    }
+  }
+  return bad;
+}
+
+std::string url_encode(const std::string &s) {
+  std::string out;
+  char buf[4];
+  for (unsigned char c : s) {
+    if (isalnum(c) || c == '-' || c == '_' || c == '.') {
+      out += c;
+    } else {
+      snprintf(buf, sizeof(buf), "%%%02X", c);
+      out += buf;
+    }
+  }
+  return out;
+}
+
+// Número ou texto de um membro do JSON dos eventos (sem aninhamento)
+std::string json_member(const std::string &json, const std::string &key) {
+  size_t at = json.find("\"" + key + "\":");
+  if (at == std::string::npos) {
+    return "";
+  }
+  at += key.size() + 3;
+  if (json[at] == '"') {
+    return json.substr(at + 1, json.find('"', at + 1) - at - 1);
+  }
+  return json.substr(at, json.find_first_of(",}", at) - at);
+}
+
+void on_mqtt_publish(const mqtt_broker::Publish &p) {
+  // O prefixo pode ter barras: o que interessa é o fim do tópico
+  size_t event_at = p.topic.find("/event/");
+  std::string what = event_at != std::string::npos ? p.topic.substr(event_at + 1) : p.topic.substr(p.topic.rfind('/') + 1);
+  bool bad_snapshot = what == "snapshot" && !jpeg_decodes_clean((const uint8_t *)p.payload.data(), p.payload.size());
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  int64_t now_us = (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+
+  std::lock_guard<std::mutex> guard(metrics.lock);
+  if (what == "status") {
+    metrics.values["mqtt_heartbeats"] += 1;
+  } else if (what == "snapshot") {
+    metrics.values["mqtt_snapshots"] += 1;
+    metrics.values["mqtt_bad_snapshots"] += bad_snapshot;
+  } else if (what == "availability") {
+    metrics.values["mqtt_online"] = p.payload == "online";
+    event("mqtt " + p.topic + " " + p.payload + (p.will ? " (testamento)" : ""));
+  } else if (what.compare(0, 6, "event/") == 0) {
+    uint32_t seq = strtoul(json_member(p.payload, "seq").c_str(), nullptr, 10);
+    int64_t detected_us = atof(json_member(p.payload, "time").c_str()) * 1e6;
+    if (!metrics.mqtt_seqs.insert(seq).second) {
+      metrics.values["mqtt_duplicates"] += 1;
+      return;
+    }
+    metrics.values["mqtt_events"] += 1;
+    if (json_member(p.payload, "state") == "start") {
+      metrics.values["mqtt_" + json_member(p.payload, "type") + "_starts"] += 1;
+    }
+    if (detected_us > p.session_us) {
+      set_max("mqtt_live_latency_max", (now_us - detected_us) / 1000.0);
+    } else {
+      metrics.values["mqtt_backlog_events"] += 1;
+    }
+    event("mqtt " + p.topic + (p.dup ? " (dup) " : " ") + p.payload);
+  }
+}
+
+void run_action(const Action &a) {
+  const auto &w = a.words;
+  {
+    std::lock_guard<std::mutex> guard(metrics.lock);
+    std::string text;
+    for (const auto &word : w) {
+      text += (text.empty() ? "" : " ") + word;
+    }
+    event("script: " + text);
+  }
+  if (w[0] == "ap" && w.size() >= 3) {
+    if (w[2] == "down" || w[2] == "up") {
+      esp_host_wifi_set_ap_up(w[1].c_str(), w[2] == "up");
+      if (w[2] == "up") {
+        std::lock_guard<std::mutex> guard(metrics.lock);
+        metrics.ap_up_at = now_ms();
+        metrics.ap_up_pending = true;
+      }
+    } else {
+      auto kv = key_values(w, 2);
+      esp_host_wifi_set_ap_network(w[1].c_str(), kv.count("gateway") ? kv["gateway"].c_str() : NULL,
+                                   kv.count("subnet") ? kv["subnet"].c_str() : NULL);
+    }
+  } else if (w[0] == "portal" && w.size() >= 2) {
+    std::string body = "ssid=" + url_encode(w[1]) + "&password=" + url_encode(w.size() > 2 ? w[2] : "");
+    {
+      std::lock_guard<std::mutex> guard(metrics.lock);
+      metrics.portal_submit_at = now_ms();
+    }
+    std::thread([body] {
+      int status = http_status("POST", "/save", body);
+      std::lock_guard<std::mutex> guard(metrics.lock);
+      event("portal /save -> " + std::to_string(status));
+    }).detach();
+  } else if (w[0] == "drag" && w.size() >= 4) {
+    // Valores de FROM a TO, um GET /control por passo
+    auto kv = key_values(w, 4);
+    std::string var = w[1];
+    int from = atoi(w[2].c_str()), to = atoi(w[3].c_str());
+    int steps = kv.count("steps") ? atoi(kv["steps"].c_str()) : 10;
+    int64_t every = 50;
+    if (kv.count("every")) {
+      parse_duration_ms(kv["every"], &every);
+    }
+    {
+      std::lock_guard<std::mutex> guard(metrics.lock);
+      if (metrics.drag_nvs_start < 0) {
+        metrics.drag_nvs_start = esp_host_nvs_writes();
+      }
+    }
+    std::thread([var, from, to, steps, every] {
+      int ok = 0;
+      for (int i = 0; i < steps; i++) {
+        int v = steps > 1 ? from + (to - from) * i / (steps - 1) : to;
+        if (http_status("GET", "/control?var=" + var + "&val=" + std::to_string(v)) == 200) {
+          ok++;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(every));
+      }
+      std::lock_guard<std::mutex> guard(metrics.lock);
+      metrics.values["drag_requests"] += ok;
+      event("drag " + var + " done: " + std::to_string(ok) + "/" + std::to_string(steps));
+    }).detach();
+  } else if (w[0] == "poll" && w.size() >= 2) {
+    // Mesmo GET repetido, como a página da câmera atualizando o estado
+    auto kv = key_values(w, 2);
+    std::string path = w[1];
+    int count = kv.count("count") ? atoi(kv["count"].c_str()) : 10;
+    int64_t every = 100;
+    if (kv.count("every")) {
+      parse_duration_ms(kv["every"], &every);
+    }
+    {
+      std::lock_guard<std::mutex> guard(metrics.lock);
+      if (metrics.poll_reg_start < 0) {
+        metrics.poll_reg_start = fake_camera_reg_reads();
+      }
+    }
+    std::thread([path, count, every] {
+      int ok = 0;
+      for (int i = 0; i < count; i++) {
+        if (http_status("GET", path) == 200) {
+          ok++;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(every));
+      }
+      std::lock_guard<std::mutex> guard(metrics.lock);
+      metrics.values["poll_requests"] += ok;
+      event("poll " + path + " done: " + std::to_string(ok) + "/" + std::to_string(count));
+    }).detach();
+  } else if (w[0] == "slow_viewer") {
+    // Cliente de /stream num enlace ruim: janela TCP pequena e leitura
+    // limitada a rate bytes/s; com rate=0 não lê nada depois dos cabeçalhos
+    auto kv = key_values(w, 1);
+    int64_t rate = kv.count("rate") ? atoll(kv["rate"].c_str()) : 0;
+    if (kv.count("rate") && kv["rate"].back() == 'B' && toupper(kv["rate"][kv["rate"].size() - 2]) == 'K') {
+      rate *= 1024;
+    }
+    int64_t duration = 10000;
+    if (kv.count("for")) {
+      parse_duration_ms(kv["for"], &duration);
+    }
+    std::thread([rate, duration] {
+      int fd = http::connect_tcp("127.0.0.1", esp_host_port(81), 2000, 4096);
+      if (fd < 0) {
+        return;
+      }
+      http::send_request(fd, "GET", "/stream", "esp32-cam");
+      int64_t end = now_ms() + duration;
+      size_t total = 0, boundaries = 0;
+      char buf[512];
+      const char *marker = "--123456789000000000000987654321";
+      size_t matched = 0;
+      while (now_ms() < end) {
+        if (!rate) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(50));
+          continue;
+        }
+        ssize_t n = recv(fd, buf, sizeof(buf), MSG_DONTWAIT);
+        if (n == 0) {
+          break;
+        }
+        for (ssize_t i = 0; i < n; i++) {
+          matched = buf[i] == marker[matched] ? matched + 1 : buf[i] == marker[0];
+          if (!marker[matched]) {
+            boundaries++;
+            matched = 0;
+          }
+        }
+        total += n > 0 ? n : 0;
+        std::this_thread::sleep_for(std::chrono::milliseconds(n > 0 ? n * 1000 / rate : 20));
+      }
+      close(fd);
+      std::lock_guard<std::mutex> guard(metrics.lock);
+      // A primeira fronteira vem antes do primeiro quadro
+      metrics.values["slow_viewer_frames"] += boundaries ? boundaries - 1 : 0;
+      event("slow viewer done: " + std::to_string(total) + " bytes");
+    }).detach();
+  } else if (w[0] == "rtsp") {
+    auto kv = key_values(w, 1);
+    std::string name = kv.count("transport") ? kv["transport"] : "udp";
+    rtsp::Transport transport = name == "tcp" ? rtsp::kTcp : name == "multicast" ? rtsp::kMulticast : rtsp::kUdp;
+    int64_t duration = 10000;
+    if (kv.count("for")) {
+      parse_duration_ms(kv["for"], &duration);
+    }
+    std::thread([name, transport, duration] {
+      int64_t start = now_ms();
+      rtsp::Client client;
+      std::string error;
+      std::string url = "rtsp://127.0.0.1:" + std::to_string(esp_host_port(554)) + "/mjpeg";
+      if (!client.open(url, transport, &error)) {
+        std::lock_guard<std::mutex> guard(metrics.lock);
+        event("rtsp " + url + ": " + error);
+        return;
+      }
+      rtsp::Frame frame;
+      uint32_t bad = 0;
+      int64_t latency_max = 0;
+      while (now_ms() - start < duration) {
+        if (!client.next_frame(&frame, 500)) {
+          continue;
+        }
+        {
+          std::lock_guard<std::mutex> guard(metrics.lock);
+          set_once("rtsp_first_frame", now_ms() - start);
+        }
+        bad += !jpeg_decodes_clean(frame.jpeg, frame.len);
+        if (frame.wall_us) {
+          latency_max = std::max(latency_max, frame.received_us - frame.wall_us);
+        }
+      }
+      client.teardown();
+      const rtsp::Stats &stats = client.stats();
+      std::lock_guard<std::mutex> guard(metrics.lock);
+      metrics.values["rtsp_frames"] += stats.frames;
+      metrics.values["rtsp_bad_frames"] += bad;
+      metrics.values["rtsp_lost"] += stats.lost;
+      metrics.values["rtsp_packets_lost"] += stats.packets_lost;
+      if (transport == rtsp::kMulticast) {
+        metrics.values["rtsp_multicast_frames"] += stats.frames;
+      }
+      metrics.values["rtsp_sender_reports"] += stats.sender_reports;
+      metrics.values["rtsp_bad_reports"] += stats.bad_reports;
+      set_max("rtsp_latency_max", latency_max / 1000.0);
+      event("rtsp " + name + " done: " + std::to_string(stats.frames) + " frames, " +
+            std::to_string(stats.lost) + " lost");
+    }).detach();
+  } else if (w[0] == "broker" && w.size() >= 2) {
+    auto kv = key_values(w, 2);
+    if (w[1] == "down") {
+      mqtt_broker::stop();
+    } else if (!mqtt_broker::start(kv.count("port") ? atoi(kv["port"].c_str()) : 1883, on_mqtt_publish)) {
+      std::lock_guard<std::mutex> guard(metrics.lock);
+      event("broker: porta ocupada");
+    }
+  } else if (w[0] == "scene" && w.size() == 2) {
+    fake_camera_freeze(w[1] == "still");
+  } else if (w[0] == "flash" && w.size() == 2) {
+    // Queda de energia: a flash para de gravar depois de fail_after bytes
+    auto kv = key_values(w, 1);
+    esp_host_flash_fail_after(kv.count("fail_after") ? atoi(kv["fail_after"].c_str()) : 0);
+  } else if (w[0] == "evlog" && w.size() >= 2 && w[1] == "remount") {
+    event_log_begin();
+  } else if (w[0] == "evlog" && w.size() >= 2 && w[1] == "fill") {
+    // Histórico sintético: count eventos, um a cada every, terminando agora
+    auto kv = key_values(w, 2);
+    int count = kv.count("count") ? atoi(kv["count"].c_str()) : 1;
+    int64_t every = 1000;
+    if (kv.count("every")) {
+      parse_duration_ms(kv["every"], &every);
+    }
+    std::thread([count, every] {
+      int64_t now = http::wall_us() / 1000;
+      for (int i = 0; i < count; i++) {
+        event_log_entry_t e = {};
+        e.time_ms = now - (int64_t)(count - 1 - i) * every;
+        e.type = EVENT_LOG_MOTION;
+        e.flags = i % 2 ? EVENT_LOG_END : 0;
+        e.score = i % 100;
+        e.box[2] = e.box[3] = 255;
+        // A fila da tarefa é curta: espera ela andar
+        while (!event_log_append(&e)) {
+          std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+      }
+      std::lock_guard<std::mutex> guard(metrics.lock);
+      event("evlog fill done: " + std::to_string(count));
+    }).detach();
+  } else if (w[0] == "evlog" && w.size() >= 2 && w[1] == "query") {
+    // GET /events com from/to relativos a agora; events_<name> = registros devolvidos
+    auto kv = key_values(w, 2);
+    int64_t from = 0, to = 0;
+    parse_duration_ms(kv.count("from") ? kv["from"] : "-1h", &from);
+    parse_duration_ms(kv.count("to") ? kv["to"] : "0s", &to);
+    std::string name = kv.count("name") ? kv["name"] : "query";
+    int64_t now = http::wall_us() / 1000;
+    char path[160];
+    snprintf(path, sizeof(path), "/events?from=%.3f&to=%.3f&limit=%s%s%s", (now + from) / 1000.0, (now + to) / 1000.0,
+             kv.count("limit") ? kv["limit"].c_str() : "256", kv.count("type") ? "&type=" : "", kv.count("type") ? kv["type"].c_str() : "");
+    std::thread([name, path = std::string(path)] {
+      std::string body;
+      int64_t start = http::wall_us();
+      int status = http_status("GET", path, "", &body);
+      double elapsed_ms = (http::wall_us() - start) / 1000.0;
+      std::lock_guard<std::mutex> guard(metrics.lock);
+      if (status == 200) {
+        metrics.values["events_" + name] = atoi(json_member(body, "count").c_str());
+        set_max("events_query_max", elapsed_ms);
+        set_max("events_lookup_us_max", atof(json_member(body, "query_us").c_str()));
+      }
+      event("GET " + path + " -> " + std::to_string(status) + " " + body.substr(0, 160));
+    }).detach();
+  } else if (w[0] == "scrape" && w.size() == 1) {
+    // GET /metrics conferido linha a linha como o Prometheus faria
+    std::thread([] {
+      std::string body, first_bad;
+      int status = http_status("GET", "/metrics", "", &body);
+      int lines = 0;
+      int bad = status == 200 ? exposition_errors(body, &lines, &first_bad) : 1;
+      std::lock_guard<std::mutex> guard(metrics.lock);
+      metrics.values["metrics_bad_lines"] += bad;
+      metrics.values["metrics_lines"] = lines;
+      event("scrape /metrics -> " + std::to_string(status) + ", " + std::to_string(lines) + " lines, " + std::to_string(bad) + " bad" +
+            (bad ? ": " + first_bad : ""));
+    }).detach();
+  } else if (w[0] == "mark" && w.size() == 2) {
+    std::lock_guard<std::mutex> guard(metrics.lock);
+    metrics.mark = w[1];
+  } else if (w[0] == "light" && w.size() == 2) {
+    fake_camera_set_light(atof(w[1].c_str()));
+    std::lock_guard<std::mutex> guard(metrics.lock);
+    metrics.light_at = now_ms();
+  } else if (w[0] == "get" && w.size() == 2) {
+    std::string path = w[1];
+    std::thread([path] {
+      int status = http_status("GET", path);
+      std::lock_guard<std::mutex> guard(metrics.lock);
+      event("GET " + path + " -> " + std::to_string(status));
+    }).detach();
+  }
+}
+
+void write_json_string(FILE *f, const std::string &s) {
+  fputc('"', f);
+  for (char c : s) {
+    if (c == '"' || c == '\\') {
+      fputc('\\', f);
+    }
+    fputc(c, f);
+  }
+  fputc('"', f);
+}
+
+[[noreturn]] void finish(bool restarted) {
+  std::lock_guard<std::mutex> guard(metrics.lock);
+  if (restarted) {
+    metrics.values["restarts"] += 1;
+    event("ESP.restart()");
+  }
+  metrics.values["sensor_reconfigs"] = fake_camera_reconfigs();
+  if (metrics.drag_nvs_start >= 0) {
+    metrics.values["drag_nvs_writes"] = esp_host_nvs_writes() - metrics.drag_nvs_start;
+  }
+  if (metrics.poll_reg_start >= 0) {
+    metrics.values["poll_reg_reads"] = fake_camera_reg_reads() - metrics.poll_reg_start;
+  }
+  stream_session_totals_t totals;
+  stream_session_get_totals(&totals);
+  metrics.values["stream_stale"] = totals.stale;
+  metrics.values["stream_downgrades"] = totals.downgrades;
+  metrics.values["stream_deadline_closes"] = totals.deadline_closes;
+  mjpeg_writer_stats_t writer;
+  mjpeg_writer_get_stats(&writer);
+  rtsp_server_stats_t rtsp_stats;
+  rtsp_server_get_stats(&rtsp_stats);
+  if (rtsp_stats.multicast_frames) {
+    metrics.values["rtsp_multicast_sent"] = rtsp_stats.multicast_frames;
+  }
+  mqtt_client_stats_t mqtt;
+  mqtt_client_get_stats(&mqtt);
+  if (mqtt.enabled) {
+    metrics.values["mqtt_dropped"] = mqtt.dropped;
+    if (!metrics.mqtt_seqs.empty()) {
+      metrics.values["mqtt_missing"] = *metrics.mqtt_seqs.rbegin() - metrics.mqtt_seqs.size();
+    }
+    if (mqtt.connects > 1) {
+      metrics.values["mqtt_flush_ms"] = mqtt.last_flush_ms;
+    }
+  }
+  event_log_stats_t evlog;
+  event_log_get_stats(&evlog);
+  if (evlog.mounted) {
+    metrics.values["events_logged"] = evlog.appended;
+    metrics.values["events_records"] = evlog.records;
+    metrics.values["events_torn"] = evlog.torn;
+    metrics.values["events_write_errors"] = evlog.write_errors;
+    metrics.values["events_erases"] = evlog.erases;
+  }
+  if (writer.parts) {
+    metrics.values["stream_writes_per_frame"] = (double)writer.writes / writer.parts;
+  }
+  bool all_ok = true;
+  std::vector<bool> results;
+  for (const Expectation &e : scenario.expects) {
+    auto it = metrics.values.find(e.metric);
+    double v = it == metrics.values.end() ? (e.metric == "reconnects" || e.metric == "frames" || e.metric == "restarts" ? 0 : -1) : it->second;
+    bool ok = v >= 0 && ((e.op == "<" && v < e.value) || (e.op == "<=" && v <= e.value) || (e.op == ">" && v > e.value) ||
+                         (e.op == ">=" && v >= e.value) || (e.op == "==" && v == e.value));
+    results.push_back(ok);
+    all_ok = all_ok && ok;
+  }
+
+  fprintf(stderr, "\n== firmware_sim\n");
+  for (const auto &m : metrics.values) {
+    fprintf(stderr, "  %-22s %10.0f\n", m.first.c_str(), m.second);
+  }
+  for (size_t i = 0; i < scenario.expects.size(); i++) {
+    const Expectation &e = scenario.expects[i];
+    auto it = metrics.values.find(e.metric);
+    fprintf(stderr, "  %s  expect %s (obtido %s)\n", results[i] ? "ok  " : "FAIL", e.text.c_str(),
+            it == metrics.values.end() ? "n/a" : std::to_string((long long)it->second).c_str());
+  }
+
+  if (!report_path.empty()) {
+    FILE *f = fopen(report_path.c_str(), "w");
+    if (f) {
+      fprintf(f, "{\"metrics\":{");
+      bool first = true;
+      for (const auto &m : metrics.values) {
+        fprintf(f, "%s", first ? "" : ",");
+        write_json_string(f, m.first);
+        fprintf(f, ":%.0f", m.second);
+        first = false;
+      }
+      fprintf(f, "},\"expectations\":[");
+      for (size_t i = 0; i < scenario.expects.size(); i++) {
+        fprintf(f, "%s{\"expect\":", i ? "," : "");
+        write_json_string(f, scenario.expects[i].text);
+        fprintf(f, ",\"ok\":%s}", results[i] ? "true" : "false");
+      }
+      fprintf(f, "],\"events\":[");
+      for (size_t i = 0; i < metrics.events.size(); i++) {
+        fprintf(f, "%s{\"t_ms\":%lld,\"event\":", i ? "," : "", (long long)metrics.events[i].first);
+        write_json_string(f, metrics.events[i].second);
+        fputc('}', f);
+      }
+      fprintf(f, "]}\n");
+      fclose(f);
+    }
+  }
+  fflush(stdout);
+  fflush(stderr);
+  _exit(all_ok ? 0 : 1);
+}
+
+void on_restart() {
+  finish(true);
+}
+
+void script_runner() {
+  pthread_setname_np(pthread_self(), "sim script");
+  for (const Action &a : scenario.actions) {
+    int64_t wait = a.at_ms - now_ms();
+    if (wait > 0) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(wait));
+    }
+    run_action(a);
+  }
+}
+
+void usage() {
+  fprintf(stderr,
+          "uso: firmware_sim [--script arquivo] [--frames dir | --synthetic LxA] [--fps N]\n"
+          "                  [--nvs arquivo] [--seconds N] [--report saida.json] [--port-offset N]\n"
+          "                  [--no-viewer]\n");
+  exit(2);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  pthread_setname_np(pthread_self(), "loopTask");
+  std::string script, frames_dir, nvs_path;
+  int width = 800, height = 600, seconds = 0;
+  float fps = 25;
+  bool viewer = true;
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    auto next = [&]() -> const char * {
+      if (i + 1 >= argc) {
+        usage();
+      }
+      return argv[++i];
+    };
+    if (a == "--script") {
+      script = next();
+    } else if (a == "--frames") {
+      frames_dir = next();
+    } else if (a == "--synthetic") {
+      if (sscanf(next(), "%dx%d", &width, &height) != 2) {
+        usage();
+      }
+    } else if (a == "--fps") {
+      fps = atof(next());
+    } else if (a == "--nvs") {
+      nvs_path = next();
+    } else if (a == "--seconds") {
+      seconds = atoi(next());
+    } else if (a == "--report") {
+      report_path = next();
+    } else if (a == "--port-offset") {
+      setenv("ESP_HOST_PORT_OFFSET", next(), 1);
+    } else if (a == "--no-viewer") {
+      viewer = false;
+    } else {
+      usage();
+    }
+  }
+
+  if (!nvs_path.empty()) {
+    esp_host_nvs_open(nvs_path.c_str());
+  }
+  if (!script.empty() && !load_scenario(script)) {
+    return 2;
+  }
+  if (seconds > 0) {
+    scenario.end_ms = seconds * 1000;
+  }
+  int loaded = frames_dir.empty() ? fake_camera_synthesize(width, height, 50, 12) : fake_camera_load_dir(frames_dir.c_str());
+  if (loaded <= 0) {
+    fprintf(stderr, "firmware_sim: nenhum quadro para a câmera\n");
+    return 2;
+  }
+  fake_camera_set_fps(fps);
+  esp_host_set_restart_hook(on_restart);
+  WiFi.onEvent(on_wifi_event);
+  boot_us = esp_timer_get_time();
+
+  if (viewer) {
+    std::thread(stream_client).detach();
+  }
+  std::thread(portal_client).detach();
+  std::thread(script_runner).detach();
+
+  {
+    std::lock_guard<std::mutex> guard(metrics.lock);
+    event("boot");
+  }
+  setup();
+  {
+    std::lock_guard<std::mutex> guard(metrics.lock);
+    event("setup() returned");
+    metrics.values["setup_ms"] = now_ms();
+  }
+  while (now_ms() < scenario.end_ms) {
+    loop();
+  }
+  finish(false);
+}
@@ -0,0 +1,52 @@
+// Decodificação completa dos quadros que o simulador recebe, separada do
+// firmware_sim.cpp: o jpeglib.h e o Arduino.h declaram boolean cada um do
+// seu jeito.
+
+#include <setjmp.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <jpeglib.h>
+
+namespace {
+
+struct JpegCheckError {
+  jpeg_error_mgr mgr;
+  jmp_buf jump;
+};
+
+void on_jpeg_check_error(j_common_ptr cinfo) {
+  longjmp(((JpegCheckError *)cinfo->err)->jump, 1);
+}
+
+}  // namespace
+
+// Decodifica o quadro inteiro; false com erro ou aviso do libjpeg (dados
+// corrompidos, scan curto)
+bool jpeg_decodes_clean(const uint8_t *jpeg, size_t len) {
+  jpeg_decompress_struct d;
+  JpegCheckError err;
+  d.err = jpeg_std_error(&err.mgr);
+  err.mgr.error_exit = on_jpeg_check_error;
+  err.mgr.emit_message = [](j_common_ptr cinfo, int level) {
+    if (level < 0) {
+      cinfo->err->num_warnings++;
+    }
+  };
+  if (setjmp(err.jump)) {
+    jpeg_destroy_decompress(&d);
+    return false;
+  }
+  jpeg_create_decompress(&d);
+  jpeg_mem_src(&d, jpeg, len);
+  jpeg_read_header(&d, TRUE);
+  jpeg_start_decompress(&d);
+  // Linha no pool do libjpeg: o longjmp de um erro não deixa vazamento
+  JSAMPARRAY row = (*d.mem->alloc_sarray)((j_common_ptr)&d, JPOOL_IMAGE, d.output_width * d.output_components, 1);
+  while (d.output_scanline < d.output_height) {
+    jpeg_read_scanlines(&d, row, 1);
+  }
+  jpeg_finish_decompress(&d);
+  bool clean = err.mgr.num_warnings == 0;
+  jpeg_destroy_decompress(&d);
+  return clean;
+}
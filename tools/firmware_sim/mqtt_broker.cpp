@@ -0,0 +1,242 @@
+#include "mqtt_broker.h"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace mqtt_broker {
+
+namespace {
+
+struct State {
+  std::mutex lock;
+  int listen_fd = -1;
+  std::set<int> conns;
+  uint32_t generation = 0;  // muda a cada stop(): conexões de antes não publicam testamento
+  uint32_t connects = 0;
+  Handler handler;
+};
+
+State &state() {
+  static State *s = new State;
+  return *s;
+}
+
+int64_t wall_us() {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  return (int64_t)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+bool read_exact(int fd, uint8_t *buf, size_t len) {
+  while (len) {
+    ssize_t n = recv(fd, buf, len, 0);
+    if (n <= 0) {
+      return false;
+    }
+    buf += n;
+    len -= n;
+  }
+  return true;
+}
+
+bool write_all(int fd, const uint8_t *buf, size_t len) {
+  while (len) {
+    ssize_t n = send(fd, buf, len, MSG_NOSIGNAL);
+    if (n <= 0) {
+      return false;
+    }
+    buf += n;
+    len -= n;
+  }
+  return true;
+}
+
+// Pacote inteiro: primeiro byte e o corpo (sem o comprimento)
+bool read_packet(int fd, uint8_t *type, std::vector<uint8_t> *body) {
+  if (!read_exact(fd, type, 1)) {
+    return false;
+  }
+  size_t remaining = 0;
+  for (int shift = 0; shift < 28; shift += 7) {
+    uint8_t b;
+    if (!read_exact(fd, &b, 1)) {
+      return false;
+    }
+    remaining |= (size_t)(b & 0x7F) << shift;
+    if (!(b & 0x80)) {
+      body->resize(remaining);
+      return read_exact(fd, body->data(), remaining);
+    }
+  }
+  return false;
+}
+
+// Texto com 2 bytes de tamanho na frente; false se passa do fim
+bool take_string(const std::vector<uint8_t> &body, size_t *pos, std::string *out) {
+  if (*pos + 2 > body.size()) {
+    return false;
+  }
+  size_t n = body[*pos] << 8 | body[*pos + 1];
+  if (*pos + 2 + n > body.size()) {
+    return false;
+  }
+  out->assign((const char *)body.data() + *pos + 2, n);
+  *pos += 2 + n;
+  return true;
+}
+
+void deliver(const Publish &p) {
+  Handler handler;
+  {
+    std::lock_guard<std::mutex> guard(state().lock);
+    handler = state().handler;
+  }
+  if (handler) {
+    handler(p);
+  }
+}
+
+void serve(int fd, uint32_t generation) {
+  Publish will;
+  bool has_will = false, connected = false, clean = false;
+  int64_t session_us = 0;
+  uint8_t type;
+  std::vector<uint8_t> body;
+  while (read_packet(fd, &type, &body)) {
+    if ((type & 0xF0) == 0x10) {
+      // CONNECT: protocolo, nível, flags, keepalive, id do cliente, testamento
+      size_t pos = 0;
+      std::string protocol, client_id;
+      if (!take_string(body, &pos, &protocol) || pos + 4 > body.size()) {
+        break;
+      }
+      uint8_t flags = body[pos + 1];
+      pos += 4;
+      if (!take_string(body, &pos, &client_id)) {
+        break;
+      }
+      if (flags & 0x04) {
+        has_will = take_string(body, &pos, &will.topic) && take_string(body, &pos, &will.payload);
+        will.qos = (flags >> 3) & 3;
+        will.retain = flags & 0x20;
+        will.will = true;
+      }
+      uint8_t ack[4] = {0x20, 2, 0, 0};
+      session_us = wall_us();
+      connected = write_all(fd, ack, sizeof(ack));
+      std::lock_guard<std::mutex> guard(state().lock);
+      state().connects++;
+    } else if (!connected) {
+      break;
+    } else if ((type & 0xF0) == 0x30) {
+      Publish p;
+      size_t pos = 0;
+      p.qos = (type >> 1) & 3;
+      p.dup = type & 0x08;
+      p.retain = type & 0x01;
+      p.session_us = session_us;
+      if (!take_string(body, &pos, &p.topic) || (p.qos && pos + 2 > body.size())) {
+        break;
+      }
+      if (p.qos) {
+        uint8_t ack[4] = {0x40, 2, body[pos], body[pos + 1]};
+        pos += 2;
+        if (!write_all(fd, ack, sizeof(ack))) {
+          break;
+        }
+      }
+      p.payload.assign((const char *)body.data() + pos, body.size() - pos);
+      deliver(p);
+    } else if ((type & 0xF0) == 0xC0) {
+      uint8_t pong[2] = {0xD0, 0};
+      if (!write_all(fd, pong, sizeof(pong))) {
+        break;
+      }
+    } else if ((type & 0xF0) == 0xE0) {
+      clean = true;
+      break;
+    }
+  }
+  bool dropped_by_stop;
+  {
+    std::lock_guard<std::mutex> guard(state().lock);
+    state().conns.erase(fd);
+    dropped_by_stop = state().generation != generation;
+  }
+  close(fd);
+  if (has_will && !clean && !dropped_by_stop) {
+    will.session_us = session_us;
+    deliver(will);
+  }
+}
+
+void accept_loop(int listen_fd, uint32_t generation) {
+  for (;;) {
+    int fd = accept(listen_fd, nullptr, nullptr);
+    if (fd < 0) {
+      return;
+    }
+    std::lock_guard<std::mutex> guard(state().lock);
+    if (state().generation != generation) {
+      close(fd);
+      return;
+    }
+    state().conns.insert(fd);
+    std::thread(serve, fd, generation).detach();
+  }
+}
+
+}  // namespace
+
+bool start(uint16_t port, Handler handler) {
+  State &s = state();
+  std::lock_guard<std::mutex> guard(s.lock);
+  s.handler = handler;
+  if (s.listen_fd >= 0) {
+    return true;
+  }
+  int fd = socket(AF_INET, SOCK_STREAM, 0);
+  int one = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  if (bind(fd, (sockaddr *)&addr, sizeof(addr)) < 0 || listen(fd, 4) < 0) {
+    close(fd);
+    return false;
+  }
+  s.listen_fd = fd;
+  std::thread(accept_loop, fd, s.generation).detach();
+  return true;
+}
+
+void stop() {
+  State &s = state();
+  std::lock_guard<std::mutex> guard(s.lock);
+  if (s.listen_fd < 0) {
+    return;
+  }
+  s.generation++;
+  shutdown(s.listen_fd, SHUT_RDWR);
+  close(s.listen_fd);
+  s.listen_fd = -1;
+  for (int fd : s.conns) {
+    shutdown(fd, SHUT_RDWR);
+  }
+}
+
+uint32_t connects() {
+  std::lock_guard<std::mutex> guard(state().lock);
+  return state().connects;
+}
+
+}  // namespace mqtt_broker
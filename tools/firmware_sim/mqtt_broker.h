@@ -0,0 +1,34 @@
+#pragma once
+// Broker MQTT 3.1.1 mínimo para o firmware_sim, sem mosquitto por perto:
+// aceita qualquer CONNECT, responde PUBACK e PINGRESP e entrega cada
+// publicação ao simulador (assinaturas não existem). Uma conexão que cai sem
+// DISCONNECT publica o testamento, como no broker de verdade; com stop() o
+// broker "cai" junto e não publica nada.
+
+#include <stdint.h>
+
+#include <functional>
+#include <string>
+
+namespace mqtt_broker {
+
+struct Publish {
+  std::string topic;
+  std::string payload;
+  int qos = 0;
+  bool dup = false;
+  bool retain = false;
+  bool will = false;
+  int64_t session_us = 0;  // CONNACK da conexão que trouxe a mensagem (relógio de parede)
+};
+
+typedef std::function<void(const Publish &)> Handler;
+
+// Abre a porta (real, sem o deslocamento do firmware); handler roda nas
+// threads das conexões
+bool start(uint16_t port, Handler handler);
+// Fecha a porta e derruba as conexões abertas
+void stop();
+uint32_t connects();
+
+}  // namespace mqtt_broker
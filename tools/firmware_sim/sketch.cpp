@@ -0,0 +1,7 @@
+// O sketch compilado como C++ comum. A IDE do Arduino gera protótipos para
+// as funções definidas no .ino depois do uso; aqui eles seriam declarados à mão.
+
+#include "Arduino.h"
+#include "esp_camera.h"
+
+#include "CameraWebServer.ino"
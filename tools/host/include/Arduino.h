@@ -0,0 +1,77 @@
+#pragma once
+// Núcleo Arduino mínimo para compilar o firmware no Linux (build de host).
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "WString.h"
+#include "IPAddress.h"
+#include "esp32-hal-log.h"
+#include "esp32-hal-ledc.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+unsigned long millis(void);
+unsigned long micros(void);
+void delay(uint32_t ms);
+void yield(void);
+long random(long max);
+long random(long min, long max);
+bool psramFound(void);
+void *ps_malloc(size_t size);
+// SNTP: no host não faz nada, o relógio do sistema já está certo
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char *server1, const char *server2 = nullptr,
+                const char *server3 = nullptr);
+
+class Print {
+ public:
+  virtual ~Print() {}
+  virtual size_t write(const uint8_t *buf, size_t n) = 0;
+  size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+  size_t print(const String &s) { return print(s.c_str()); }
+  size_t print(char c) { return write((const uint8_t *)&c, 1); }
+  size_t print(int v) { return printf("%d", v); }
+  size_t print(unsigned int v) { return printf("%u", v); }
+  size_t print(long v) { return printf("%ld", v); }
+  size_t print(unsigned long v) { return printf("%lu", v); }
+  size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+  size_t print(const IPAddress &ip) { return print(ip.toString()); }
+  size_t println() { return print("\r\n"); }
+  template <typename T> size_t println(const T &v) { size_t n = print(v); return n + println(); }
+  size_t printf(const char *fmt, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[512];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+    va_end(ap);
+    return n > 0 ? write((const uint8_t *)buf, n < (int)sizeof(buf) ? n : sizeof(buf) - 1) : 0;
+  }
+};
+
+class HardwareSerial : public Print {
+ public:
+  void begin(unsigned long baud) { (void)baud; }
+  void setDebugOutput(bool enable) { (void)enable; }
+  size_t write(const uint8_t *buf, size_t n) override;
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+ public:
+  void restart();
+  uint32_t getFreeHeap();
+  uint32_t getMaxAllocHeap();
+  uint32_t getFreePsram();
+  uint32_t getMaxAllocPsram();
+};
+
+extern EspClass ESP;
+
+char *itoa(int value, char *str, int base);
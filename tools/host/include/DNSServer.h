@@ -0,0 +1,15 @@
+#pragma once
+#include "Arduino.h"
+
+class DNSServer {
+ public:
+  DNSServer();
+  ~DNSServer();
+  bool start(const uint16_t port, const String &domainName, const IPAddress &resolvedIP);
+  void stop();
+  void processNextRequest();
+
+ private:
+  int fd_ = -1;
+  IPAddress ip_;
+};
@@ -0,0 +1,35 @@
+#pragma once
+#include <stdint.h>
+#include <stdio.h>
+#include "WString.h"
+
+class IPAddress {
+ public:
+  IPAddress() : addr_{0, 0, 0, 0} {}
+  IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : addr_{a, b, c, d} {}
+  IPAddress(uint32_t v) { memcpy(addr_, &v, 4); }
+  operator uint32_t() const { uint32_t v; memcpy(&v, addr_, 4); return v; }
+  uint8_t operator[](int i) const { return addr_[i]; }
+  uint8_t &operator[](int i) { return addr_[i]; }
+  bool operator==(const IPAddress &o) const { return memcmp(addr_, o.addr_, 4) == 0; }
+  bool operator!=(const IPAddress &o) const { return !(*this == o); }
+  bool fromString(const char *s) {
+    unsigned a, b, c, d;
+    if (sscanf(s, "%u.%u.%u.%u", &a, &b, &c, &d) != 4 || a > 255 || b > 255 || c > 255 || d > 255) {
+      return false;
+    }
+    addr_[0] = a; addr_[1] = b; addr_[2] = c; addr_[3] = d;
+    return true;
+  }
+  bool fromString(const String &s) { return fromString(s.c_str()); }
+  String toString() const {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "%u.%u.%u.%u", addr_[0], addr_[1], addr_[2], addr_[3]);
+    return String(buf);
+  }
+
+ private:
+  uint8_t addr_[4];
+};
+
+extern const IPAddress INADDR_NONE;
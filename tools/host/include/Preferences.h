@@ -0,0 +1,30 @@
+#pragma once
+#include "Arduino.h"
+
+class Preferences {
+ public:
+  bool begin(const char *name, bool readOnly = false, const char *partition_label = NULL);
+  void end();
+  bool clear();
+  bool remove(const char *key);
+  bool isKey(const char *key);
+  size_t putString(const char *key, const String &value);
+  size_t putBool(const char *key, bool value);
+  size_t putUChar(const char *key, uint8_t value);
+  size_t putUShort(const char *key, uint16_t value);
+  size_t putInt(const char *key, int32_t value);
+  size_t putUInt(const char *key, uint32_t value);
+  size_t putBytes(const char *key, const void *value, size_t len);
+  String getString(const char *key, const String &defaultValue = String());
+  bool getBool(const char *key, bool defaultValue = false);
+  uint8_t getUChar(const char *key, uint8_t defaultValue = 0);
+  uint16_t getUShort(const char *key, uint16_t defaultValue = 0);
+  int32_t getInt(const char *key, int32_t defaultValue = 0);
+  uint32_t getUInt(const char *key, uint32_t defaultValue = 0);
+  size_t getBytesLength(const char *key);
+  size_t getBytes(const char *key, void *buf, size_t maxLen);
+
+ private:
+  String ns_;
+  bool open_ = false;
+};
@@ -0,0 +1,56 @@
+#pragma once
+#include <functional>
+#include <map>
+#include <vector>
+#include "Arduino.h"
+#include "esp_http_server.h"
+
+typedef enum { HTTP_ANY = 255 } WebServerAnyMethod;
+typedef int HTTPMethod;
+
+class WebServer {
+ public:
+  typedef std::function<void(void)> THandlerFunction;
+
+  explicit WebServer(int port = 80);
+  ~WebServer();
+
+  void begin();
+  void stop();
+  void handleClient();
+  void on(const String &uri, THandlerFunction handler);
+  void on(const String &uri, HTTPMethod method, THandlerFunction fn);
+  void onNotFound(THandlerFunction fn);
+  void collectHeaders(const char *headerKeys[], const size_t headerKeysCount);
+
+  String uri() { return uri_; }
+  HTTPMethod method() { return method_; }
+  String arg(const String &name);
+  bool hasArg(const String &name);
+  String header(const String &name);
+  bool hasHeader(const String &name);
+
+  void send(int code, const char *content_type = NULL, const String &content = String());
+  void send(int code, const String &content_type, const String &content) { send(code, content_type.c_str(), content); }
+  void send_P(int code, const char *content_type, const char *content, size_t contentLength);
+  void sendHeader(const String &name, const String &value, bool first = false);
+
+ private:
+  struct Route {
+    String uri;
+    HTTPMethod method;
+    THandlerFunction fn;
+  };
+
+  int port_;
+  int listen_fd_ = -1;
+  int client_fd_ = -1;
+  std::vector<Route> routes_;
+  THandlerFunction not_found_;
+  String uri_;
+  HTTPMethod method_ = HTTP_GET;
+  std::map<std::string, std::string> args_;
+  std::map<std::string, std::string> headers_;
+  std::vector<std::string> collect_;
+  std::vector<std::pair<std::string, std::string>> resp_headers_;
+};
@@ -0,0 +1,119 @@
+#pragma once
+#include <functional>
+#include "Arduino.h"
+
+typedef enum {
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_SCAN_COMPLETED = 2,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6,
+  WL_NO_SHIELD = 255,
+} wl_status_t;
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+typedef enum {
+  WIFI_AUTH_OPEN = 0,
+  WIFI_AUTH_WEP,
+  WIFI_AUTH_WPA_PSK,
+  WIFI_AUTH_WPA2_PSK,
+  WIFI_AUTH_WPA_WPA2_PSK,
+  WIFI_AUTH_WPA2_ENTERPRISE,
+  WIFI_AUTH_WPA3_PSK,
+  WIFI_AUTH_WPA2_WPA3_PSK,
+  WIFI_AUTH_MAX
+} wifi_auth_mode_t;
+
+#define WIFI_SCAN_RUNNING (-1)
+#define WIFI_SCAN_FAILED (-2)
+
+typedef enum {
+  ARDUINO_EVENT_NONE = 0,
+  ARDUINO_EVENT_ETH_START,
+  ARDUINO_EVENT_ETH_STOP,
+  ARDUINO_EVENT_ETH_CONNECTED,
+  ARDUINO_EVENT_ETH_DISCONNECTED,
+  ARDUINO_EVENT_ETH_GOT_IP,
+  ARDUINO_EVENT_ETH_LOST_IP,
+  ARDUINO_EVENT_ETH_GOT_IP6,
+  ARDUINO_EVENT_WIFI_OFF,
+  ARDUINO_EVENT_WIFI_READY,
+  ARDUINO_EVENT_WIFI_SCAN_DONE,
+  ARDUINO_EVENT_WIFI_FTM_REPORT,
+  ARDUINO_EVENT_WIFI_STA_START,
+  ARDUINO_EVENT_WIFI_STA_STOP,
+  ARDUINO_EVENT_WIFI_STA_CONNECTED,
+  ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+  ARDUINO_EVENT_WIFI_STA_AUTHMODE_CHANGE,
+  ARDUINO_EVENT_WIFI_STA_GOT_IP,
+  ARDUINO_EVENT_WIFI_STA_GOT_IP6,
+  ARDUINO_EVENT_WIFI_STA_LOST_IP,
+  ARDUINO_EVENT_WIFI_AP_START,
+  ARDUINO_EVENT_WIFI_AP_STOP,
+  ARDUINO_EVENT_WIFI_AP_STACONNECTED,
+  ARDUINO_EVENT_WIFI_AP_STADISCONNECTED,
+  ARDUINO_EVENT_WIFI_AP_STAIPASSIGNED,
+  ARDUINO_EVENT_WIFI_AP_PROBEREQRECVED,
+  ARDUINO_EVENT_WIFI_AP_GOT_IP6,
+  ARDUINO_EVENT_MAX
+} arduino_event_id_t;
+
+typedef struct { uint8_t ssid[33]; uint8_t ssid_len; uint8_t bssid[6]; uint8_t reason; int8_t rssi; } wifi_event_sta_disconnected_t;
+typedef struct { uint8_t ssid[33]; uint8_t ssid_len; uint8_t bssid[6]; uint8_t channel; uint8_t authmode; uint16_t aid; } wifi_event_sta_connected_t;
+typedef struct { uint32_t status; uint8_t number; uint8_t scan_id; } wifi_event_sta_scan_done_t;
+typedef struct { struct { struct { uint32_t addr; } ip, netmask, gw; } ip_info; bool ip_changed; } ip_event_got_ip_t;
+typedef union {
+  wifi_event_sta_connected_t wifi_sta_connected;
+  wifi_event_sta_disconnected_t wifi_sta_disconnected;
+  wifi_event_sta_scan_done_t wifi_scan_done;
+  ip_event_got_ip_t got_ip;
+} arduino_event_info_t;
+
+typedef void (*WiFiEventCb)(arduino_event_id_t event);
+typedef std::function<void(arduino_event_id_t event, arduino_event_info_t info)> WiFiEventFuncCb;
+typedef void (*WiFiEventSysCb)(void *event);
+typedef size_t wifi_event_id_t;
+
+class WiFiClass {
+ public:
+  bool mode(wifi_mode_t m);
+  wifi_mode_t getMode();
+  wl_status_t begin(const char *ssid, const char *passphrase = NULL, int32_t channel = 0, const uint8_t *bssid = NULL, bool connect = true);
+  bool config(IPAddress local_ip, IPAddress gateway, IPAddress subnet, IPAddress dns1 = IPAddress(), IPAddress dns2 = IPAddress());
+  bool disconnect(bool wifioff = false, bool eraseap = false);
+  bool reconnect();
+  wl_status_t status();
+  bool setAutoReconnect(bool autoReconnect);
+  bool getAutoReconnect();
+  IPAddress localIP();
+  IPAddress gatewayIP();
+  IPAddress subnetMask();
+  IPAddress dnsIP(uint8_t n = 0);
+  String SSID();
+  uint8_t *BSSID();
+  int32_t channel();
+  int8_t RSSI();
+  bool softAP(const char *ssid, const char *passphrase = NULL, int channel = 1, int ssid_hidden = 0, int max_connection = 4);
+  bool softAPConfig(IPAddress local_ip, IPAddress gateway, IPAddress subnet);
+  bool softAPdisconnect(bool wifioff = false);
+  IPAddress softAPIP();
+  // Varredura (WiFiScanClass do core): com async=true retorna WIFI_SCAN_RUNNING
+  // e o resultado sai em scanComplete() e no evento SCAN_DONE
+  int16_t scanNetworks(bool async = false, bool show_hidden = false, bool passive = false, uint32_t max_ms_per_chan = 300,
+                       uint8_t channel = 0, const char *ssid = nullptr, const uint8_t *bssid = nullptr);
+  int16_t scanComplete();
+  void scanDelete();
+  String SSID(uint8_t networkItem);
+  wifi_auth_mode_t encryptionType(uint8_t networkItem);
+  int32_t RSSI(uint8_t networkItem);
+  uint8_t *BSSID(uint8_t networkItem);
+  int32_t channel(uint8_t networkItem);
+  wifi_event_id_t onEvent(WiFiEventCb cbEvent, arduino_event_id_t event = ARDUINO_EVENT_MAX);
+  wifi_event_id_t onEvent(WiFiEventFuncCb cbEvent, arduino_event_id_t event = ARDUINO_EVENT_MAX);
+  void removeEvent(wifi_event_id_t id);
+};
+
+extern WiFiClass WiFi;
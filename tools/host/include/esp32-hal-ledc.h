@@ -0,0 +1,6 @@
+#pragma once
+#include <stdint.h>
+#include "esp32-hal-log.h"
+
+bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution);
+bool ledcWrite(uint8_t pin, uint32_t duty);
@@ -0,0 +1,40 @@
+#pragma once
+#include <stdio.h>
+
+#define ARDUHAL_LOG_LEVEL_NONE    (0)
+#define ARDUHAL_LOG_LEVEL_ERROR   (1)
+#define ARDUHAL_LOG_LEVEL_WARN    (2)
+#define ARDUHAL_LOG_LEVEL_INFO    (3)
+#define ARDUHAL_LOG_LEVEL_DEBUG   (4)
+#define ARDUHAL_LOG_LEVEL_VERBOSE (5)
+
+#ifndef CORE_DEBUG_LEVEL
+#define CORE_DEBUG_LEVEL ARDUHAL_LOG_LEVEL_WARN
+#endif
+#ifndef ARDUHAL_LOG_LEVEL
+#define ARDUHAL_LOG_LEVEL CORE_DEBUG_LEVEL
+#endif
+
+#define ARDUHAL_LOG_IMPL(letter, format, ...) fprintf(stderr, "[" letter "][%s:%u] %s(): " format "\n", __FILE__, __LINE__, __func__, ##__VA_ARGS__)
+
+#if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_ERROR
+#define log_e(format, ...) ARDUHAL_LOG_IMPL("E", format, ##__VA_ARGS__)
+#else
+#define log_e(format, ...) do {} while (0)
+#endif
+#if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_WARN
+#define log_w(format, ...) ARDUHAL_LOG_IMPL("W", format, ##__VA_ARGS__)
+#else
+#define log_w(format, ...) do {} while (0)
+#endif
+#if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
+#define log_i(format, ...) ARDUHAL_LOG_IMPL("I", format, ##__VA_ARGS__)
+#else
+#define log_i(format, ...) do {} while (0)
+#endif
+#if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_DEBUG
+#define log_d(format, ...) ARDUHAL_LOG_IMPL("D", format, ##__VA_ARGS__)
+#else
+#define log_d(format, ...) do {} while (0)
+#endif
+#define log_v(format, ...) do {} while (0)
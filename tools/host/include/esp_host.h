@@ -0,0 +1,60 @@
+#pragma once
+// Controles do ambiente de host que não existem no ESP-IDF: usados pelos
+// programas de teste e benchmark em tools/host.
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Câmera falsa: reproduz os JPEGs de um diretório (ordem alfabética) ou
+// quadros sintéticos gerados com libjpeg, na taxa dada (0 = sem limite)
+int fake_camera_load_dir(const char *dir);
+int fake_camera_synthesize(int width, int height, int frames, int quality);
+void fake_camera_set_fps(float fps);
+void fake_camera_set_pid(uint16_t pid);
+uint32_t fake_camera_frames_served(void);
+// Mudanças de resolução ou XCLK no sensor depois de esp_camera_init
+uint32_t fake_camera_reconfigs(void);
+// Leituras de registrador pelo SCCB (get_reg e a leitura do set_reg)
+uint32_t fake_camera_reg_reads(void);
+// Luz da cena nos quadros sintéticos (1 = dia, 0.05 = anoitecer): o AGC
+// falso sobe o ganho até o gainceiling, com ruído proporcional ao ganho
+void fake_camera_set_light(float light);
+// Cena parada: o quadro atual se repete até fake_camera_freeze(false)
+void fake_camera_freeze(bool still);
+
+// Porta real de um servidor do firmware: port + ESP_HOST_PORT_OFFSET (8000)
+uint16_t esp_host_port(uint16_t port);
+
+// Flash: falha as gravações/apagamentos depois de `bytes` bytes (simula
+// queda de energia no meio da operação); 0 desliga
+void esp_host_flash_fail_after(size_t bytes);
+uint8_t *esp_host_flash_image(size_t *size);
+
+// Rede WiFi simulada. Cada AP tem SSID, senha, canal, RSSI e a rede que o
+// DHCP entrega (gateway/máscara, endereços a partir de .100). Os tempos de
+// uma conexão são: varredura (pulada quando WiFi.begin recebe canal e BSSID),
+// autenticação e DHCP (pulado com IP estático).
+void esp_host_wifi_add_ap(const char *ssid, const char *password, uint8_t channel, int8_t rssi, const char *gateway,
+                          const char *subnet);
+void esp_host_wifi_set_ap_up(const char *ssid, bool up);
+void esp_host_wifi_set_ap_network(const char *ssid, const char *gateway, const char *subnet);
+void esp_host_wifi_set_timing(uint32_t scan_ms, uint32_t auth_ms, uint32_t dhcp_ms, uint32_t beacon_timeout_ms);
+// IP em que um cliente da rede alcança a estação (0 se desconectada ou se o
+// IP estático não pertence à sub-rede do AP)
+uint32_t esp_host_wifi_sta_reachable_ip(void);
+bool esp_host_wifi_softap_active(void);
+
+// NVS (Preferences): em memória, ou persistida no arquivo dado
+void esp_host_nvs_open(const char *path);
+void esp_host_nvs_set_string(const char *ns, const char *key, const char *value);
+uint32_t esp_host_nvs_writes(void);
+
+// ESP.restart(): por padrão o processo sai com código 3
+void esp_host_set_restart_hook(void (*hook)(void));
+
+#ifdef __cplusplus
+}
+#endif
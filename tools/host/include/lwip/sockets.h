@@ -0,0 +1,22 @@
+#pragma once
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <sys/select.h>
+#include <unistd.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// bind de um socket do firmware: a porta ganha o deslocamento de
+// esp_host_port, como as dos servidores HTTP (a porta 0 segue efêmera)
+int esp_host_bind(int fd, const struct sockaddr *addr, socklen_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+// Como o LWIP_COMPAT_SOCKETS, que também troca bind por uma macro
+#define bind(fd, addr, len) esp_host_bind(fd, addr, len)
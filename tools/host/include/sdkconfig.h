@@ -0,0 +1,4 @@
+#pragma once
+// Configuração mínima equivalente ao sdkconfig do ESP32 (build de host)
+#define CONFIG_IDF_TARGET_ESP32 1
+#define CONFIG_FREERTOS_HZ 1000
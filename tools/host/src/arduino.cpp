@@ -0,0 +1,123 @@
+// Núcleo Arduino do build de host: tempo, Serial no stdout e ESP.restart().
+// Este arquivo não inclui cabeçalhos de rede: o INADDR_NONE do IPAddress
+// colide com a macro de <netinet/in.h>.
+
+#include "Arduino.h"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <random>
+#include <thread>
+
+#include "esp_heap_caps.h"
+#include "esp_host.h"
+#include "esp_timer.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+const IPAddress INADDR_NONE(0, 0, 0, 0);
+
+unsigned long millis(void) {
+  return esp_timer_get_time() / 1000;
+}
+
+unsigned long micros(void) {
+  return esp_timer_get_time();
+}
+
+void delay(uint32_t ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void yield(void) {
+  std::this_thread::yield();
+}
+
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char *server1, const char *server2, const char *server3) {
+  (void)gmtOffset_sec;
+  (void)daylightOffset_sec;
+  (void)server1;
+  (void)server2;
+  (void)server3;
+}
+
+static std::mt19937 &rng() {
+  static thread_local std::mt19937 gen(std::random_device{}());
+  return gen;
+}
+
+long random(long max) {
+  return max > 0 ? std::uniform_int_distribution<long>(0, max - 1)(rng()) : 0;
+}
+
+long random(long min, long max) {
+  return max > min ? min + random(max - min) : min;
+}
+
+bool psramFound(void) {
+  return true;
+}
+
+void *ps_malloc(size_t size) {
+  return heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+}
+
+size_t HardwareSerial::write(const uint8_t *buf, size_t n) {
+  fwrite(buf, 1, n, stdout);
+  fflush(stdout);
+  return n;
+}
+
+static void (*restart_hook)(void);
+
+void esp_host_set_restart_hook(void (*hook)(void)) {
+  restart_hook = hook;
+}
+
+// Sem bootloader para voltar: o processo sai com código 3 e quem o lançou
+// (simulador, CI) decide se reinicia
+void EspClass::restart() {
+  fflush(stdout);
+  if (restart_hook) {
+    restart_hook();
+  }
+  _exit(3);
+}
+
+uint32_t EspClass::getFreeHeap() {
+  return heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+}
+
+uint32_t EspClass::getMaxAllocHeap() {
+  return heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+}
+
+uint32_t EspClass::getFreePsram() {
+  return heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+}
+
+uint32_t EspClass::getMaxAllocPsram() {
+  return heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM);
+}
+
+char *itoa(int value, char *str, int base) {
+  const char *digits = "0123456789abcdefghijklmnopqrstuvwxyz";
+  char tmp[34];
+  int i = 0;
+  bool neg = value < 0 && base == 10;
+  unsigned int v = neg ? -(unsigned int)value : (unsigned int)value;
+  do {
+    tmp[i++] = digits[v % base];
+    v /= base;
+  } while (v);
+  char *p = str;
+  if (neg) {
+    *p++ = '-';
+  }
+  while (i) {
+    *p++ = tmp[--i];
+  }
+  *p = 0;
+  return str;
+}
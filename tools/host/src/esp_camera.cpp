@@ -0,0 +1,534 @@
+// Câmera falsa: entrega JPEGs gravados (ou sintéticos) no ritmo de um sensor
+// real. Com CAMERA_GRAB_LATEST cada esp_camera_fb_get devolve o quadro mais
+// novo já "capturado" e espera o próximo se o último já foi entregue; os
+// buffers (fb_count) precisam ser devolvidos como no driver.
+
+#include "esp_camera.h"
+
+#include <dirent.h>
+#include <math.h>
+#include <stdio.h>
+#include <jpeglib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "esp32-hal-log.h"
+#include "esp_host.h"
+#include "esp_timer.h"
+
+const resolution_info_t resolution[FRAMESIZE_INVALID] = {
+  {96, 96, ASPECT_RATIO_1X1},     {160, 120, ASPECT_RATIO_4X3},   {128, 128, ASPECT_RATIO_1X1},   {176, 144, ASPECT_RATIO_5X4},
+  {240, 176, ASPECT_RATIO_3X2},   {240, 240, ASPECT_RATIO_1X1},   {320, 240, ASPECT_RATIO_4X3},   {320, 320, ASPECT_RATIO_1X1},
+  {400, 296, ASPECT_RATIO_4X3},   {480, 320, ASPECT_RATIO_3X2},   {640, 480, ASPECT_RATIO_4X3},   {800, 600, ASPECT_RATIO_4X3},
+  {1024, 768, ASPECT_RATIO_4X3},  {1280, 720, ASPECT_RATIO_16X9}, {1280, 1024, ASPECT_RATIO_5X4}, {1600, 1200, ASPECT_RATIO_4X3},
+  {1920, 1080, ASPECT_RATIO_16X9}, {720, 1280, ASPECT_RATIO_9X16}, {864, 1536, ASPECT_RATIO_9X16}, {2048, 1536, ASPECT_RATIO_4X3},
+  {2560, 1440, ASPECT_RATIO_16X9}, {2560, 1600, ASPECT_RATIO_16X10}, {1088, 1920, ASPECT_RATIO_9X16}, {2560, 1920, ASPECT_RATIO_4X3},
+  {2592, 1944, ASPECT_RATIO_4X3},
+};
+
+namespace {
+
+struct Frame {
+  std::vector<uint8_t> jpeg;
+  uint16_t width;
+  uint16_t height;
+};
+
+struct Camera {
+  std::mutex lock;
+  std::condition_variable returned;
+  std::vector<Frame> frames;
+  float fps = 25;
+  uint16_t pid = OV2640_PID;
+  bool initialized = false;
+  camera_grab_mode_t grab_mode = CAMERA_GRAB_WHEN_EMPTY;
+  std::vector<camera_fb_t> fbs;
+  std::vector<bool> in_use;
+  int64_t start_us = 0;
+  int64_t last_index = -1;
+  int64_t frozen_index = -1;  // fake_camera_freeze
+  uint32_t served = 0;
+  uint32_t reconfigs = 0;  // mudanças de resolução/XCLK depois da inicialização
+  uint32_t reg_reads = 0;  // leituras de registrador no SCCB (o set_reg também lê)
+  sensor_t sensor;
+  std::map<int, int> regs;
+  // Quadros sintéticos: refeitos quando a luz da cena ou o AGC mudam
+  bool synthetic = false;
+  int synth_width = 0, synth_height = 0, synth_count = 0, synth_quality = 0;
+  float light = 1.0f;          // fração da luz do dia
+  int synth_scene = -1;        // brilho, ruído e tamanho dos quadros atuais
+  int window_width = 0;        // saída do set_res_raw (0 = a dos quadros)
+  int window_height = 0;
+  bool resynth_running = false;
+  std::vector<Frame> retired;  // quadros trocados, talvez ainda emprestados
+};
+
+Camera cam;
+
+bool jpeg_size(const std::vector<uint8_t> &j, uint16_t *w, uint16_t *h) {
+  for (size_t i = 2; i + 9 < j.size();) {
+    if (j[i] != 0xFF) {
+      return false;
+    }
+    uint8_t marker = j[i + 1];
+    size_t len = (j[i + 2] << 8) | j[i + 3];
+    if (marker >= 0xC0 && marker <= 0xC3) {
+      *h = (j[i + 5] << 8) | j[i + 6];
+      *w = (j[i + 7] << 8) | j[i + 8];
+      return true;
+    }
+    i += 2 + len;
+  }
+  return false;
+}
+
+// ---- Sensor: guarda o estado, sem efeito sobre os quadros gravados ----
+
+#define STATUS_SETTER(fn, field)                 \
+  int fn(sensor_t *s, int v) {                   \
+    s->status.field = v;                         \
+    return 0;                                    \
+  }
+STATUS_SETTER(set_contrast, contrast)
+STATUS_SETTER(set_brightness, brightness)
+STATUS_SETTER(set_saturation, saturation)
+STATUS_SETTER(set_sharpness, sharpness)
+STATUS_SETTER(set_denoise, denoise)
+STATUS_SETTER(set_quality, quality)
+STATUS_SETTER(set_colorbar, colorbar)
+STATUS_SETTER(set_whitebal, awb)
+STATUS_SETTER(set_gain_ctrl, agc)
+STATUS_SETTER(set_exposure_ctrl, aec)
+STATUS_SETTER(set_hmirror, hmirror)
+STATUS_SETTER(set_vflip, vflip)
+STATUS_SETTER(set_aec2, aec2)
+STATUS_SETTER(set_awb_gain, awb_gain)
+STATUS_SETTER(set_agc_gain, agc_gain)
+STATUS_SETTER(set_aec_value, aec_value)
+STATUS_SETTER(set_special_effect, special_effect)
+STATUS_SETTER(set_wb_mode, wb_mode)
+STATUS_SETTER(set_ae_level, ae_level)
+STATUS_SETTER(set_dcw, dcw)
+STATUS_SETTER(set_bpc, bpc)
+STATUS_SETTER(set_wpc, wpc)
+STATUS_SETTER(set_raw_gma, raw_gma)
+STATUS_SETTER(set_lenc, lenc)
+#undef STATUS_SETTER
+
+int init_status(sensor_t *s) {
+  (void)s;
+  return 0;
+}
+
+int reset(sensor_t *s) {
+  (void)s;
+  return 0;
+}
+
+int set_pixformat(sensor_t *s, pixformat_t f) {
+  s->pixformat = f;
+  return 0;
+}
+
+int set_framesize(sensor_t *s, framesize_t f) {
+  if (f >= FRAMESIZE_INVALID) {
+    return -1;
+  }
+  std::lock_guard<std::mutex> guard(cam.lock);
+  if (s->status.framesize != f) {
+    cam.reconfigs++;
+  }
+  s->status.framesize = f;
+  // Como no driver, a janela volta para o campo inteiro
+  cam.window_width = cam.window_height = 0;
+  return 0;
+}
+
+int set_gainceiling(sensor_t *s, gainceiling_t g) {
+  s->status.gainceiling = g;
+  return 0;
+}
+
+int get_reg(sensor_t *s, int reg, int mask) {
+  (void)s;
+  std::lock_guard<std::mutex> guard(cam.lock);
+  cam.reg_reads++;
+  auto it = cam.regs.find(reg);
+  return (it == cam.regs.end() ? 0 : it->second) & mask;
+}
+
+int set_reg(sensor_t *s, int reg, int mask, int value) {
+  (void)s;
+  std::lock_guard<std::mutex> guard(cam.lock);
+  cam.reg_reads++;
+  int &r = cam.regs[reg];
+  r = (r & ~mask) | (value & mask);
+  return 0;
+}
+
+// Só o tamanho da saída muda nos quadros sintéticos; o conteúdo não é recortado
+int set_res_raw(sensor_t *s, int, int, int, int, int, int, int, int, int outputX, int outputY, bool scale, bool binning) {
+  std::lock_guard<std::mutex> guard(cam.lock);
+  s->status.scale = scale;
+  s->status.binning = binning;
+  cam.window_width = outputX;
+  cam.window_height = outputY;
+  return 0;
+}
+
+int set_pll(sensor_t *s, int, int, int, int, int, int, int, int) {
+  (void)s;
+  return 0;
+}
+
+int set_xclk(sensor_t *s, int timer, int xclk) {
+  (void)timer;
+  if (s->xclk_freq_hz != xclk * 1000000) {
+    std::lock_guard<std::mutex> guard(cam.lock);
+    cam.reconfigs++;
+  }
+  s->xclk_freq_hz = xclk * 1000000;
+  return 0;
+}
+
+void init_sensor(const camera_config_t *config) {
+  sensor_t *s = &cam.sensor;
+  memset(s, 0, sizeof(*s));
+  s->id.PID = cam.pid;
+  s->slv_addr = 0x30;
+  s->pixformat = config->pixel_format;
+  s->xclk_freq_hz = config->xclk_freq_hz;
+  s->status.framesize = config->frame_size;
+  s->status.quality = config->jpeg_quality;
+  s->status.awb = 1;
+  s->status.aec = 1;
+  s->status.agc = 1;
+  s->status.awb_gain = 1;
+  s->status.bpc = 0;
+  s->status.wpc = 1;
+  s->status.raw_gma = 1;
+  s->status.lenc = 1;
+  s->status.dcw = 1;
+  s->init_status = init_status;
+  s->reset = reset;
+  s->set_pixformat = set_pixformat;
+  s->set_framesize = set_framesize;
+  s->set_contrast = set_contrast;
+  s->set_brightness = set_brightness;
+  s->set_saturation = set_saturation;
+  s->set_sharpness = set_sharpness;
+  s->set_denoise = set_denoise;
+  s->set_gainceiling = set_gainceiling;
+  s->set_quality = set_quality;
+  s->set_colorbar = set_colorbar;
+  s->set_whitebal = set_whitebal;
+  s->set_gain_ctrl = set_gain_ctrl;
+  s->set_exposure_ctrl = set_exposure_ctrl;
+  s->set_hmirror = set_hmirror;
+  s->set_vflip = set_vflip;
+  s->set_aec2 = set_aec2;
+  s->set_awb_gain = set_awb_gain;
+  s->set_agc_gain = set_agc_gain;
+  s->set_aec_value = set_aec_value;
+  s->set_special_effect = set_special_effect;
+  s->set_wb_mode = set_wb_mode;
+  s->set_ae_level = set_ae_level;
+  s->set_dcw = set_dcw;
+  s->set_bpc = set_bpc;
+  s->set_wpc = set_wpc;
+  s->set_raw_gma = set_raw_gma;
+  s->set_lenc = set_lenc;
+  s->get_reg = get_reg;
+  s->set_reg = set_reg;
+  s->set_res_raw = set_res_raw;
+  s->set_pll = set_pll;
+  s->set_xclk = set_xclk;
+}
+
+}  // namespace
+
+int fake_camera_load_dir(const char *dir) {
+  DIR *d = opendir(dir);
+  if (!d) {
+    log_e("Cannot open frame directory %s", dir);
+    return 0;
+  }
+  std::vector<std::string> names;
+  while (dirent *de = readdir(d)) {
+    std::string n = de->d_name;
+    if (n.size() > 4 && (strcasecmp(n.c_str() + n.size() - 4, ".jpg") == 0 || strcasecmp(n.c_str() + n.size() - 5, ".jpeg") == 0)) {
+      names.push_back(n);
+    }
+  }
+  closedir(d);
+  std::sort(names.begin(), names.end());
+
+  std::lock_guard<std::mutex> guard(cam.lock);
+  cam.frames.clear();
+  cam.synthetic = false;
+  for (const auto &n : names) {
+    FILE *f = fopen((std::string(dir) + "/" + n).c_str(), "rb");
+    if (!f) {
+      continue;
+    }
+    Frame fr;
+    uint8_t buf[8192];
+    size_t r;
+    while ((r = fread(buf, 1, sizeof(buf), f)) > 0) {
+      fr.jpeg.insert(fr.jpeg.end(), buf, buf + r);
+    }
+    fclose(f);
+    if (jpeg_size(fr.jpeg, &fr.width, &fr.height)) {
+      cam.frames.push_back(std::move(fr));
+    } else {
+      log_w("Skipping %s: not a JPEG", n.c_str());
+    }
+  }
+  log_i("Loaded %zu frames from %s", cam.frames.size(), dir);
+  return cam.frames.size();
+}
+
+namespace {
+
+// Cena com um gradiente fixo e um retângulo que atravessa a imagem; gain
+// multiplica o brilho e noise (desvio em níveis de 0-255) simula o ganho
+std::vector<Frame> synthesize(int width, int height, int frames, int quality, float gain, float noise) {
+  std::vector<uint8_t> rgb(width * height * 3);
+  std::vector<Frame> out_frames;
+  std::mt19937 rng(1234);
+  std::normal_distribution<float> dist(0.0f, noise > 0 ? noise : 1.0f);
+  for (int n = 0; n < frames; n++) {
+    int bx = (n * width / std::max(frames, 1)) % width;
+    for (int y = 0; y < height; y++) {
+      for (int x = 0; x < width; x++) {
+        uint8_t *p = &rgb[(y * width + x) * 3];
+        bool box = x >= bx && x < bx + width / 8 && y > height / 3 && y < height / 3 + height / 6;
+        int c[3] = {box ? 230 : x * 255 / width, box ? 40 : y * 255 / height, box ? 40 : 128 + (int)(60 * sin((x + y) * 0.05))};
+        for (int i = 0; i < 3; i++) {
+          float v = c[i] * gain + (noise > 0 ? dist(rng) : 0.0f);
+          p[i] = v < 0 ? 0 : v > 255 ? 255 : (uint8_t)v;
+        }
+      }
+    }
+    jpeg_compress_struct c;
+    jpeg_error_mgr err;
+    unsigned char *out = NULL;
+    unsigned long out_len = 0;
+    c.err = jpeg_std_error(&err);
+    jpeg_create_compress(&c);
+    jpeg_mem_dest(&c, &out, &out_len);
+    c.image_width = width;
+    c.image_height = height;
+    c.input_components = 3;
+    c.in_color_space = JCS_RGB;
+    jpeg_set_defaults(&c);
+    jpeg_set_quality(&c, quality, TRUE);
+    jpeg_start_compress(&c, TRUE);
+    while (c.next_scanline < c.image_height) {
+      JSAMPROW row = &rgb[c.next_scanline * width * 3];
+      jpeg_write_scanlines(&c, &row, 1);
+    }
+    jpeg_finish_compress(&c);
+    jpeg_destroy_compress(&c);
+    Frame fr;
+    fr.jpeg.assign(out, out + out_len);
+    fr.width = width;
+    fr.height = height;
+    free(out);
+    out_frames.push_back(std::move(fr));
+  }
+  return out_frames;
+}
+
+// AGC do sensor: o ganho compensa a falta de luz até o teto (gainceiling);
+// o registrador de ganho (0x100, banco do sensor do OV2640) acompanha.
+// Chamado com cam.lock; devolve o brilho e o ruído resultantes.
+void run_agc_locked(float *brightness, float *noise) {
+  const sensor_t *s = &cam.sensor;
+  float ceiling = (float)(2 << s->status.gainceiling);
+  float gain = s->status.agc ? std::min(std::max(1.0f / cam.light, 1.0f), ceiling) : 1.0f;
+  *brightness = std::min(1.0f, cam.light * gain) * (1.0f + 0.15f * s->status.ae_level);
+  *noise = gain > 1.0f ? std::min(1.5f * gain, 40.0f) : 0.0f;
+  // Ganho = (b7+1)(b6+1)(b5+1)(b4+1)(1 + b3..0/16)
+  int reg = 0;
+  float rest = gain;
+  for (int bit = 4; bit < 8 && rest >= 2.0f; bit++) {
+    reg |= 1 << bit;
+    rest /= 2.0f;
+  }
+  reg |= std::min(15, (int)((rest - 1.0f) * 16));
+  cam.regs[0x100] = reg;
+}
+
+// Refaz os quadros sintéticos em segundo plano quando o brilho ou o ruído
+// mudam, como um sensor cujo AGC leva alguns quadros para assentar
+void update_scene_locked() {
+  if (!cam.synthetic || cam.resynth_running) {
+    return;
+  }
+  float brightness, noise;
+  run_agc_locked(&brightness, &noise);
+  int w = cam.window_width ? cam.window_width : cam.synth_width;
+  int h = cam.window_height ? cam.window_height : cam.synth_height;
+  int scene = ((int)(brightness * 50) * 1000 + (int)noise) ^ (w << 16) ^ (h << 24);
+  if (scene == cam.synth_scene) {
+    return;
+  }
+  cam.resynth_running = true;
+  int n = cam.synth_count, q = cam.synth_quality;
+  std::thread([w, h, n, q, brightness, noise, scene] {
+    std::vector<Frame> frames = synthesize(w, h, n, q, brightness, noise);
+    std::lock_guard<std::mutex> guard(cam.lock);
+    cam.retired.swap(cam.frames);
+    cam.frames.swap(frames);
+    cam.synth_scene = scene;
+    cam.resynth_running = false;
+  }).detach();
+}
+
+}  // namespace
+
+int fake_camera_synthesize(int width, int height, int frames, int quality) {
+  std::vector<Frame> out = synthesize(width, height, frames, quality, 1.0f, 0.0f);
+  std::lock_guard<std::mutex> guard(cam.lock);
+  cam.frames.swap(out);
+  cam.synthetic = true;
+  cam.synth_width = width;
+  cam.synth_height = height;
+  cam.synth_count = frames;
+  cam.synth_quality = quality;
+  cam.synth_scene = (50 * 1000) ^ (width << 16) ^ (height << 24);
+  return frames;
+}
+
+void fake_camera_set_light(float light) {
+  std::lock_guard<std::mutex> guard(cam.lock);
+  cam.light = light > 0.001f ? light : 0.001f;
+}
+
+void fake_camera_freeze(bool still) {
+  std::lock_guard<std::mutex> guard(cam.lock);
+  cam.frozen_index = still ? std::max<int64_t>(cam.last_index, 0) : -1;
+}
+
+void fake_camera_set_fps(float fps) {
+  std::lock_guard<std::mutex> guard(cam.lock);
+  cam.fps = fps;
+}
+
+void fake_camera_set_pid(uint16_t pid) {
+  std::lock_guard<std::mutex> guard(cam.lock);
+  cam.pid = pid;
+  cam.sensor.id.PID = pid;
+}
+
+uint32_t fake_camera_frames_served(void) {
+  std::lock_guard<std::mutex> guard(cam.lock);
+  return cam.served;
+}
+
+uint32_t fake_camera_reconfigs(void) {
+  std::lock_guard<std::mutex> guard(cam.lock);
+  return cam.reconfigs;
+}
+
+uint32_t fake_camera_reg_reads(void) {
+  std::lock_guard<std::mutex> guard(cam.lock);
+  return cam.reg_reads;
+}
+
+esp_err_t esp_camera_init(const camera_config_t *config) {
+  std::lock_guard<std::mutex> guard(cam.lock);
+  if (cam.frames.empty()) {
+    log_e("Camera probe failed: no frames loaded");
+    return ESP_ERR_CAMERA_NOT_DETECTED;
+  }
+  if (config->pixel_format != PIXFORMAT_JPEG) {
+    log_w("Fake camera only produces JPEG frames");
+  }
+  init_sensor(config);
+  size_t count = config->fb_count ? config->fb_count : 1;
+  cam.fbs.assign(count, camera_fb_t());
+  cam.in_use.assign(count, false);
+  cam.grab_mode = config->grab_mode;
+  cam.start_us = esp_timer_get_time();
+  cam.last_index = -1;
+  cam.initialized = true;
+  return ESP_OK;
+}
+
+esp_err_t esp_camera_deinit(void) {
+  std::lock_guard<std::mutex> guard(cam.lock);
+  cam.initialized = false;
+  return ESP_OK;
+}
+
+camera_fb_t *esp_camera_fb_get(void) {
+  std::unique_lock<std::mutex> guard(cam.lock);
+  if (!cam.initialized) {
+    return NULL;
+  }
+  // Sem buffer livre o driver real espera até o timeout e desiste
+  auto has_free = [] { return std::find(cam.in_use.begin(), cam.in_use.end(), false) != cam.in_use.end(); };
+  if (!cam.returned.wait_for(guard, std::chrono::seconds(4), has_free)) {
+    log_e("Failed to get the frame on time!");
+    return NULL;
+  }
+  size_t slot = std::find(cam.in_use.begin(), cam.in_use.end(), false) - cam.in_use.begin();
+  cam.in_use[slot] = true;
+
+  int64_t index;
+  if (cam.fps <= 0) {
+    index = cam.last_index + 1;
+  } else {
+    int64_t period = (int64_t)(1e6 / cam.fps);
+    int64_t now = esp_timer_get_time() - cam.start_us;
+    index = now / period;
+    if (index <= cam.last_index || cam.grab_mode == CAMERA_GRAB_WHEN_EMPTY) {
+      // Espera o próximo quadro terminar de chegar do sensor
+      index = std::max(index, cam.last_index) + 1;
+      int64_t due = index * period;
+      guard.unlock();
+      std::this_thread::sleep_for(std::chrono::microseconds(due - now));
+      guard.lock();
+    }
+  }
+  cam.last_index = index;
+  cam.served++;
+  update_scene_locked();
+
+  Frame &fr = cam.frames[(cam.frozen_index >= 0 ? cam.frozen_index : index) % cam.frames.size()];
+  camera_fb_t *fb = &cam.fbs[slot];
+  fb->buf = fr.jpeg.data();
+  fb->len = fr.jpeg.size();
+  fb->width = fr.width;
+  fb->height = fr.height;
+  fb->format = PIXFORMAT_JPEG;
+  gettimeofday(&fb->timestamp, NULL);
+  return fb;
+}
+
+void esp_camera_fb_return(camera_fb_t *fb) {
+  std::lock_guard<std::mutex> guard(cam.lock);
+  size_t slot = fb - cam.fbs.data();
+  if (slot < cam.in_use.size()) {
+    cam.in_use[slot] = false;
+    cam.returned.notify_all();
+  }
+}
+
+sensor_t *esp_camera_sensor_get(void) {
+  std::lock_guard<std::mutex> guard(cam.lock);
+  return cam.initialized ? &cam.sensor : NULL;
+}
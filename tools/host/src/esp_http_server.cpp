@@ -0,0 +1,613 @@
+// esp_http_server sobre sockets POSIX. Segue o modelo do ESP-IDF: uma tarefa
+// por servidor, select/poll sobre as sessões abertas e uma requisição por
+// vez; um handler que não retorna segura o servidor inteiro, a menos que
+// passe a requisição adiante com httpd_req_async_handler_begin.
+
+#include "esp_http_server.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "esp32-hal-log.h"
+#include "esp_host.h"
+
+namespace {
+
+struct Work {
+  httpd_work_fn_t fn;
+  void *arg;
+};
+
+struct Server {
+  httpd_config_t cfg;
+  uint16_t port = 0;
+  int listen_fd = -1;
+  int wake[2] = {-1, -1};
+  std::atomic<bool> running{false};
+  std::thread thread;
+  std::vector<httpd_uri_t> uris;
+  std::vector<int> sessions;
+  std::mutex lock;  // work, close_pending e async vêm de outras tarefas
+  std::deque<Work> work;
+  std::vector<int> close_pending;
+  std::vector<int> async;  // sessões com requisição em outra tarefa
+};
+
+// Buffer de envio do lwip (TCP_SND_BUF): um cliente lento trava o envio cedo,
+// como no ESP32, em vez de encher os megabytes do loopback do Linux. O MSS
+// do lwip também: com o de 64 KB do loopback, um cliente que lê devagar só
+// reabre a janela depois de esvaziar metade do buffer.
+#define HOST_TCP_SND_BUF 5744
+#define HOST_TCP_MSS 1436
+
+struct Aux {
+  Server *srv;
+  int fd;
+  std::string pending;  // bytes do corpo lidos junto com o cabeçalho
+  size_t body_left;
+  std::vector<std::pair<std::string, std::string>> req_headers;
+  std::string status = "200 OK";
+  std::string type = "text/html";
+  std::vector<std::pair<std::string, std::string>> resp_headers;
+  bool headers_sent = false;
+  bool chunked = false;
+  bool keep_alive = true;
+};
+
+Aux *aux_of(httpd_req_t *r) {
+  return static_cast<Aux *>(r->aux);
+}
+
+bool send_all(int fd, const char *buf, size_t len) {
+  while (len > 0) {
+    ssize_t n = send(fd, buf, len, MSG_NOSIGNAL);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return false;
+    }
+    buf += n;
+    len -= n;
+  }
+  return true;
+}
+
+void set_timeouts(int fd, const httpd_config_t &cfg) {
+  struct timeval rcv = {cfg.recv_wait_timeout, 0};
+  struct timeval snd = {cfg.send_wait_timeout, 0};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &rcv, sizeof(rcv));
+  setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &snd, sizeof(snd));
+  int sndbuf = HOST_TCP_SND_BUF;
+  setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+}
+
+const char *method_name(int method) {
+  switch (method) {
+    case HTTP_DELETE: return "DELETE";
+    case HTTP_GET: return "GET";
+    case HTTP_HEAD: return "HEAD";
+    case HTTP_POST: return "POST";
+    case HTTP_PUT: return "PUT";
+    default: return "?";
+  }
+}
+
+int parse_method(const std::string &m) {
+  static const int methods[] = {HTTP_DELETE, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT};
+  for (int method : methods) {
+    if (m == method_name(method)) {
+      return method;
+    }
+  }
+  return -1;
+}
+
+esp_err_t send_headers(httpd_req_t *r, ssize_t content_len) {
+  Aux *a = aux_of(r);
+  std::string h = "HTTP/1.1 " + a->status + "\r\nContent-Type: " + a->type + "\r\n";
+  if (content_len >= 0) {
+    h += "Content-Length: " + std::to_string(content_len) + "\r\n";
+  } else {
+    h += "Transfer-Encoding: chunked\r\n";
+  }
+  for (const auto &kv : a->resp_headers) {
+    h += kv.first + ": " + kv.second + "\r\n";
+  }
+  h += "\r\n";
+  a->headers_sent = true;
+  return send_all(a->fd, h.data(), h.size()) ? ESP_OK : ESP_ERR_HTTPD_RESP_SEND;
+}
+
+// Lê até o fim do cabeçalho; o excesso (início do corpo) fica em `rest`
+bool read_head(int fd, std::string &head, std::string &rest) {
+  char buf[1024];
+  head.clear();
+  while (head.size() < 16384) {
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if (n < 0 && errno == EINTR) {
+      continue;
+    }
+    if (n <= 0) {
+      return false;
+    }
+    head.append(buf, n);
+    size_t end = head.find("\r\n\r\n");
+    if (end != std::string::npos) {
+      rest = head.substr(end + 4);
+      head.resize(end + 2);
+      return true;
+    }
+  }
+  return false;
+}
+
+bool uri_matches(const char *pattern, const char *uri) {
+  size_t len = strcspn(uri, "?");
+  return strlen(pattern) == len && strncmp(pattern, uri, len) == 0;
+}
+
+// Atende uma requisição; retorna false se a sessão deve ser fechada
+bool serve(Server *srv, int fd) {
+  std::string head, rest;
+  if (!read_head(fd, head, rest)) {
+    return false;
+  }
+  size_t line_end = head.find("\r\n");
+  std::string line = head.substr(0, line_end);
+  size_t sp1 = line.find(' ');
+  size_t sp2 = line.rfind(' ');
+  if (sp1 == std::string::npos || sp2 == sp1) {
+    return false;
+  }
+  std::string uri = line.substr(sp1 + 1, sp2 - sp1 - 1);
+
+  httpd_req_t req = {};
+  Aux aux;
+  aux.srv = srv;
+  aux.fd = fd;
+  req.handle = srv;
+  req.method = parse_method(line.substr(0, sp1));
+  req.aux = &aux;
+  snprintf(const_cast<char *>(req.uri), sizeof(req.uri), "%s", uri.c_str());
+
+  for (size_t pos = line_end + 2; pos < head.size();) {
+    size_t eol = head.find("\r\n", pos);
+    std::string h = head.substr(pos, eol - pos);
+    pos = eol + 2;
+    size_t colon = h.find(':');
+    if (colon == std::string::npos) {
+      continue;
+    }
+    std::string value = h.substr(colon + 1);
+    value.erase(0, value.find_first_not_of(" \t"));
+    aux.req_headers.emplace_back(h.substr(0, colon), value);
+    if (!strcasecmp(h.substr(0, colon).c_str(), "Content-Length")) {
+      req.content_len = strtoul(value.c_str(), NULL, 10);
+    } else if (!strcasecmp(h.substr(0, colon).c_str(), "Connection") && !strcasecmp(value.c_str(), "close")) {
+      aux.keep_alive = false;
+    }
+  }
+  aux.pending = rest.substr(0, std::min(rest.size(), req.content_len));
+  aux.body_left = req.content_len;
+
+  const httpd_uri_t *handler = NULL;
+  bool uri_found = false;
+  for (const auto &u : srv->uris) {
+    if (uri_matches(u.uri, req.uri)) {
+      uri_found = true;
+      if ((int)u.method == req.method) {
+        handler = &u;
+        break;
+      }
+    }
+  }
+  esp_err_t res;
+  if (!handler) {
+    log_w("URI '%s' %s", req.uri, uri_found ? "method not allowed" : "not found");
+    httpd_resp_send_err(&req, HTTPD_404_NOT_FOUND, NULL);
+    res = ESP_FAIL;
+  } else {
+    req.user_ctx = handler->user_ctx;
+    res = handler->handler(&req);
+  }
+
+  // Corpo não lido pelo handler é descartado para a próxima requisição
+  char discard[512];
+  while (res == ESP_OK && aux.body_left > 0) {
+    int n = httpd_req_recv(&req, discard, sizeof(discard));
+    if (n <= 0) {
+      return false;
+    }
+  }
+  if (req.free_ctx && req.sess_ctx) {
+    req.free_ctx(req.sess_ctx);
+  }
+  {
+    // Requisição passada a outra tarefa: a sessão fica até o complete
+    std::lock_guard<std::mutex> guard(srv->lock);
+    if (std::find(srv->async.begin(), srv->async.end(), fd) != srv->async.end()) {
+      return true;
+    }
+  }
+  return res == ESP_OK && aux.keep_alive;
+}
+
+void close_session(Server *srv, int fd) {
+  if (srv->cfg.close_fn) {
+    srv->cfg.close_fn(srv, fd);
+  } else {
+    close(fd);
+  }
+  srv->sessions.erase(std::remove(srv->sessions.begin(), srv->sessions.end(), fd), srv->sessions.end());
+}
+
+void server_task(Server *srv) {
+  pthread_setname_np(pthread_self(), "httpd");
+  while (srv->running) {
+    std::vector<pollfd> fds;
+    fds.push_back({srv->listen_fd, POLLIN, 0});
+    fds.push_back({srv->wake[0], POLLIN, 0});
+    {
+      std::lock_guard<std::mutex> guard(srv->lock);
+      for (int fd : srv->sessions) {
+        if (std::find(srv->async.begin(), srv->async.end(), fd) == srv->async.end()) {
+          fds.push_back({fd, POLLIN, 0});
+        }
+      }
+    }
+    if (poll(fds.data(), fds.size(), 200) < 0 && errno != EINTR) {
+      break;
+    }
+
+    if (fds[1].revents & POLLIN) {
+      char drain[64];
+      (void)!read(srv->wake[0], drain, sizeof(drain));
+    }
+    std::deque<Work> work;
+    std::vector<int> to_close;
+    {
+      std::lock_guard<std::mutex> guard(srv->lock);
+      work.swap(srv->work);
+      to_close.swap(srv->close_pending);
+    }
+    for (const Work &w : work) {
+      w.fn(w.arg);
+    }
+    for (int fd : to_close) {
+      {
+        std::lock_guard<std::mutex> guard(srv->lock);
+        if (std::find(srv->async.begin(), srv->async.end(), fd) != srv->async.end()) {
+          srv->close_pending.push_back(fd);  // fecha depois do complete
+          continue;
+        }
+      }
+      if (std::find(srv->sessions.begin(), srv->sessions.end(), fd) != srv->sessions.end()) {
+        close_session(srv, fd);
+      }
+    }
+
+    for (size_t i = 2; i < fds.size(); i++) {
+      if (fds[i].revents & (POLLIN | POLLHUP | POLLERR)) {
+        if (!serve(srv, fds[i].fd)) {
+          close_session(srv, fds[i].fd);
+        }
+      }
+    }
+
+    if (fds[0].revents & POLLIN) {
+      int fd = accept(srv->listen_fd, NULL, NULL);
+      if (fd < 0) {
+        continue;
+      }
+      if (srv->sessions.size() >= srv->cfg.max_open_sockets) {
+        bool front_async;
+        {
+          std::lock_guard<std::mutex> guard(srv->lock);
+          front_async = !srv->sessions.empty() && std::find(srv->async.begin(), srv->async.end(), srv->sessions.front()) != srv->async.end();
+        }
+        if (!srv->cfg.lru_purge_enable || srv->sessions.empty() || front_async) {
+          log_w("Too many open sessions, closing new connection");
+          close(fd);
+          continue;
+        }
+        close_session(srv, srv->sessions.front());
+      }
+      set_timeouts(fd, srv->cfg);
+      if (srv->cfg.open_fn && srv->cfg.open_fn(srv, fd) != ESP_OK) {
+        close(fd);
+        continue;
+      }
+      srv->sessions.push_back(fd);
+    }
+  }
+  while (!srv->sessions.empty()) {
+    close_session(srv, srv->sessions.front());
+  }
+}
+
+}  // namespace
+
+esp_err_t httpd_start(httpd_handle_t *handle, const httpd_config_t *config) {
+  Server *srv = new Server;
+  srv->cfg = *config;
+  srv->port = esp_host_port(config->server_port);
+  srv->listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+  int one = 1;
+  setsockopt(srv->listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  int mss = HOST_TCP_MSS;
+  setsockopt(srv->listen_fd, IPPROTO_TCP, TCP_MAXSEG, &mss, sizeof(mss));
+  struct sockaddr_in addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(srv->port);
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(srv->listen_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(srv->listen_fd, config->backlog_conn) != 0 || pipe(srv->wake) != 0) {
+    log_e("Failed to listen on port %u: %s", srv->port, strerror(errno));
+    close(srv->listen_fd);
+    delete srv;
+    return ESP_FAIL;
+  }
+  log_i("httpd listening on port %u", srv->port);
+  srv->running = true;
+  srv->thread = std::thread(server_task, srv);
+  *handle = srv;
+  return ESP_OK;
+}
+
+esp_err_t httpd_stop(httpd_handle_t handle) {
+  Server *srv = static_cast<Server *>(handle);
+  if (!srv) {
+    return ESP_ERR_INVALID_ARG;
+  }
+  srv->running = false;
+  (void)!write(srv->wake[1], "x", 1);
+  // Handlers presos em envio retornam quando o cliente fecha ou no timeout
+  shutdown(srv->listen_fd, SHUT_RDWR);
+  srv->thread.join();
+  close(srv->listen_fd);
+  close(srv->wake[0]);
+  close(srv->wake[1]);
+  delete srv;
+  return ESP_OK;
+}
+
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t *uri_handler) {
+  Server *srv = static_cast<Server *>(handle);
+  for (const auto &u : srv->uris) {
+    if (!strcmp(u.uri, uri_handler->uri) && u.method == uri_handler->method) {
+      return ESP_ERR_HTTPD_HANDLER_EXISTS;
+    }
+  }
+  if (srv->uris.size() >= srv->cfg.max_uri_handlers) {
+    log_e("No slots left for registering handler %s", uri_handler->uri);
+    return ESP_ERR_HTTPD_HANDLERS_FULL;
+  }
+  srv->uris.push_back(*uri_handler);
+  return ESP_OK;
+}
+
+esp_err_t httpd_queue_work(httpd_handle_t handle, httpd_work_fn_t work, void *arg) {
+  Server *srv = static_cast<Server *>(handle);
+  {
+    std::lock_guard<std::mutex> guard(srv->lock);
+    srv->work.push_back({work, arg});
+  }
+  (void)!write(srv->wake[1], "w", 1);
+  return ESP_OK;
+}
+
+esp_err_t httpd_sess_trigger_close(httpd_handle_t handle, int sockfd) {
+  Server *srv = static_cast<Server *>(handle);
+  {
+    std::lock_guard<std::mutex> guard(srv->lock);
+    srv->close_pending.push_back(sockfd);
+  }
+  (void)!write(srv->wake[1], "c", 1);
+  return ESP_OK;
+}
+
+esp_err_t httpd_req_async_handler_begin(httpd_req_t *r, httpd_req_t **out) {
+  Aux *a = aux_of(r);
+  // uri é const: a cópia é byte a byte, como no IDF
+  httpd_req_t *copy = static_cast<httpd_req_t *>(malloc(sizeof(httpd_req_t)));
+  if (!copy) {
+    return ESP_ERR_NO_MEM;
+  }
+  memcpy(static_cast<void *>(copy), r, sizeof(*copy));
+  copy->aux = new Aux(*a);
+  // O contexto da sessão continua sendo do servidor
+  copy->sess_ctx = NULL;
+  copy->free_ctx = NULL;
+  {
+    std::lock_guard<std::mutex> guard(a->srv->lock);
+    a->srv->async.push_back(a->fd);
+  }
+  *out = copy;
+  return ESP_OK;
+}
+
+esp_err_t httpd_req_async_handler_complete(httpd_req_t *r) {
+  Aux *a = aux_of(r);
+  Server *srv = a->srv;
+  {
+    std::lock_guard<std::mutex> guard(srv->lock);
+    srv->async.erase(std::remove(srv->async.begin(), srv->async.end(), a->fd), srv->async.end());
+  }
+  delete a;
+  free(r);
+  (void)!write(srv->wake[1], "a", 1);
+  return ESP_OK;
+}
+
+size_t httpd_req_get_url_query_len(httpd_req_t *r) {
+  const char *q = strchr(r->uri, '?');
+  return q ? strlen(q + 1) : 0;
+}
+
+esp_err_t httpd_req_get_url_query_str(httpd_req_t *r, char *buf, size_t buf_len) {
+  const char *q = strchr(r->uri, '?');
+  if (!q) {
+    return ESP_ERR_NOT_FOUND;
+  }
+  snprintf(buf, buf_len, "%s", q + 1);
+  return strlen(q + 1) < buf_len ? ESP_OK : ESP_ERR_HTTPD_RESULT_TRUNC;
+}
+
+esp_err_t httpd_query_key_value(const char *qry, const char *key, char *val, size_t val_size) {
+  size_t key_len = strlen(key);
+  for (const char *p = qry; p && *p;) {
+    const char *end = strchr(p, '&');
+    size_t len = end ? (size_t)(end - p) : strlen(p);
+    if (len > key_len && p[key_len] == '=' && !strncmp(p, key, key_len)) {
+      size_t vlen = len - key_len - 1;
+      size_t copy = std::min(vlen, val_size - 1);
+      memcpy(val, p + key_len + 1, copy);
+      val[copy] = 0;
+      return vlen < val_size ? ESP_OK : ESP_ERR_HTTPD_RESULT_TRUNC;
+    }
+    p = end ? end + 1 : NULL;
+  }
+  return ESP_ERR_NOT_FOUND;
+}
+
+size_t httpd_req_get_hdr_value_len(httpd_req_t *r, const char *field) {
+  for (const auto &kv : aux_of(r)->req_headers) {
+    if (!strcasecmp(kv.first.c_str(), field)) {
+      return kv.second.size();
+    }
+  }
+  return 0;
+}
+
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t *r, const char *field, char *val, size_t val_size) {
+  for (const auto &kv : aux_of(r)->req_headers) {
+    if (!strcasecmp(kv.first.c_str(), field)) {
+      snprintf(val, val_size, "%s", kv.second.c_str());
+      return kv.second.size() < val_size ? ESP_OK : ESP_ERR_HTTPD_RESULT_TRUNC;
+    }
+  }
+  return ESP_ERR_NOT_FOUND;
+}
+
+int httpd_req_recv(httpd_req_t *r, char *buf, size_t buf_len) {
+  Aux *a = aux_of(r);
+  size_t want = std::min(buf_len, a->body_left);
+  if (want == 0) {
+    return 0;
+  }
+  if (!a->pending.empty()) {
+    size_t n = std::min(want, a->pending.size());
+    memcpy(buf, a->pending.data(), n);
+    a->pending.erase(0, n);
+    a->body_left -= n;
+    return n;
+  }
+  ssize_t n = recv(a->fd, buf, want, 0);
+  if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+    return HTTPD_SOCK_ERR_TIMEOUT;
+  }
+  if (n <= 0) {
+    return HTTPD_SOCK_ERR_FAIL;
+  }
+  a->body_left -= n;
+  return n;
+}
+
+int httpd_req_to_sockfd(httpd_req_t *r) {
+  return r && r->aux ? aux_of(r)->fd : -1;
+}
+
+int httpd_send(httpd_req_t *r, const char *buf, size_t buf_len) {
+  return send_all(aux_of(r)->fd, buf, buf_len) ? (int)buf_len : HTTPD_SOCK_ERR_FAIL;
+}
+
+esp_err_t httpd_resp_set_status(httpd_req_t *r, const char *status) {
+  aux_of(r)->status = status;
+  return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_type(httpd_req_t *r, const char *type) {
+  aux_of(r)->type = type;
+  return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_hdr(httpd_req_t *r, const char *field, const char *value) {
+  Aux *a = aux_of(r);
+  if (a->resp_headers.size() >= a->srv->cfg.max_resp_headers) {
+    return ESP_ERR_HTTPD_RESP_HDR;
+  }
+  a->resp_headers.emplace_back(field, value);
+  return ESP_OK;
+}
+
+esp_err_t httpd_resp_send(httpd_req_t *r, const char *buf, ssize_t buf_len) {
+  if (buf_len == HTTPD_RESP_USE_STRLEN) {
+    buf_len = buf ? strlen(buf) : 0;
+  }
+  esp_err_t res = send_headers(r, buf_len);
+  if (res == ESP_OK && buf_len > 0 && !send_all(aux_of(r)->fd, buf, buf_len)) {
+    res = ESP_ERR_HTTPD_RESP_SEND;
+  }
+  return res;
+}
+
+esp_err_t httpd_resp_send_chunk(httpd_req_t *r, const char *buf, ssize_t buf_len) {
+  Aux *a = aux_of(r);
+  if (buf_len == HTTPD_RESP_USE_STRLEN) {
+    buf_len = buf ? strlen(buf) : 0;
+  }
+  if (!a->headers_sent) {
+    a->chunked = true;
+    if (send_headers(r, -1) != ESP_OK) {
+      return ESP_ERR_HTTPD_RESP_SEND;
+    }
+  }
+  char size[16];
+  int n = snprintf(size, sizeof(size), "%zx\r\n", (size_t)buf_len);
+  bool ok = send_all(a->fd, size, n);
+  if (ok && buf_len > 0) {
+    ok = send_all(a->fd, buf, buf_len);
+  }
+  if (ok) {
+    ok = send_all(a->fd, "\r\n", 2);
+  }
+  return ok ? ESP_OK : ESP_ERR_HTTPD_RESP_SEND;
+}
+
+esp_err_t httpd_resp_send_err(httpd_req_t *req, httpd_err_code_t error, const char *msg) {
+  const char *status;
+  const char *text;
+  switch (error) {
+    case HTTPD_400_BAD_REQUEST: status = HTTPD_400; text = "Bad request syntax"; break;
+    case HTTPD_404_NOT_FOUND: status = HTTPD_404; text = "This URI does not exist"; break;
+    case HTTPD_408_REQ_TIMEOUT: status = HTTPD_408; text = "Server closed this connection"; break;
+    default: status = HTTPD_500; text = "Server has encountered an unexpected error"; break;
+  }
+  Aux *a = aux_of(req);
+  if (a->headers_sent) {
+    return ESP_ERR_HTTPD_RESP_SEND;
+  }
+  a->status = status;
+  a->type = "text/html";
+  return httpd_resp_send(req, msg ? msg : text, HTTPD_RESP_USE_STRLEN);
+}
@@ -0,0 +1,402 @@
+// esp_timer, esp_err, heap_caps, LEDC e partições para o build de host.
+
+#include <fcntl.h>
+#include <malloc.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "esp32-hal-ledc.h"
+#include "esp32-hal-log.h"
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_random.h"
+#include "esp_host.h"
+#include "esp_partition.h"
+#include "esp_timer.h"
+
+// ---- esp_timer ----
+
+namespace {
+const auto kBoot = std::chrono::steady_clock::now();
+}
+
+int64_t esp_timer_get_time(void) {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - kBoot).count();
+}
+
+struct esp_timer {
+  esp_timer_create_args_t args;
+  std::mutex lock;
+  std::condition_variable cv;
+  uint64_t generation = 0;  // cada start/stop invalida a espera anterior
+  bool deleted = false;
+};
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *create_args, esp_timer_handle_t *out_handle) {
+  esp_timer_handle_t t = new esp_timer;
+  t->args = *create_args;
+  *out_handle = t;
+  return ESP_OK;
+}
+
+static void timer_run(esp_timer_handle_t t, uint64_t period_us, bool periodic) {
+  std::unique_lock<std::mutex> guard(t->lock);
+  uint64_t gen = ++t->generation;
+  std::thread([t, gen, period_us, periodic] {
+    auto due = std::chrono::steady_clock::now() + std::chrono::microseconds(period_us);
+    std::unique_lock<std::mutex> guard(t->lock);
+    while (true) {
+      if (t->cv.wait_until(guard, due, [t, gen] { return t->generation != gen; })) {
+        return;
+      }
+      guard.unlock();
+      t->args.callback(t->args.arg);
+      guard.lock();
+      if (!periodic || t->generation != gen) {
+        return;
+      }
+      due += std::chrono::microseconds(period_us);
+    }
+  }).detach();
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us) {
+  timer_run(timer, timeout_us, false);
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period) {
+  timer_run(timer, period, true);
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+  std::lock_guard<std::mutex> guard(timer->lock);
+  timer->generation++;
+  timer->cv.notify_all();
+  return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer) {
+  esp_timer_stop(timer);
+  // A thread do timer pode ainda estar acordando: o objeto fica vivo
+  timer->deleted = true;
+  return ESP_OK;
+}
+
+// ---- Portas: 80 vira 8080 etc., para rodar sem root ----
+
+uint16_t esp_host_port(uint16_t port) {
+  const char *env = getenv("ESP_HOST_PORT_OFFSET");
+  return port + (env ? atoi(env) : 8000);
+}
+
+extern "C" int esp_host_bind(int fd, const struct sockaddr *addr, socklen_t len) {
+  if (addr->sa_family != AF_INET || len < sizeof(sockaddr_in)) {
+    return bind(fd, addr, len);
+  }
+  sockaddr_in in;
+  memcpy(&in, addr, sizeof(in));
+  if (in.sin_port) {
+    in.sin_port = htons(esp_host_port(ntohs(in.sin_port)));
+  }
+  return bind(fd, (const sockaddr *)&in, sizeof(in));
+}
+
+// ---- esp_random ----
+
+extern "C" uint32_t esp_random(void) {
+  static std::mutex lock;
+  static std::random_device device;
+  std::lock_guard<std::mutex> guard(lock);
+  return device();
+}
+
+// ---- esp_err ----
+
+const char *esp_err_to_name(esp_err_t code) {
+  switch (code) {
+    case ESP_OK: return "ESP_OK";
+    case ESP_FAIL: return "ESP_FAIL";
+    case ESP_ERR_NO_MEM: return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG: return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE: return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND: return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_TIMEOUT: return "ESP_ERR_TIMEOUT";
+    default: return "UNKNOWN ERROR";
+  }
+}
+
+// ---- heap_caps ----
+// O host não tem as regiões do ESP32: os valores livres são os de um
+// ESP32 com 4 MB de PSRAM, descontando o que foi alocado em PSRAM.
+
+namespace {
+std::atomic<size_t> psram_used{0};
+const size_t kInternalFree = 180 * 1024;
+const size_t kInternalLargest = 110 * 1024;
+const size_t kPsramSize = 4 * 1024 * 1024;
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps) {
+  void *p = malloc(size);
+  if (p && (caps & MALLOC_CAP_SPIRAM)) {
+    psram_used += malloc_usable_size(p);
+  }
+  return p;
+}
+
+void *heap_caps_calloc(size_t n, size_t size, uint32_t caps) {
+  void *p = heap_caps_malloc(n * size, caps);
+  if (p) {
+    memset(p, 0, n * size);
+  }
+  return p;
+}
+
+void *heap_caps_realloc(void *ptr, size_t size, uint32_t caps) {
+  (void)caps;
+  return realloc(ptr, size);
+}
+
+void heap_caps_free(void *ptr) {
+  free(ptr);
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+  return (caps & MALLOC_CAP_SPIRAM) ? kPsramSize - std::min(psram_used.load(), kPsramSize) : kInternalFree;
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+  return (caps & MALLOC_CAP_SPIRAM) ? heap_caps_get_free_size(caps) : kInternalLargest;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+  return heap_caps_get_free_size(caps);
+}
+
+// ---- LEDC ----
+
+bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution) {
+  log_d("ledcAttach(pin=%u, freq=%u, bits=%u)", pin, freq, resolution);
+  return true;
+}
+
+bool ledcWrite(uint8_t pin, uint32_t duty) {
+  log_d("ledcWrite(pin=%u, duty=%u)", pin, duty);
+  return true;
+}
+
+// ---- Partições ----
+
+namespace {
+
+struct Flash {
+  std::once_flag loaded;
+  std::vector<esp_partition_t> table;
+  uint8_t *image = nullptr;
+  size_t size = 0;
+  std::mutex lock;
+  size_t fail_after = 0;  // bytes restantes até a "queda de energia"
+  bool failing = false;
+};
+
+Flash flash;
+
+uint32_t parse_num(const std::string &s) {
+  return strtoul(s.c_str(), NULL, 0);
+}
+
+std::string trim(const std::string &s) {
+  size_t b = s.find_first_not_of(" \t\r");
+  size_t e = s.find_last_not_of(" \t\r");
+  return b == std::string::npos ? std::string() : s.substr(b, e - b + 1);
+}
+
+int parse_subtype(const std::string &type, const std::string &s) {
+  static const struct {
+    const char *name;
+    int value;
+  } kSubtypes[] = {
+    {"factory", 0x00}, {"ota_0", 0x10}, {"ota_1", 0x11}, {"ota", 0x00}, {"phy", 0x01}, {"nvs", 0x02}, {"coredump", 0x03},
+    {"nvs_keys", 0x04}, {"efuse", 0x05}, {"undefined", 0x06}, {"fat", 0x81}, {"spiffs", 0x82}, {"littlefs", 0x83},
+  };
+  if (s.empty()) {
+    return type == "app" ? 0x00 : 0x06;
+  }
+  for (const auto &st : kSubtypes) {
+    if (s == st.name) {
+      return st.value;
+    }
+  }
+  return parse_num(s);
+}
+
+void load_flash() {
+  const char *csv = getenv("ESP_HOST_PARTITIONS");
+  std::ifstream in(csv ? csv : FIRMWARE_DIR "/partitions.csv");
+  std::string line;
+  while (std::getline(in, line)) {
+    line = trim(line);
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::vector<std::string> f;
+    std::stringstream ss(line);
+    std::string field;
+    while (std::getline(ss, field, ',')) {
+      f.push_back(trim(field));
+    }
+    if (f.size() < 5) {
+      continue;
+    }
+    esp_partition_t p;
+    memset(&p, 0, sizeof(p));
+    snprintf(p.label, sizeof(p.label), "%s", f[0].c_str());
+    p.type = f[1] == "app" ? ESP_PARTITION_TYPE_APP : ESP_PARTITION_TYPE_DATA;
+    p.subtype = (esp_partition_subtype_t)parse_subtype(f[1], f[2]);
+    p.address = parse_num(f[3]);
+    p.size = parse_num(f[4]);
+    p.erase_size = 4096;
+    flash.table.push_back(p);
+    flash.size = std::max(flash.size, (size_t)p.address + p.size);
+  }
+  if (flash.table.empty()) {
+    log_e("No partition table found");
+    return;
+  }
+
+  const char *path = getenv("ESP_HOST_FLASH");
+  if (path) {
+    int fd = open(path, O_RDWR | O_CREAT, 0644);
+    off_t existing = lseek(fd, 0, SEEK_END);
+    if (fd >= 0 && existing < (off_t)flash.size) {
+      std::vector<uint8_t> blank(flash.size - existing, 0xFF);
+      (void)!pwrite(fd, blank.data(), blank.size(), existing);
+    }
+    void *m = fd >= 0 ? mmap(NULL, flash.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+    if (fd >= 0) {
+      close(fd);
+    }
+    if (m != MAP_FAILED) {
+      flash.image = (uint8_t *)m;
+      log_i("Flash image: %s (%zu bytes)", path, flash.size);
+      return;
+    }
+    log_e("Cannot map flash image %s; using RAM", path);
+  }
+  flash.image = (uint8_t *)malloc(flash.size);
+  memset(flash.image, 0xFF, flash.size);
+}
+
+uint8_t *flash_at(const esp_partition_t *p, size_t offset) {
+  return flash.image + p->address + offset;
+}
+
+// Consome o orçamento de falha; retorna quantos bytes ainda podem ir
+size_t flash_budget(size_t size) {
+  if (flash.failing) {
+    return 0;
+  }
+  if (!flash.fail_after) {
+    return size;
+  }
+  if (size < flash.fail_after) {
+    flash.fail_after -= size;
+    return size;
+  }
+  size_t allowed = flash.fail_after;
+  flash.fail_after = 0;
+  flash.failing = true;
+  return allowed;
+}
+
+}  // namespace
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char *label) {
+  std::call_once(flash.loaded, load_flash);
+  for (const auto &p : flash.table) {
+    if ((type == ESP_PARTITION_TYPE_ANY || p.type == type) && (subtype == ESP_PARTITION_SUBTYPE_ANY || p.subtype == subtype) &&
+        (!label || !strcmp(label, p.label))) {
+      return &p;
+    }
+  }
+  return NULL;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *p, size_t offset, size_t size, esp_partition_mmap_memory_t memory, const void **out_ptr,
+                             esp_partition_mmap_handle_t *out_handle) {
+  (void)memory;
+  if (offset + size > p->size) {
+    return ESP_ERR_INVALID_ARG;
+  }
+  *out_ptr = flash_at(p, offset);
+  *out_handle = p->address + offset;
+  return ESP_OK;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle) {
+  (void)handle;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t *p, size_t offset, size_t size) {
+  if (offset % p->erase_size || size % p->erase_size || offset + size > p->size) {
+    return ESP_ERR_INVALID_ARG;
+  }
+  std::lock_guard<std::mutex> guard(flash.lock);
+  size_t allowed = flash_budget(size);
+  memset(flash_at(p, offset), 0xFF, allowed);
+  return allowed == size ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t *p, size_t dst_offset, const void *src, size_t size) {
+  if (dst_offset + size > p->size) {
+    return ESP_ERR_INVALID_SIZE;
+  }
+  std::lock_guard<std::mutex> guard(flash.lock);
+  size_t allowed = flash_budget(size);
+  uint8_t *dst = flash_at(p, dst_offset);
+  for (size_t i = 0; i < allowed; i++) {
+    dst[i] &= ((const uint8_t *)src)[i];
+  }
+  return allowed == size ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *p, size_t src_offset, void *dst, size_t size) {
+  if (src_offset + size > p->size) {
+    return ESP_ERR_INVALID_SIZE;
+  }
+  memcpy(dst, flash_at(p, src_offset), size);
+  return ESP_OK;
+}
+
+void esp_host_flash_fail_after(size_t bytes) {
+  std::lock_guard<std::mutex> guard(flash.lock);
+  flash.fail_after = bytes;
+  flash.failing = false;
+}
+
+uint8_t *esp_host_flash_image(size_t *size) {
+  std::call_once(flash.loaded, load_flash);
+  *size = flash.size;
+  return flash.image;
+}
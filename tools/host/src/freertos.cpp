@@ -0,0 +1,239 @@
+// Tarefas, semáforos e filas do FreeRTOS sobre std::thread (build de host).
+// Um tick = 1 ms (CONFIG_FREERTOS_HZ 1000); prioridades e núcleos são ignorados.
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+#include <pthread.h>
+#include <string.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct tskTaskControlBlock {
+  std::string name;
+  std::mutex lock;
+  std::condition_variable cv;
+  bool suspended = false;
+};
+
+// Semáforos e filas compartilham a mesma estrutura, como no FreeRTOS
+struct QueueDefinition {
+  std::mutex lock;
+  std::condition_variable changed;
+  size_t item_size;
+  size_t capacity;
+  std::vector<uint8_t> items;  // item_size * count, em ordem
+  size_t count = 0;
+};
+
+namespace {
+
+const auto kStart = std::chrono::steady_clock::now();
+
+tskTaskControlBlock main_task{"loopTask"};
+thread_local tskTaskControlBlock *current = &main_task;
+
+template <typename Pred>
+bool wait_for(std::unique_lock<std::mutex> &guard, std::condition_variable &cv, TickType_t ticks, Pred pred) {
+  if (ticks == portMAX_DELAY) {
+    cv.wait(guard, pred);
+    return true;
+  }
+  return cv.wait_for(guard, std::chrono::milliseconds(ticks * portTICK_PERIOD_MS), pred);
+}
+
+BaseType_t queue_send(QueueHandle_t q, const void *item, TickType_t ticks, bool front) {
+  std::unique_lock<std::mutex> guard(q->lock);
+  if (!wait_for(guard, q->changed, ticks, [q] { return q->count < q->capacity; })) {
+    return pdFALSE;
+  }
+  if (q->item_size) {
+    if (front) {
+      q->items.insert(q->items.begin(), (const uint8_t *)item, (const uint8_t *)item + q->item_size);
+    } else {
+      q->items.insert(q->items.end(), (const uint8_t *)item, (const uint8_t *)item + q->item_size);
+    }
+  }
+  q->count++;
+  q->changed.notify_all();
+  return pdTRUE;
+}
+
+BaseType_t queue_receive(QueueHandle_t q, void *out, TickType_t ticks, bool remove) {
+  std::unique_lock<std::mutex> guard(q->lock);
+  if (!wait_for(guard, q->changed, ticks, [q] { return q->count > 0; })) {
+    return pdFALSE;
+  }
+  if (q->item_size) {
+    memcpy(out, q->items.data(), q->item_size);
+    if (remove) {
+      q->items.erase(q->items.begin(), q->items.begin() + q->item_size);
+    }
+  }
+  if (remove) {
+    q->count--;
+    q->changed.notify_all();
+  }
+  return pdTRUE;
+}
+
+}  // namespace
+
+void vTaskDelay(const TickType_t xTicksToDelay) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(xTicksToDelay * portTICK_PERIOD_MS));
+}
+
+TickType_t xTaskGetTickCount(void) {
+  auto elapsed = std::chrono::steady_clock::now() - kStart;
+  return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() / portTICK_PERIOD_MS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t pxTaskCode, const char *const pcName, const uint32_t usStackDepth, void *const pvParameters,
+                                   UBaseType_t uxPriority, TaskHandle_t *const pxCreatedTask, const BaseType_t xCoreID) {
+  (void)usStackDepth;
+  (void)uxPriority;
+  (void)xCoreID;
+  tskTaskControlBlock *tcb = new tskTaskControlBlock;
+  tcb->name = pcName ? pcName : "";
+  std::thread([tcb, pxTaskCode, pvParameters] {
+    current = tcb;
+    pthread_setname_np(pthread_self(), tcb->name.substr(0, 15).c_str());
+    pxTaskCode(pvParameters);
+  }).detach();
+  if (pxCreatedTask) {
+    *pxCreatedTask = tcb;
+  }
+  return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t xTaskToDelete) {
+  // Só a própria tarefa pode se encerrar aqui: a thread sai sem retornar
+  if (!xTaskToDelete || xTaskToDelete == current) {
+    pthread_exit(NULL);
+  }
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+  return current;
+}
+
+char *pcTaskGetName(TaskHandle_t xTaskToQuery) {
+  return const_cast<char *>((xTaskToQuery ? xTaskToQuery : current)->name.c_str());
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t xTask) {
+  (void)xTask;
+  return 0;
+}
+
+void vTaskSuspend(TaskHandle_t xTaskToSuspend) {
+  tskTaskControlBlock *tcb = xTaskToSuspend ? xTaskToSuspend : current;
+  std::unique_lock<std::mutex> guard(tcb->lock);
+  tcb->suspended = true;
+  if (tcb == current) {
+    tcb->cv.wait(guard, [tcb] { return !tcb->suspended; });
+  }
+}
+
+void vTaskResume(TaskHandle_t xTaskToResume) {
+  std::lock_guard<std::mutex> guard(xTaskToResume->lock);
+  xTaskToResume->suspended = false;
+  xTaskToResume->cv.notify_all();
+}
+
+BaseType_t xPortGetCoreID(void) {
+  return 0;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t uxQueueLength, UBaseType_t uxItemSize) {
+  QueueHandle_t q = new QueueDefinition;
+  q->item_size = uxItemSize;
+  q->capacity = uxQueueLength;
+  return q;
+}
+
+BaseType_t xQueueSend(QueueHandle_t xQueue, const void *pvItemToQueue, TickType_t xTicksToWait) {
+  return queue_send(xQueue, pvItemToQueue, xTicksToWait, false);
+}
+
+BaseType_t xQueueSendToBack(QueueHandle_t xQueue, const void *pvItemToQueue, TickType_t xTicksToWait) {
+  return queue_send(xQueue, pvItemToQueue, xTicksToWait, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t xQueue, const void *pvItemToQueue, TickType_t xTicksToWait) {
+  return queue_send(xQueue, pvItemToQueue, xTicksToWait, true);
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t xQueue, const void *pvItemToQueue) {
+  {
+    std::lock_guard<std::mutex> guard(xQueue->lock);
+    xQueue->items.clear();
+    xQueue->count = 0;
+  }
+  return queue_send(xQueue, pvItemToQueue, 0, false);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t xQueue, void *pvBuffer, TickType_t xTicksToWait) {
+  return queue_receive(xQueue, pvBuffer, xTicksToWait, true);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t xQueue, void *pvBuffer, TickType_t xTicksToWait) {
+  return queue_receive(xQueue, pvBuffer, xTicksToWait, false);
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t xQueue) {
+  std::lock_guard<std::mutex> guard(xQueue->lock);
+  return xQueue->count;
+}
+
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t xQueue) {
+  std::lock_guard<std::mutex> guard(xQueue->lock);
+  return xQueue->capacity - xQueue->count;
+}
+
+BaseType_t xQueueReset(QueueHandle_t xQueue) {
+  std::lock_guard<std::mutex> guard(xQueue->lock);
+  xQueue->items.clear();
+  xQueue->count = 0;
+  xQueue->changed.notify_all();
+  return pdPASS;
+}
+
+void vQueueDelete(QueueHandle_t xQueue) {
+  delete xQueue;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+  SemaphoreHandle_t s = xQueueCreate(1, 0);
+  s->count = 1;
+  return s;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void) {
+  return xQueueCreate(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t uxMaxCount, UBaseType_t uxInitialCount) {
+  SemaphoreHandle_t s = xQueueCreate(uxMaxCount, 0);
+  s->count = uxInitialCount;
+  return s;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t xSemaphore, TickType_t xBlockTime) {
+  return queue_receive(xSemaphore, NULL, xBlockTime, true);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t xSemaphore) {
+  return queue_send(xSemaphore, NULL, 0, false);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t xSemaphore) {
+  delete xSemaphore;
+}
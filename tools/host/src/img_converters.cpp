@@ -0,0 +1,251 @@
+// Conversões de esp32-camera (img_converters.h) feitas com libjpeg no host.
+// Os custos não são os do ESP32, mas o fluxo (decodificar, converter, copiar)
+// e as alocações são os mesmos do firmware.
+
+#include "img_converters.h"
+
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <jpeglib.h>
+#include <string.h>
+
+#include <vector>
+
+namespace {
+
+struct jpeg_error_jmp {
+  jpeg_error_mgr mgr;
+  jmp_buf jump;
+};
+
+void on_jpeg_error(j_common_ptr cinfo) {
+  longjmp(((jpeg_error_jmp *)cinfo->err)->jump, 1);
+}
+
+bool decode_rgb(const uint8_t *src, size_t len, uint8_t *rgb, size_t *width, size_t *height) {
+  jpeg_decompress_struct d;
+  jpeg_error_jmp err;
+  d.err = jpeg_std_error(&err.mgr);
+  err.mgr.error_exit = on_jpeg_error;
+  if (setjmp(err.jump)) {
+    jpeg_destroy_decompress(&d);
+    return false;
+  }
+  jpeg_create_decompress(&d);
+  jpeg_mem_src(&d, src, len);
+  jpeg_read_header(&d, TRUE);
+  d.out_color_space = JCS_RGB;
+  jpeg_start_decompress(&d);
+  if (width) {
+    *width = d.output_width;
+    *height = d.output_height;
+  }
+  if (rgb) {
+    while (d.output_scanline < d.output_height) {
+      JSAMPROW row = rgb + d.output_scanline * d.output_width * 3;
+      jpeg_read_scanlines(&d, &row, 1);
+    }
+  }
+  jpeg_abort_decompress(&d);
+  jpeg_destroy_decompress(&d);
+  return true;
+}
+
+// Converte qualquer formato suportado para RGB888 (ordem R, G, B)
+bool to_rgb(camera_fb_t *fb, std::vector<uint8_t> &rgb) {
+  size_t pixels = fb->width * fb->height;
+  rgb.resize(pixels * 3);
+  switch (fb->format) {
+    case PIXFORMAT_JPEG: return decode_rgb(fb->buf, fb->len, rgb.data(), NULL, NULL);
+    case PIXFORMAT_RGB888: memcpy(rgb.data(), fb->buf, pixels * 3); return true;
+    case PIXFORMAT_GRAYSCALE:
+      for (size_t i = 0; i < pixels; i++) {
+        rgb[i * 3] = rgb[i * 3 + 1] = rgb[i * 3 + 2] = fb->buf[i];
+      }
+      return true;
+    case PIXFORMAT_RGB565:
+      for (size_t i = 0; i < pixels; i++) {
+        uint16_t p = (fb->buf[i * 2] << 8) | fb->buf[i * 2 + 1];
+        rgb[i * 3] = (p >> 8) & 0xF8;
+        rgb[i * 3 + 1] = (p >> 3) & 0xFC;
+        rgb[i * 3 + 2] = (p << 3) & 0xF8;
+      }
+      return true;
+    default: return false;
+  }
+}
+
+struct cb_dest {
+  jpeg_destination_mgr mgr;
+  jpg_out_cb cb;
+  void *arg;
+  size_t index;
+  uint8_t buf[1024];
+};
+
+void cb_init(j_compress_ptr c) {
+  cb_dest *d = (cb_dest *)c->dest;
+  d->mgr.next_output_byte = d->buf;
+  d->mgr.free_in_buffer = sizeof(d->buf);
+}
+
+boolean cb_empty(j_compress_ptr c) {
+  cb_dest *d = (cb_dest *)c->dest;
+  if (d->cb(d->arg, d->index, d->buf, sizeof(d->buf)) != sizeof(d->buf)) {
+    c->err->error_exit((j_common_ptr)c);  // cliente desconectou
+  }
+  d->index += sizeof(d->buf);
+  cb_init(c);
+  return TRUE;
+}
+
+void cb_term(j_compress_ptr c) {
+  cb_dest *d = (cb_dest *)c->dest;
+  size_t n = sizeof(d->buf) - d->mgr.free_in_buffer;
+  if (n && d->cb(d->arg, d->index, d->buf, n) != n) {
+    c->err->error_exit((j_common_ptr)c);  // cliente desconectou
+  }
+  d->index += n;
+}
+
+// O RGB vem pronto do chamador: um longjmp de erro não pode pular destrutores
+void encode(camera_fb_t *fb, uint8_t quality, const std::vector<uint8_t> &rgb, jpeg_compress_struct &c) {
+  c.image_width = fb->width;
+  c.image_height = fb->height;
+  c.input_components = 3;
+  c.in_color_space = JCS_RGB;
+  jpeg_set_defaults(&c);
+  jpeg_set_quality(&c, quality, TRUE);
+  jpeg_start_compress(&c, TRUE);
+  while (c.next_scanline < c.image_height) {
+    JSAMPROW row = const_cast<uint8_t *>(&rgb[c.next_scanline * fb->width * 3]);
+    jpeg_write_scanlines(&c, &row, 1);
+  }
+  jpeg_finish_compress(&c);
+}
+
+}  // namespace
+
+bool frame2jpg_cb(camera_fb_t *fb, uint8_t quality, jpg_out_cb cb, void *arg) {
+  if (fb->format == PIXFORMAT_JPEG) {
+    return cb(arg, 0, fb->buf, fb->len) == fb->len;
+  }
+  std::vector<uint8_t> rgb;
+  if (!to_rgb(fb, rgb)) {
+    return false;
+  }
+  jpeg_compress_struct c;
+  jpeg_error_jmp err;
+  cb_dest dest;
+  c.err = jpeg_std_error(&err.mgr);
+  err.mgr.error_exit = on_jpeg_error;
+  if (setjmp(err.jump)) {
+    jpeg_destroy_compress(&c);
+    return false;
+  }
+  jpeg_create_compress(&c);
+  dest.mgr.init_destination = cb_init;
+  dest.mgr.empty_output_buffer = cb_empty;
+  dest.mgr.term_destination = cb_term;
+  dest.cb = cb;
+  dest.arg = arg;
+  dest.index = 0;
+  c.dest = &dest.mgr;
+  encode(fb, quality, rgb, c);
+  jpeg_destroy_compress(&c);
+  return true;
+}
+
+bool frame2jpg(camera_fb_t *fb, uint8_t quality, uint8_t **out, size_t *out_len) {
+  if (fb->format == PIXFORMAT_JPEG) {
+    *out = (uint8_t *)malloc(fb->len);
+    if (!*out) {
+      return false;
+    }
+    memcpy(*out, fb->buf, fb->len);
+    *out_len = fb->len;
+    return true;
+  }
+  std::vector<uint8_t> rgb;
+  if (!to_rgb(fb, rgb)) {
+    return false;
+  }
+  jpeg_compress_struct c;
+  jpeg_error_jmp err;
+  unsigned char *mem = NULL;
+  unsigned long mem_len = 0;
+  c.err = jpeg_std_error(&err.mgr);
+  err.mgr.error_exit = on_jpeg_error;
+  if (setjmp(err.jump)) {
+    jpeg_destroy_compress(&c);
+    free(mem);
+    return false;
+  }
+  jpeg_create_compress(&c);
+  jpeg_mem_dest(&c, &mem, &mem_len);
+  encode(fb, quality, rgb, c);
+  jpeg_destroy_compress(&c);
+  *out = mem;
+  *out_len = mem_len;
+  return true;
+}
+
+// BMP de 24 bits com altura negativa (linhas de cima para baixo), como o
+// conversor do esp32-camera
+bool frame2bmp(camera_fb_t *fb, uint8_t **out, size_t *out_len) {
+  std::vector<uint8_t> rgb;
+  if (!to_rgb(fb, rgb)) {
+    return false;
+  }
+  size_t pixels = fb->width * fb->height;
+  size_t len = 54 + pixels * 3;
+  uint8_t *bmp = (uint8_t *)malloc(len);
+  if (!bmp) {
+    return false;
+  }
+  memset(bmp, 0, 54);
+  auto put32 = [bmp](size_t at, uint32_t v) {
+    for (int i = 0; i < 4; i++) {
+      bmp[at + i] = v >> (8 * i);
+    }
+  };
+  bmp[0] = 'B';
+  bmp[1] = 'M';
+  put32(2, len);
+  put32(10, 54);
+  put32(14, 40);
+  put32(18, fb->width);
+  put32(22, (uint32_t)(-(int32_t)fb->height));
+  bmp[26] = 1;
+  bmp[28] = 24;
+  put32(34, pixels * 3);
+  for (size_t i = 0; i < pixels; i++) {
+    bmp[54 + i * 3] = rgb[i * 3 + 2];
+    bmp[54 + i * 3 + 1] = rgb[i * 3 + 1];
+    bmp[54 + i * 3 + 2] = rgb[i * 3];
+  }
+  *out = bmp;
+  *out_len = len;
+  return true;
+}
+
+// O esp32-camera devolve RGB888 em ordem B, G, R
+bool fmt2rgb888(const uint8_t *src_buf, size_t src_len, pixformat_t format, uint8_t *rgb_buf) {
+  if (format != PIXFORMAT_JPEG) {
+    return false;
+  }
+  size_t w, h;
+  if (!decode_rgb(src_buf, src_len, NULL, &w, &h)) {
+    return false;
+  }
+  if (!decode_rgb(src_buf, src_len, rgb_buf, NULL, NULL)) {
+    return false;
+  }
+  for (size_t i = 0; i < w * h; i++) {
+    uint8_t r = rgb_buf[i * 3];
+    rgb_buf[i * 3] = rgb_buf[i * 3 + 2];
+    rgb_buf[i * 3 + 2] = r;
+  }
+  return true;
+}
@@ -0,0 +1,223 @@
+// Preferences (NVS) do build de host: pares chave/valor por namespace, em
+// memória ou persistidos num arquivo texto reescrito a cada gravação, para
+// que um reboot do simulador encontre o que o firmware salvou.
+//
+// Formato do arquivo: uma linha por chave, "namespace<TAB>chave<TAB>hex".
+
+#include "Preferences.h"
+
+#include <stdio.h>
+
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "esp_host.h"
+
+namespace {
+
+typedef std::vector<uint8_t> Blob;
+
+struct Nvs {
+  std::mutex lock;
+  std::map<std::string, std::map<std::string, Blob>> data;
+  std::string path;
+  uint32_t writes = 0;
+};
+
+Nvs &nvs() {
+  static Nvs *n = new Nvs;
+  return *n;
+}
+
+// Chamado com a trava
+void persist() {
+  Nvs &n = nvs();
+  n.writes++;
+  if (n.path.empty()) {
+    return;
+  }
+  std::string tmp = n.path + ".tmp";
+  FILE *f = fopen(tmp.c_str(), "w");
+  if (!f) {
+    return;
+  }
+  for (const auto &ns : n.data) {
+    for (const auto &kv : ns.second) {
+      fprintf(f, "%s\t%s\t", ns.first.c_str(), kv.first.c_str());
+      for (uint8_t b : kv.second) {
+        fprintf(f, "%02x", b);
+      }
+      fputc('\n', f);
+    }
+  }
+  fclose(f);
+  rename(tmp.c_str(), n.path.c_str());
+}
+
+}  // namespace
+
+void esp_host_nvs_open(const char *path) {
+  Nvs &n = nvs();
+  std::lock_guard<std::mutex> guard(n.lock);
+  n.path = path ? path : "";
+  n.data.clear();
+  std::ifstream in(n.path);
+  std::string line;
+  while (std::getline(in, line)) {
+    std::istringstream fields(line);
+    std::string ns, key, hex;
+    if (!std::getline(fields, ns, '\t') || !std::getline(fields, key, '\t')) {
+      continue;
+    }
+    std::getline(fields, hex);
+    Blob value;
+    for (size_t i = 0; i + 1 < hex.size(); i += 2) {
+      value.push_back(strtoul(hex.substr(i, 2).c_str(), NULL, 16));
+    }
+    n.data[ns][key] = value;
+  }
+}
+
+void esp_host_nvs_set_string(const char *ns, const char *key, const char *value) {
+  Nvs &n = nvs();
+  std::lock_guard<std::mutex> guard(n.lock);
+  n.data[ns][key] = Blob(value, value + strlen(value));
+  persist();
+}
+
+uint32_t esp_host_nvs_writes(void) {
+  Nvs &n = nvs();
+  std::lock_guard<std::mutex> guard(n.lock);
+  return n.writes;
+}
+
+bool Preferences::begin(const char *name, bool readOnly, const char *partition_label) {
+  (void)readOnly;
+  (void)partition_label;
+  if (!name || strlen(name) > 15) {
+    return false;
+  }
+  ns_ = name;
+  open_ = true;
+  return true;
+}
+
+void Preferences::end() {
+  open_ = false;
+}
+
+bool Preferences::clear() {
+  if (!open_) {
+    return false;
+  }
+  Nvs &n = nvs();
+  std::lock_guard<std::mutex> guard(n.lock);
+  n.data.erase(ns_.std());
+  persist();
+  return true;
+}
+
+bool Preferences::remove(const char *key) {
+  if (!open_) {
+    return false;
+  }
+  Nvs &n = nvs();
+  std::lock_guard<std::mutex> guard(n.lock);
+  bool erased = n.data[ns_.std()].erase(key) > 0;
+  if (erased) {
+    persist();
+  }
+  return erased;
+}
+
+bool Preferences::isKey(const char *key) {
+  if (!open_) {
+    return false;
+  }
+  Nvs &n = nvs();
+  std::lock_guard<std::mutex> guard(n.lock);
+  auto ns = n.data.find(ns_.std());
+  return ns != n.data.end() && ns->second.count(key);
+}
+
+size_t Preferences::putBytes(const char *key, const void *value, size_t len) {
+  if (!open_ || !key || strlen(key) > 15) {
+    return 0;
+  }
+  Nvs &n = nvs();
+  std::lock_guard<std::mutex> guard(n.lock);
+  n.data[ns_.std()][key] = Blob((const uint8_t *)value, (const uint8_t *)value + len);
+  persist();
+  return len;
+}
+
+size_t Preferences::getBytesLength(const char *key) {
+  if (!open_) {
+    return 0;
+  }
+  Nvs &n = nvs();
+  std::lock_guard<std::mutex> guard(n.lock);
+  auto ns = n.data.find(ns_.std());
+  if (ns == n.data.end()) {
+    return 0;
+  }
+  auto it = ns->second.find(key);
+  return it == ns->second.end() ? 0 : it->second.size();
+}
+
+size_t Preferences::getBytes(const char *key, void *buf, size_t maxLen) {
+  if (!open_) {
+    return 0;
+  }
+  Nvs &n = nvs();
+  std::lock_guard<std::mutex> guard(n.lock);
+  auto ns = n.data.find(ns_.std());
+  if (ns == n.data.end()) {
+    return 0;
+  }
+  auto it = ns->second.find(key);
+  if (it == ns->second.end() || it->second.size() > maxLen) {
+    return 0;
+  }
+  memcpy(buf, it->second.data(), it->second.size());
+  return it->second.size();
+}
+
+size_t Preferences::putString(const char *key, const String &value) {
+  return putBytes(key, value.c_str(), value.length()) == value.length() ? value.length() : 0;
+}
+
+String Preferences::getString(const char *key, const String &defaultValue) {
+  size_t len = getBytesLength(key);
+  if (!len && !isKey(key)) {
+    return defaultValue;
+  }
+  std::string value(len, '\0');
+  getBytes(key, &value[0], len);
+  return String(value);
+}
+
+// Inteiros guardados com o tamanho do tipo; tamanho diferente = chave de
+// outro tipo, e o getter devolve o padrão como a NVS faria
+#define PREF_SCALAR(put, get, type)                                 \
+  size_t Preferences::put(const char *key, type value) {            \
+    return putBytes(key, &value, sizeof(value));                    \
+  }                                                                 \
+  type Preferences::get(const char *key, type defaultValue) {       \
+    type value;                                                     \
+    if (getBytesLength(key) != sizeof(value) || !getBytes(key, &value, sizeof(value))) { \
+      return defaultValue;                                          \
+    }                                                               \
+    return value;                                                   \
+  }
+
+PREF_SCALAR(putBool, getBool, bool)
+PREF_SCALAR(putUChar, getUChar, uint8_t)
+PREF_SCALAR(putUShort, getUShort, uint16_t)
+PREF_SCALAR(putInt, getInt, int32_t)
+PREF_SCALAR(putUInt, getUInt, uint32_t)
+#undef PREF_SCALAR
@@ -0,0 +1,331 @@
+// WebServer e DNSServer do core Arduino sobre sockets (build de host). Como no
+// ESP32, nada roda sozinho: handleClient() e processNextRequest() atendem no
+// máximo uma requisição por chamada, na tarefa de quem chama (a do portal).
+
+// Os cabeçalhos do Arduino vêm antes dos de rede: <netinet/in.h> define a
+// macro INADDR_NONE, que quebraria a declaração do IPAddress
+#include "DNSServer.h"
+#include "WebServer.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "esp_host.h"
+
+namespace {
+
+int listen_on(int type, uint16_t port) {
+  int fd = socket(AF_INET, type, 0);
+  int one = 1;
+  setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(esp_host_port(port));
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (bind(fd, (sockaddr *)&addr, sizeof(addr)) != 0 || (type == SOCK_STREAM && listen(fd, 4) != 0)) {
+    log_e("Cannot bind port %u: %s", esp_host_port(port), strerror(errno));
+    close(fd);
+    return -1;
+  }
+  fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  return fd;
+}
+
+std::string url_decode(const std::string &in) {
+  std::string out;
+  for (size_t i = 0; i < in.size(); i++) {
+    if (in[i] == '+') {
+      out += ' ';
+    } else if (in[i] == '%' && i + 2 < in.size()) {
+      out += (char)strtoul(in.substr(i + 1, 2).c_str(), NULL, 16);
+      i += 2;
+    } else {
+      out += in[i];
+    }
+  }
+  return out;
+}
+
+void parse_form(const std::string &query, std::map<std::string, std::string> &args) {
+  size_t start = 0;
+  while (start < query.size()) {
+    size_t amp = query.find('&', start);
+    if (amp == std::string::npos) {
+      amp = query.size();
+    }
+    std::string pair = query.substr(start, amp - start);
+    size_t eq = pair.find('=');
+    if (!pair.empty()) {
+      args[url_decode(pair.substr(0, eq))] = eq == std::string::npos ? "" : url_decode(pair.substr(eq + 1));
+    }
+    start = amp + 1;
+  }
+}
+
+const char *reason(int code) {
+  switch (code) {
+    case 200: return "OK";
+    case 204: return "No Content";
+    case 302: return "Found";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 500: return "Internal Server Error";
+    default: return "";
+  }
+}
+
+}  // namespace
+
+WebServer::WebServer(int port) : port_(port) {}
+
+WebServer::~WebServer() {
+  stop();
+}
+
+void WebServer::begin() {
+  if (listen_fd_ < 0) {
+    listen_fd_ = listen_on(SOCK_STREAM, port_);
+  }
+}
+
+void WebServer::stop() {
+  if (client_fd_ >= 0) {
+    close(client_fd_);
+    client_fd_ = -1;
+  }
+  if (listen_fd_ >= 0) {
+    close(listen_fd_);
+    listen_fd_ = -1;
+  }
+}
+
+void WebServer::on(const String &uri, THandlerFunction handler) {
+  on(uri, HTTP_ANY, handler);
+}
+
+void WebServer::on(const String &uri, HTTPMethod method, THandlerFunction fn) {
+  routes_.push_back({uri, method, fn});
+}
+
+void WebServer::onNotFound(THandlerFunction fn) {
+  not_found_ = fn;
+}
+
+void WebServer::collectHeaders(const char *headerKeys[], const size_t headerKeysCount) {
+  collect_.assign(headerKeys, headerKeys + headerKeysCount);
+}
+
+void WebServer::handleClient() {
+  if (listen_fd_ < 0) {
+    return;
+  }
+  int fd = accept(listen_fd_, NULL, NULL);
+  if (fd < 0) {
+    return;
+  }
+  timeval tv = {2, 0};
+  setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+  std::string raw;
+  size_t head_end;
+  char buf[2048];
+  while ((head_end = raw.find("\r\n\r\n")) == std::string::npos) {
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if (n <= 0 || raw.size() > 16384) {
+      close(fd);
+      return;
+    }
+    raw.append(buf, n);
+  }
+
+  args_.clear();
+  headers_.clear();
+  resp_headers_.clear();
+  std::string line = raw.substr(0, raw.find("\r\n"));
+  size_t sp1 = line.find(' '), sp2 = line.rfind(' ');
+  std::string verb = line.substr(0, sp1);
+  std::string target = sp2 > sp1 ? line.substr(sp1 + 1, sp2 - sp1 - 1) : "/";
+  method_ = verb == "POST" ? HTTP_POST : verb == "PUT" ? HTTP_PUT : verb == "DELETE" ? HTTP_DELETE : verb == "HEAD" ? HTTP_HEAD : HTTP_GET;
+  size_t q = target.find('?');
+  uri_ = String(target.substr(0, q));
+  if (q != std::string::npos) {
+    parse_form(target.substr(q + 1), args_);
+  }
+
+  size_t content_length = 0;
+  for (size_t pos = raw.find("\r\n") + 2; pos < head_end;) {
+    size_t eol = raw.find("\r\n", pos);
+    std::string h = raw.substr(pos, eol - pos);
+    pos = eol + 2;
+    size_t colon = h.find(':');
+    if (colon == std::string::npos) {
+      continue;
+    }
+    std::string key = h.substr(0, colon);
+    size_t v = h.find_first_not_of(' ', colon + 1);
+    std::string value = v == std::string::npos ? "" : h.substr(v);
+    if (!strcasecmp(key.c_str(), "Content-Length")) {
+      content_length = strtoul(value.c_str(), NULL, 10);
+    }
+    for (const std::string &c : collect_) {
+      if (!strcasecmp(c.c_str(), key.c_str())) {
+        headers_[c] = value;
+      }
+    }
+  }
+  std::string body = raw.substr(head_end + 4);
+  while (body.size() < content_length) {
+    ssize_t n = recv(fd, buf, sizeof(buf), 0);
+    if (n <= 0) {
+      break;
+    }
+    body.append(buf, n);
+  }
+  if (method_ == HTTP_POST && !body.empty()) {
+    parse_form(body, args_);
+  }
+
+  client_fd_ = fd;
+  bool handled = false;
+  for (const Route &r : routes_) {
+    if (r.uri == uri_ && (r.method == HTTP_ANY || r.method == method_)) {
+      r.fn();
+      handled = true;
+      break;
+    }
+  }
+  if (!handled) {
+    if (not_found_) {
+      not_found_();
+    } else {
+      send(404, "text/plain", "Not found: " + uri_);
+    }
+  }
+  if (client_fd_ >= 0) {
+    close(client_fd_);
+    client_fd_ = -1;
+  }
+}
+
+String WebServer::arg(const String &name) {
+  auto it = args_.find(name.std());
+  return it == args_.end() ? String() : String(it->second);
+}
+
+bool WebServer::hasArg(const String &name) {
+  return args_.count(name.std()) > 0;
+}
+
+String WebServer::header(const String &name) {
+  for (const auto &h : headers_) {
+    if (!strcasecmp(h.first.c_str(), name.c_str())) {
+      return String(h.second);
+    }
+  }
+  return String();
+}
+
+bool WebServer::hasHeader(const String &name) {
+  return header(name).length() > 0;
+}
+
+void WebServer::sendHeader(const String &name, const String &value, bool first) {
+  if (first) {
+    resp_headers_.insert(resp_headers_.begin(), {name.std(), value.std()});
+  } else {
+    resp_headers_.push_back({name.std(), value.std()});
+  }
+}
+
+void WebServer::send_P(int code, const char *content_type, const char *content, size_t contentLength) {
+  if (client_fd_ < 0) {
+    return;
+  }
+  std::string head = "HTTP/1.1 " + std::to_string(code) + " " + reason(code) + "\r\n";
+  if (content_type) {
+    head += std::string("Content-Type: ") + content_type + "\r\n";
+  }
+  for (const auto &h : resp_headers_) {
+    head += h.first + ": " + h.second + "\r\n";
+  }
+  head += "Content-Length: " + std::to_string(contentLength) + "\r\nConnection: close\r\n\r\n";
+  ::send(client_fd_, head.data(), head.size(), MSG_NOSIGNAL);
+  if (contentLength) {
+    ::send(client_fd_, content, contentLength, MSG_NOSIGNAL);
+  }
+  resp_headers_.clear();
+  // A resposta já saiu: o cliente não precisa esperar o handler terminar
+  shutdown(client_fd_, SHUT_WR);
+}
+
+void WebServer::send(int code, const char *content_type, const String &content) {
+  send_P(code, content_type, content.c_str(), content.length());
+}
+
+// ---- DNSServer: responde a qualquer consulta A com o IP do portal ----
+
+DNSServer::DNSServer() {}
+
+DNSServer::~DNSServer() {
+  stop();
+}
+
+bool DNSServer::start(const uint16_t port, const String &domainName, const IPAddress &resolvedIP) {
+  (void)domainName;  // o firmware usa "*"
+  stop();
+  ip_ = resolvedIP;
+  fd_ = listen_on(SOCK_DGRAM, port);
+  return fd_ >= 0;
+}
+
+void DNSServer::stop() {
+  if (fd_ >= 0) {
+    close(fd_);
+    fd_ = -1;
+  }
+}
+
+void DNSServer::processNextRequest() {
+  if (fd_ < 0) {
+    return;
+  }
+  uint8_t pkt[512];
+  sockaddr_in from;
+  socklen_t from_len = sizeof(from);
+  ssize_t n = recvfrom(fd_, pkt, sizeof(pkt), 0, (sockaddr *)&from, &from_len);
+  // Só consultas padrão (QR=0, OPCODE=0) com uma pergunta
+  if (n < 12 || (pkt[2] & 0xF8) != 0 || pkt[4] != 0 || pkt[5] != 1) {
+    return;
+  }
+  size_t q = 12;
+  while (q < (size_t)n && pkt[q]) {
+    q += pkt[q] + 1;
+  }
+  if (q + 5 > (size_t)n) {
+    return;
+  }
+  uint16_t qtype = (pkt[q + 1] << 8) | pkt[q + 2];
+  size_t qend = q + 5;
+  uint8_t resp[512 + 16];
+  memcpy(resp, pkt, qend);
+  resp[2] = 0x80 | (pkt[2] & 0x01);  // QR, RD copiado
+  resp[3] = 0x80;                    // RA, NOERROR
+  resp[6] = 0;
+  resp[7] = qtype == 1 ? 1 : 0;
+  memset(resp + 8, 0, 4);
+  size_t len = qend;
+  if (qtype == 1) {
+    const uint8_t answer[] = {0xC0, 0x0C, 0, 1, 0, 1, 0, 0, 0, 60, 0, 4, ip_[0], ip_[1], ip_[2], ip_[3]};
+    memcpy(resp + len, answer, sizeof(answer));
+    len += sizeof(answer);
+  }
+  sendto(fd_, resp, len, 0, (sockaddr *)&from, from_len);
+}
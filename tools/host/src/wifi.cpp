@@ -0,0 +1,711 @@
+// WiFi simulado (build de host). Os APs e seus eventos (queda, volta, troca
+// de rede do DHCP) vêm do script do simulador via esp_host.h; a conexão passa
+// pelas mesmas etapas e eventos do core Arduino: varredura, autenticação,
+// STA_CONNECTED, DHCP e STA_GOT_IP, com reconexão automática.
+//
+// Sem cabeçalhos de rede aqui: o INADDR_NONE do IPAddress colide com a macro
+// de <netinet/in.h>.
+
+#include "WiFi.h"
+
+#include <pthread.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "esp_host.h"
+
+WiFiClass WiFi;
+
+namespace {
+
+struct SimAp {
+  std::string ssid;
+  std::string password;
+  uint8_t bssid[6];
+  uint8_t channel;
+  int8_t rssi;
+  IPAddress gateway;
+  IPAddress subnet;
+  bool up = true;
+};
+
+struct Listener {
+  wifi_event_id_t id;
+  arduino_event_id_t filter;
+  WiFiEventCb cb;
+  WiFiEventFuncCb fn;
+};
+
+struct Event {
+  arduino_event_id_t id;
+  arduino_event_info_t info;
+};
+
+struct State {
+  std::mutex lock;
+  std::vector<SimAp> aps;
+  wifi_mode_t mode = WIFI_OFF;
+  wl_status_t status = WL_IDLE_STATUS;
+  bool auto_reconnect = true;
+  uint64_t generation = 0;  // muda a cada begin/disconnect: cancela a tentativa anterior
+
+  std::string sta_ssid;
+  std::string sta_pass;
+  int current = -1;  // AP associado
+  IPAddress ip, gateway, subnet, dns[2];
+  bool static_ip = false;
+  IPAddress static_local, static_gateway, static_subnet, static_dns[2];
+
+  bool ap_active = false;
+  IPAddress ap_ip = IPAddress(192, 168, 4, 1);
+
+  int16_t scan_status = WIFI_SCAN_FAILED;  // WIFI_SCAN_RUNNING ou número de redes
+  uint64_t scan_generation = 0;           // scanDelete() descarta a varredura em curso
+  std::vector<SimAp> scan_results;
+
+  uint32_t scan_ms = 1500;
+  uint32_t auth_ms = 250;
+  uint32_t dhcp_ms = 400;
+  uint32_t beacon_timeout_ms = 3000;
+
+  std::vector<Listener> listeners;
+  wifi_event_id_t next_listener = 1;
+
+  std::mutex events_lock;
+  std::condition_variable events_cv;
+  std::deque<Event> events;
+  bool events_started = false;
+};
+
+State &st() {
+  static State *s = new State;
+  return *s;
+}
+
+// Tarefa "sys_evt" do core: os callbacks rodam fora das travas do WiFi
+void event_task() {
+  pthread_setname_np(pthread_self(), "sys_evt");
+  State &s = st();
+  for (;;) {
+    Event ev;
+    {
+      std::unique_lock<std::mutex> guard(s.events_lock);
+      s.events_cv.wait(guard, [&s] { return !s.events.empty(); });
+      ev = s.events.front();
+      s.events.pop_front();
+    }
+    std::vector<Listener> listeners;
+    {
+      std::lock_guard<std::mutex> guard(s.lock);
+      listeners = s.listeners;
+    }
+    for (const Listener &l : listeners) {
+      if (l.filter != ARDUINO_EVENT_MAX && l.filter != ev.id) {
+        continue;
+      }
+      if (l.cb) {
+        l.cb(ev.id);
+      } else if (l.fn) {
+        l.fn(ev.id, ev.info);
+      }
+    }
+  }
+}
+
+// Chamado com s.lock
+void post(arduino_event_id_t id, const arduino_event_info_t &info = arduino_event_info_t()) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.events_lock);
+  if (!s.events_started) {
+    s.events_started = true;
+    std::thread(event_task).detach();
+  }
+  s.events.push_back({id, info});
+  s.events_cv.notify_one();
+}
+
+void post_disconnected(const std::string &ssid, const uint8_t *bssid, uint8_t reason) {
+  arduino_event_info_t info = {};
+  auto &d = info.wifi_sta_disconnected;
+  d.ssid_len = std::min<size_t>(ssid.size(), 32);
+  memcpy(d.ssid, ssid.data(), d.ssid_len);
+  if (bssid) {
+    memcpy(d.bssid, bssid, 6);
+  }
+  d.reason = reason;
+  post(ARDUINO_EVENT_WIFI_STA_DISCONNECTED, info);
+}
+
+int find_ap(const std::string &ssid) {
+  State &s = st();
+  for (size_t i = 0; i < s.aps.size(); i++) {
+    if (s.aps[i].ssid == ssid) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+IPAddress parse_ip(const char *text, IPAddress fallback) {
+  IPAddress ip;
+  return text && ip.fromString(text) ? ip : fallback;
+}
+
+// Dorme sem a trava; false se a tentativa foi cancelada nesse meio tempo
+bool sleep_checked(std::unique_lock<std::mutex> &guard, uint32_t ms, uint64_t generation) {
+  guard.unlock();
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  guard.lock();
+  return st().generation == generation;
+}
+
+// Uma tentativa de conexão, repetida enquanto houver reconexão automática
+void connect_task(uint64_t generation, int channel, std::vector<uint8_t> bssid) {
+  pthread_setname_np(pthread_self(), "wifi");
+  State &s = st();
+  std::unique_lock<std::mutex> guard(s.lock);
+  for (;;) {
+    if (s.generation != generation) {
+      return;
+    }
+    int idx = find_ap(s.sta_ssid);
+    // Canal e BSSID conhecidos pulam a varredura. Com o canal dado e o AP
+    // fora dele, o driver varre só esse canal (1 de 13) antes de desistir.
+    auto matches = [&](int i) {
+      return i >= 0 && s.aps[i].up && (channel <= 0 || s.aps[i].channel == channel) &&
+             (bssid.size() != 6 || memcmp(s.aps[i].bssid, bssid.data(), 6) == 0);
+    };
+    bool direct = channel > 0 && bssid.size() == 6 && matches(idx);
+    uint32_t scan_ms = channel > 0 ? std::max<uint32_t>(s.scan_ms / 13, 50) : std::max<uint32_t>(s.scan_ms, 100);
+    if (!direct && !sleep_checked(guard, scan_ms, generation)) {
+      return;
+    }
+    idx = find_ap(s.sta_ssid);
+    uint8_t reason = 0;
+    if (!matches(idx)) {
+      s.status = WL_NO_SSID_AVAIL;
+      reason = 201;  // WIFI_REASON_NO_AP_FOUND
+    } else {
+      if (!sleep_checked(guard, s.auth_ms, generation)) {
+        return;
+      }
+      if (!s.aps[idx].up) {
+        s.status = WL_NO_SSID_AVAIL;
+        reason = 201;
+      } else if (s.aps[idx].password != s.sta_pass) {
+        s.status = WL_CONNECT_FAILED;
+        reason = 15;  // WIFI_REASON_4WAY_HANDSHAKE_TIMEOUT
+      }
+    }
+    if (reason) {
+      post_disconnected(s.sta_ssid, NULL, reason);
+      if (!s.auto_reconnect) {
+        return;
+      }
+      channel = 0;
+      bssid.clear();
+      continue;
+    }
+
+    SimAp &ap = s.aps[idx];
+    s.current = idx;
+    arduino_event_info_t info = {};
+    auto &c = info.wifi_sta_connected;
+    c.ssid_len = std::min<size_t>(ap.ssid.size(), 32);
+    memcpy(c.ssid, ap.ssid.data(), c.ssid_len);
+    memcpy(c.bssid, ap.bssid, 6);
+    c.channel = ap.channel;
+    post(ARDUINO_EVENT_WIFI_STA_CONNECTED, info);
+
+    if (s.static_ip) {
+      s.ip = s.static_local;
+      s.gateway = s.static_gateway;
+      s.subnet = s.static_subnet;
+      s.dns[0] = s.static_dns[0];
+      s.dns[1] = s.static_dns[1];
+    } else {
+      if (!sleep_checked(guard, s.dhcp_ms, generation)) {
+        return;
+      }
+      SimAp &lease = s.aps[idx];
+      for (int i = 0; i < 4; i++) {
+        s.ip[i] = lease.gateway[i] & lease.subnet[i];
+      }
+      s.ip[3] |= 100;
+      s.gateway = lease.gateway;
+      s.subnet = lease.subnet;
+      s.dns[0] = lease.gateway;
+      s.dns[1] = IPAddress();
+    }
+    s.status = WL_CONNECTED;
+    info = arduino_event_info_t();
+    info.got_ip.ip_info.ip.addr = (uint32_t)s.ip;
+    info.got_ip.ip_info.gw.addr = (uint32_t)s.gateway;
+    info.got_ip.ip_info.netmask.addr = (uint32_t)s.subnet;
+    post(ARDUINO_EVENT_WIFI_STA_GOT_IP, info);
+    return;
+  }
+}
+
+// Chamado com s.lock
+void start_connect(int channel, const uint8_t *bssid) {
+  State &s = st();
+  s.generation++;
+  s.current = -1;
+  s.status = WL_DISCONNECTED;
+  std::vector<uint8_t> b;
+  if (bssid) {
+    b.assign(bssid, bssid + 6);
+  }
+  std::thread(connect_task, s.generation, channel, b).detach();
+}
+
+// Queda do AP: a estação só percebe depois do timeout de beacon
+void beacon_watch(uint64_t generation, int idx) {
+  pthread_setname_np(pthread_self(), "wifi");
+  State &s = st();
+  std::unique_lock<std::mutex> guard(s.lock);
+  if (!sleep_checked(guard, s.beacon_timeout_ms, generation) || s.current != idx || s.aps[idx].up) {
+    return;
+  }
+  s.status = WL_CONNECTION_LOST;
+  s.current = -1;
+  s.ip = IPAddress();
+  post_disconnected(s.aps[idx].ssid, s.aps[idx].bssid, 200);  // WIFI_REASON_BEACON_TIMEOUT
+  if (s.auto_reconnect) {
+    start_connect(0, NULL);
+    s.status = WL_CONNECTION_LOST;
+  }
+}
+
+// Varredura de todos os canais; o resultado é o que estava no ar ao final
+void scan_task(uint64_t generation) {
+  pthread_setname_np(pthread_self(), "wifi");
+  State &s = st();
+  std::unique_lock<std::mutex> guard(s.lock);
+  uint32_t scan_ms = std::max<uint32_t>(s.scan_ms, 100);
+  guard.unlock();
+  std::this_thread::sleep_for(std::chrono::milliseconds(scan_ms));
+  guard.lock();
+  if (s.scan_generation != generation) {
+    return;
+  }
+  s.scan_results.clear();
+  for (const SimAp &ap : s.aps) {
+    if (ap.up) {
+      s.scan_results.push_back(ap);
+    }
+  }
+  s.scan_status = s.scan_results.size();
+  arduino_event_info_t info = {};
+  info.wifi_scan_done.number = s.scan_results.size();
+  post(ARDUINO_EVENT_WIFI_SCAN_DONE, info);
+}
+
+}  // namespace
+
+// ---- Controle pelo simulador ----
+
+void esp_host_wifi_add_ap(const char *ssid, const char *password, uint8_t channel, int8_t rssi, const char *gateway,
+                          const char *subnet) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  SimAp ap;
+  ap.ssid = ssid;
+  ap.password = password ? password : "";
+  ap.channel = channel ? channel : 1;
+  ap.rssi = rssi;
+  ap.gateway = parse_ip(gateway, IPAddress(192, 168, 15, 1));
+  ap.subnet = parse_ip(subnet, IPAddress(255, 255, 255, 0));
+  uint32_t h = 2166136261u;
+  for (char c : ap.ssid) {
+    h = (h ^ (uint8_t)c) * 16777619u;
+  }
+  uint8_t bssid[6] = {0x02, 0x00, 0x5e, (uint8_t)(h >> 16), (uint8_t)(h >> 8), (uint8_t)h};
+  memcpy(ap.bssid, bssid, 6);
+  int idx = find_ap(ap.ssid);
+  if (idx >= 0) {
+    s.aps[idx] = ap;
+  } else {
+    s.aps.push_back(ap);
+  }
+}
+
+void esp_host_wifi_set_ap_up(const char *ssid, bool up) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  int idx = find_ap(ssid);
+  if (idx < 0 || s.aps[idx].up == up) {
+    return;
+  }
+  s.aps[idx].up = up;
+  if (!up && s.current == idx) {
+    std::thread(beacon_watch, s.generation, idx).detach();
+  }
+}
+
+void esp_host_wifi_set_ap_network(const char *ssid, const char *gateway, const char *subnet) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  int idx = find_ap(ssid);
+  if (idx >= 0) {
+    s.aps[idx].gateway = parse_ip(gateway, s.aps[idx].gateway);
+    s.aps[idx].subnet = parse_ip(subnet, s.aps[idx].subnet);
+  }
+}
+
+void esp_host_wifi_set_timing(uint32_t scan_ms, uint32_t auth_ms, uint32_t dhcp_ms, uint32_t beacon_timeout_ms) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  s.scan_ms = scan_ms;
+  s.auth_ms = auth_ms;
+  s.dhcp_ms = dhcp_ms;
+  s.beacon_timeout_ms = beacon_timeout_ms;
+}
+
+uint32_t esp_host_wifi_sta_reachable_ip(void) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  if (s.status != WL_CONNECTED || s.current < 0) {
+    return 0;
+  }
+  const SimAp &ap = s.aps[s.current];
+  for (int i = 0; i < 4; i++) {
+    if ((s.ip[i] & ap.subnet[i]) != (ap.gateway[i] & ap.subnet[i])) {
+      return 0;
+    }
+  }
+  return (uint32_t)s.ip;
+}
+
+bool esp_host_wifi_softap_active(void) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  return s.ap_active;
+}
+
+// ---- API do Arduino ----
+
+bool WiFiClass::mode(wifi_mode_t m) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  wifi_mode_t old = s.mode;
+  s.mode = m;
+  bool had_sta = old & WIFI_STA, has_sta = m & WIFI_STA;
+  if (had_sta && !has_sta) {
+    s.generation++;
+    s.current = -1;
+    s.status = WL_DISCONNECTED;
+    post(ARDUINO_EVENT_WIFI_STA_STOP);
+  } else if (!had_sta && has_sta) {
+    post(ARDUINO_EVENT_WIFI_STA_START);
+  }
+  if ((old & WIFI_AP) && !(m & WIFI_AP) && s.ap_active) {
+    s.ap_active = false;
+    post(ARDUINO_EVENT_WIFI_AP_STOP);
+  }
+  return true;
+}
+
+wifi_mode_t WiFiClass::getMode() {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  return s.mode;
+}
+
+wl_status_t WiFiClass::begin(const char *ssid, const char *passphrase, int32_t channel, const uint8_t *bssid, bool connect) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  if (!(s.mode & WIFI_STA)) {
+    s.mode = (wifi_mode_t)(s.mode | WIFI_STA);
+    post(ARDUINO_EVENT_WIFI_STA_START);
+  }
+  s.sta_ssid = ssid ? ssid : "";
+  s.sta_pass = passphrase ? passphrase : "";
+  if (connect) {
+    start_connect(channel, bssid);
+  }
+  return s.status;
+}
+
+bool WiFiClass::config(IPAddress local_ip, IPAddress gateway, IPAddress subnet, IPAddress dns1, IPAddress dns2) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  s.static_ip = (uint32_t)local_ip != 0;
+  s.static_local = local_ip;
+  s.static_gateway = gateway;
+  s.static_subnet = subnet;
+  s.static_dns[0] = dns1;
+  s.static_dns[1] = dns2;
+  if (s.static_ip && s.status == WL_CONNECTED) {
+    s.ip = local_ip;
+    s.gateway = gateway;
+    s.subnet = subnet;
+    s.dns[0] = dns1;
+    s.dns[1] = dns2;
+    arduino_event_info_t info = {};
+    info.got_ip.ip_info.ip.addr = (uint32_t)s.ip;
+    info.got_ip.ip_info.gw.addr = (uint32_t)s.gateway;
+    info.got_ip.ip_info.netmask.addr = (uint32_t)s.subnet;
+    info.got_ip.ip_changed = true;
+    post(ARDUINO_EVENT_WIFI_STA_GOT_IP, info);
+  }
+  return true;
+}
+
+bool WiFiClass::disconnect(bool wifioff, bool eraseap) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  s.generation++;
+  if (s.current >= 0) {
+    post_disconnected(s.aps[s.current].ssid, s.aps[s.current].bssid, 8);  // WIFI_REASON_ASSOC_LEAVE
+  }
+  s.current = -1;
+  s.ip = IPAddress();
+  s.status = WL_DISCONNECTED;
+  if (eraseap) {
+    s.sta_ssid.clear();
+    s.sta_pass.clear();
+  }
+  if (wifioff && (s.mode & WIFI_STA)) {
+    s.mode = (wifi_mode_t)(s.mode & ~WIFI_STA);
+    post(ARDUINO_EVENT_WIFI_STA_STOP);
+  }
+  return true;
+}
+
+bool WiFiClass::reconnect() {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  if (s.sta_ssid.empty()) {
+    return false;
+  }
+  start_connect(0, NULL);
+  return true;
+}
+
+wl_status_t WiFiClass::status() {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  return s.status;
+}
+
+bool WiFiClass::setAutoReconnect(bool autoReconnect) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  s.auto_reconnect = autoReconnect;
+  return true;
+}
+
+bool WiFiClass::getAutoReconnect() {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  return s.auto_reconnect;
+}
+
+IPAddress WiFiClass::localIP() {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  return s.status == WL_CONNECTED ? s.ip : IPAddress();
+}
+
+IPAddress WiFiClass::gatewayIP() {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  return s.status == WL_CONNECTED ? s.gateway : IPAddress();
+}
+
+IPAddress WiFiClass::subnetMask() {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  return s.status == WL_CONNECTED ? s.subnet : IPAddress();
+}
+
+IPAddress WiFiClass::dnsIP(uint8_t n) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  return n < 2 ? s.dns[n] : IPAddress();
+}
+
+String WiFiClass::SSID() {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  return s.current >= 0 ? String(s.aps[s.current].ssid) : String();
+}
+
+uint8_t *WiFiClass::BSSID() {
+  static uint8_t bssid[6];
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  if (s.current < 0) {
+    return NULL;
+  }
+  memcpy(bssid, s.aps[s.current].bssid, 6);
+  return bssid;
+}
+
+int32_t WiFiClass::channel() {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  return s.current >= 0 ? s.aps[s.current].channel : 0;
+}
+
+int8_t WiFiClass::RSSI() {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  return s.current >= 0 ? s.aps[s.current].rssi : 0;
+}
+
+bool WiFiClass::softAP(const char *ssid, const char *passphrase, int channel, int ssid_hidden, int max_connection) {
+  (void)ssid;
+  (void)passphrase;
+  (void)channel;
+  (void)ssid_hidden;
+  (void)max_connection;
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  s.mode = (wifi_mode_t)(s.mode | WIFI_AP);
+  if (!s.ap_active) {
+    s.ap_active = true;
+    post(ARDUINO_EVENT_WIFI_AP_START);
+  }
+  return true;
+}
+
+bool WiFiClass::softAPConfig(IPAddress local_ip, IPAddress gateway, IPAddress subnet) {
+  (void)gateway;
+  (void)subnet;
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  s.ap_ip = local_ip;
+  return true;
+}
+
+bool WiFiClass::softAPdisconnect(bool wifioff) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  if (s.ap_active) {
+    s.ap_active = false;
+    post(ARDUINO_EVENT_WIFI_AP_STOP);
+  }
+  if (wifioff) {
+    s.mode = (wifi_mode_t)(s.mode & ~WIFI_AP);
+  }
+  return true;
+}
+
+IPAddress WiFiClass::softAPIP() {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  return s.ap_active ? s.ap_ip : IPAddress();
+}
+
+int16_t WiFiClass::scanNetworks(bool async, bool show_hidden, bool passive, uint32_t max_ms_per_chan, uint8_t channel,
+                                const char *ssid, const uint8_t *bssid) {
+  (void)show_hidden;
+  (void)passive;
+  (void)max_ms_per_chan;
+  (void)channel;
+  (void)ssid;
+  (void)bssid;
+  uint64_t generation;
+  {
+    State &s = st();
+    std::lock_guard<std::mutex> guard(s.lock);
+    if (s.scan_status == WIFI_SCAN_RUNNING) {
+      return WIFI_SCAN_RUNNING;
+    }
+    if (!(s.mode & WIFI_STA)) {
+      s.mode = (wifi_mode_t)(s.mode | WIFI_STA);
+      post(ARDUINO_EVENT_WIFI_STA_START);
+    }
+    s.scan_status = WIFI_SCAN_RUNNING;
+    s.scan_results.clear();
+    generation = ++s.scan_generation;
+  }
+  if (async) {
+    std::thread(scan_task, generation).detach();
+    return WIFI_SCAN_RUNNING;
+  }
+  scan_task(generation);
+  return scanComplete();
+}
+
+int16_t WiFiClass::scanComplete() {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  return s.scan_status;
+}
+
+void WiFiClass::scanDelete() {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  s.scan_generation++;
+  s.scan_results.clear();
+  s.scan_status = WIFI_SCAN_FAILED;
+}
+
+String WiFiClass::SSID(uint8_t networkItem) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  return networkItem < s.scan_results.size() ? String(s.scan_results[networkItem].ssid) : String();
+}
+
+wifi_auth_mode_t WiFiClass::encryptionType(uint8_t networkItem) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  if (networkItem >= s.scan_results.size()) {
+    return WIFI_AUTH_OPEN;
+  }
+  return s.scan_results[networkItem].password.empty() ? WIFI_AUTH_OPEN : WIFI_AUTH_WPA2_PSK;
+}
+
+int32_t WiFiClass::RSSI(uint8_t networkItem) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  return networkItem < s.scan_results.size() ? s.scan_results[networkItem].rssi : 0;
+}
+
+uint8_t *WiFiClass::BSSID(uint8_t networkItem) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  return networkItem < s.scan_results.size() ? s.scan_results[networkItem].bssid : NULL;
+}
+
+int32_t WiFiClass::channel(uint8_t networkItem) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  return networkItem < s.scan_results.size() ? s.scan_results[networkItem].channel : 0;
+}
+
+wifi_event_id_t WiFiClass::onEvent(WiFiEventCb cbEvent, arduino_event_id_t event) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  s.listeners.push_back({s.next_listener, event, cbEvent, nullptr});
+  return s.next_listener++;
+}
+
+wifi_event_id_t WiFiClass::onEvent(WiFiEventFuncCb cbEvent, arduino_event_id_t event) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  s.listeners.push_back({s.next_listener, event, nullptr, cbEvent});
+  return s.next_listener++;
+}
+
+void WiFiClass::removeEvent(wifi_event_id_t id) {
+  State &s = st();
+  std::lock_guard<std::mutex> guard(s.lock);
+  for (auto it = s.listeners.begin(); it != s.listeners.end(); ++it) {
+    if (it->id == id) {
+      s.listeners.erase(it);
+      return;
+    }
+  }
+}
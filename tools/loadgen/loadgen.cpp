@@ -0,0 +1,473 @@
+// Gerador de carga do servidor da câmera: N sessões /stream simultâneas e
+// tráfego de fundo em /capture, /status e /control, contra o simulador
+// (tools/firmware_sim) ou uma placa real.
+//
+//   loadgen --scenario arquivo.load [--target host] [--port-offset N]
+//           [--duration N] [--report saida.json]
+//
+// Cenário (uma diretiva por linha, '#' comenta; tempos em s ou ms):
+//
+//   target 127.0.0.1            # padrão; --target sobrepõe
+//   port_offset 8000            # 80/81 viram 8080/8081; 0 para a placa
+//   duration 20s
+//   stream 3 ramp=500ms         # sessões /stream, abertas a cada 500 ms
+//   capture every=2s
+//   status every=500ms
+//   control every=3s var=quality val=10,12,14
+//   expect stream_fps_min > 10
+//   expect jitter_p99 < 150ms
+//
+// Por sessão: quadros/s, intervalo entre quadros (p50/p95/p99), jitter (a
+// diferença entre intervalos consecutivos, como no RFC 3550), latência pelo
+// X-Timestamp e erros. Se o relógio da placa não estiver sincronizado com o
+// do host (sem SNTP), a latência vira relativa: o menor atraso visto conta
+// como zero. Por tipo de requisição de fundo: contagem, erros e tempo de
+// resposta. Sai com 0 se todas as expectativas passaram.
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "http_client.h"
+
+namespace {
+
+struct Background {
+  std::string kind;  // capture, status, control
+  int64_t every_ms = 1000;
+  std::string var;
+  std::vector<std::string> values;
+};
+
+struct Expectation {
+  std::string metric;
+  std::string op;
+  double value;
+  std::string text;
+};
+
+struct Scenario {
+  std::string target = "127.0.0.1";
+  int port_offset = 8000;
+  int64_t duration_ms = 20000;
+  int streams = 1;
+  int64_t ramp_ms = 0;
+  std::vector<Background> background;
+  std::vector<Expectation> expects;
+};
+
+struct StreamStats {
+  uint64_t frames = 0;
+  uint64_t bytes = 0;
+  uint64_t errors = 0;
+  int64_t first_frame_us = -1;  // desde o início da sessão
+  int64_t active_us = 0;        // tempo com a sessão recebendo
+  std::vector<int64_t> interval_us;
+  std::vector<int64_t> jitter_us;
+  std::vector<int64_t> delay_us;  // recepção - X-Timestamp, sem correção
+};
+
+struct RequestStats {
+  uint64_t count = 0;
+  uint64_t errors = 0;
+  std::vector<int64_t> latency_us;
+};
+
+Scenario scenario;
+std::atomic<bool> stopping{false};
+
+int64_t mono_us() {
+  return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+bool parse_duration_ms(const std::string &text, int64_t *out) {
+  char *end;
+  double v = strtod(text.c_str(), &end);
+  std::string unit = end;
+  if (end == text.c_str()) {
+    return false;
+  }
+  if (unit == "ms") {
+    *out = v;
+  } else if (unit == "s" || unit.empty()) {
+    *out = v * 1000;
+  } else if (unit == "min") {
+    *out = v * 60000;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+std::map<std::string, std::string> key_values(const std::vector<std::string> &words, size_t from) {
+  std::map<std::string, std::string> kv;
+  for (size_t i = from; i < words.size(); i++) {
+    size_t eq = words[i].find('=');
+    if (eq != std::string::npos) {
+      kv[words[i].substr(0, eq)] = words[i].substr(eq + 1);
+    }
+  }
+  return kv;
+}
+
+bool load_scenario(const std::string &path) {
+  std::ifstream in(path);
+  if (!in) {
+    fprintf(stderr, "loadgen: não abriu %s\n", path.c_str());
+    return false;
+  }
+  std::string line;
+  int lineno = 0;
+  while (std::getline(in, line)) {
+    lineno++;
+    line = line.substr(0, line.find('#'));
+    std::istringstream ss(line);
+    std::vector<std::string> w;
+    std::string word;
+    while (ss >> word) {
+      w.push_back(word);
+    }
+    if (w.empty()) {
+      continue;
+    }
+    bool ok = true;
+    if (w[0] == "target" && w.size() == 2) {
+      scenario.target = w[1];
+    } else if (w[0] == "port_offset" && w.size() == 2) {
+      scenario.port_offset = atoi(w[1].c_str());
+    } else if (w[0] == "duration" && w.size() == 2) {
+      ok = parse_duration_ms(w[1], &scenario.duration_ms);
+    } else if (w[0] == "stream" && w.size() >= 2) {
+      scenario.streams = atoi(w[1].c_str());
+      auto kv = key_values(w, 2);
+      ok = !kv.count("ramp") || parse_duration_ms(kv["ramp"], &scenario.ramp_ms);
+    } else if ((w[0] == "capture" || w[0] == "status" || w[0] == "control") && w.size() >= 2) {
+      Background b;
+      b.kind = w[0];
+      auto kv = key_values(w, 1);
+      ok = parse_duration_ms(kv["every"], &b.every_ms) && b.every_ms > 0;
+      if (b.kind == "control") {
+        b.var = kv["var"];
+        std::stringstream vals(kv["val"]);
+        std::string v;
+        while (std::getline(vals, v, ',')) {
+          b.values.push_back(v);
+        }
+        ok = ok && !b.var.empty() && !b.values.empty();
+      }
+      scenario.background.push_back(b);
+    } else if (w[0] == "expect" && w.size() == 4) {
+      Expectation e;
+      e.metric = w[1];
+      e.op = w[2];
+      e.text = w[1] + " " + w[2] + " " + w[3];
+      int64_t ms = 0;
+      bool is_time = w[3].find_first_not_of("0123456789.") != std::string::npos;
+      ok = is_time ? parse_duration_ms(w[3], &ms) : true;
+      e.value = is_time ? ms : atof(w[3].c_str());
+      scenario.expects.push_back(e);
+    } else {
+      ok = false;
+    }
+    if (!ok) {
+      fprintf(stderr, "%s:%d: diretiva inválida: %s\n", path.c_str(), lineno, line.c_str());
+      return false;
+    }
+  }
+  return true;
+}
+
+void sleep_until_or_stop(int64_t deadline_us) {
+  while (!stopping && mono_us() < deadline_us) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(std::min<int64_t>(50, (deadline_us - mono_us()) / 1000 + 1)));
+  }
+}
+
+// Uma sessão de visualização: reabre o /stream se cair, até o fim do teste
+void stream_session(int id, StreamStats *st) {
+  int64_t started = mono_us();
+  uint16_t port = 81 + scenario.port_offset;
+  while (!stopping) {
+    int fd = http::connect_tcp(scenario.target, port, 5000);
+    if (fd < 0) {
+      st->errors++;
+      sleep_until_or_stop(mono_us() + 1000000);
+      continue;
+    }
+    http::Reader rd(fd);
+    int status = 0;
+    std::map<std::string, std::string> headers;
+    if (!http::send_request(fd, "GET", "/stream", scenario.target) || !rd.read_headers(&status, &headers) || status != 200) {
+      st->errors++;
+      close(fd);
+      sleep_until_or_stop(mono_us() + 1000000);
+      continue;
+    }
+    http::MultipartReader parts(&rd);
+    http::Part part;
+    const char *data;
+    int64_t last = -1, last_interval = -1;
+    while (!stopping && parts.next(&part, &data)) {
+      int64_t now = mono_us();
+      if (st->first_frame_us < 0) {
+        st->first_frame_us = now - started;
+      }
+      st->frames++;
+      st->bytes += part.len;
+      if (last >= 0) {
+        int64_t interval = now - last;
+        st->active_us += interval;
+        st->interval_us.push_back(interval);
+        if (last_interval >= 0) {
+          st->jitter_us.push_back(std::abs(interval - last_interval));
+        }
+        last_interval = interval;
+      }
+      last = now;
+      if (part.timestamp_us) {
+        st->delay_us.push_back(http::wall_us() - part.timestamp_us);
+      }
+    }
+    if (!stopping) {
+      st->errors++;
+      fprintf(stderr, "loadgen: sessão %d: /stream encerrado pela placa\n", id);
+    }
+    close(fd);
+  }
+}
+
+void background_loop(const Background &b, RequestStats *st) {
+  uint16_t port = 80 + scenario.port_offset;
+  size_t next_value = 0;
+  int64_t due = mono_us();
+  while (!stopping) {
+    std::string path = "/" + b.kind;
+    if (b.kind == "control") {
+      path += "?var=" + b.var + "&val=" + b.values[next_value++ % b.values.size()];
+    }
+    int64_t start = mono_us();
+    int fd = http::connect_tcp(scenario.target, port, 5000);
+    int status = -1;
+    if (fd >= 0) {
+      http::Reader rd(fd);
+      std::map<std::string, std::string> headers;
+      if (http::send_request(fd, "GET", path, scenario.target) && rd.read_headers(&status, &headers)) {
+        rd.read_body();
+      } else {
+        status = -1;
+      }
+      close(fd);
+    }
+    st->count++;
+    if (status == 200) {
+      st->latency_us.push_back(mono_us() - start);
+    } else {
+      st->errors++;
+    }
+    due += b.every_ms * 1000;
+    sleep_until_or_stop(due);
+  }
+}
+
+int64_t percentile(std::vector<int64_t> v, double p) {
+  if (v.empty()) {
+    return -1;
+  }
+  std::sort(v.begin(), v.end());
+  size_t i = std::min(v.size() - 1, (size_t)(p * (v.size() - 1) + 0.5));
+  return v[i];
+}
+
+double ms(int64_t us) {
+  return us < 0 ? -1 : us / 1000.0;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::string scenario_path, target, report_path;
+  int port_offset = -1;
+  int64_t duration_ms = 0;
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    auto next = [&]() -> const char * {
+      if (i + 1 >= argc) {
+        fprintf(stderr, "uso: loadgen --scenario arquivo [--target host] [--port-offset N] [--duration N] [--report saida.json]\n");
+        exit(2);
+      }
+      return argv[++i];
+    };
+    if (a == "--scenario") {
+      scenario_path = next();
+    } else if (a == "--target") {
+      target = next();
+    } else if (a == "--port-offset") {
+      port_offset = atoi(next());
+    } else if (a == "--duration") {
+      parse_duration_ms(next(), &duration_ms);
+    } else if (a == "--report") {
+      report_path = next();
+    } else {
+      fprintf(stderr, "loadgen: opção desconhecida %s\n", a.c_str());
+      return 2;
+    }
+  }
+  if (!scenario_path.empty() && !load_scenario(scenario_path)) {
+    return 2;
+  }
+  if (!target.empty()) {
+    scenario.target = target;
+  }
+  if (port_offset >= 0) {
+    scenario.port_offset = port_offset;
+  }
+  if (duration_ms > 0) {
+    scenario.duration_ms = duration_ms;
+  }
+
+  fprintf(stderr, "loadgen: %s (portas %d/%d), %d sessões /stream, %zu tipos de fundo, %.1f s\n", scenario.target.c_str(),
+          80 + scenario.port_offset, 81 + scenario.port_offset, scenario.streams, scenario.background.size(), scenario.duration_ms / 1e3);
+
+  std::vector<StreamStats> streams(scenario.streams);
+  std::vector<RequestStats> requests(scenario.background.size());
+  std::vector<std::thread> threads;
+  int64_t start = mono_us();
+  for (size_t i = 0; i < scenario.background.size(); i++) {
+    threads.emplace_back(background_loop, std::cref(scenario.background[i]), &requests[i]);
+  }
+  for (int i = 0; i < scenario.streams; i++) {
+    sleep_until_or_stop(start + i * scenario.ramp_ms * 1000);
+    threads.emplace_back(stream_session, i, &streams[i]);
+  }
+  sleep_until_or_stop(start + scenario.duration_ms * 1000);
+  stopping = true;
+  // Sessões presas num recv saem pelo timeout do socket
+  for (auto &t : threads) {
+    t.join();
+  }
+  double seconds = (mono_us() - start) / 1e6;
+
+  // Relógio da placa fora de sincronia: latência relativa ao menor atraso
+  std::vector<int64_t> all_delays;
+  for (const StreamStats &s : streams) {
+    all_delays.insert(all_delays.end(), s.delay_us.begin(), s.delay_us.end());
+  }
+  int64_t min_delay = all_delays.empty() ? 0 : *std::min_element(all_delays.begin(), all_delays.end());
+  bool synced = !all_delays.empty() && std::abs(percentile(all_delays, 0.5)) < 10 * 1000000LL;
+  std::vector<int64_t> latencies;
+  for (int64_t d : all_delays) {
+    latencies.push_back(synced ? d : d - min_delay);
+  }
+
+  std::map<std::string, double> m;
+  printf("\n== loadgen %s  (%.1f s)\n", scenario_path.c_str(), seconds);
+  printf("  %-8s %7s %7s %8s %9s %9s %9s %9s %9s %6s\n", "sessão", "quadros", "fps", "1º (ms)", "int p50", "int p99", "jit p95", "jit p99",
+         "lat p95", "erros");
+  double fps_min = -1, fps_sum = 0;
+  int64_t jitter_p95 = -1, jitter_p99 = -1, interval_p99 = -1;
+  uint64_t errors = 0, frames = 0;
+  for (size_t i = 0; i < streams.size(); i++) {
+    const StreamStats &s = streams[i];
+    double fps = s.frames / seconds;
+    std::vector<int64_t> lat;
+    for (int64_t d : s.delay_us) {
+      lat.push_back(synced ? d : d - min_delay);
+    }
+    printf("  %-8zu %7llu %7.2f %8.0f %9.1f %9.1f %9.1f %9.1f %9.1f %6llu\n", i, (unsigned long long)s.frames, fps, ms(s.first_frame_us),
+           ms(percentile(s.interval_us, 0.5)), ms(percentile(s.interval_us, 0.99)), ms(percentile(s.jitter_us, 0.95)),
+           ms(percentile(s.jitter_us, 0.99)), ms(percentile(lat, 0.95)), (unsigned long long)s.errors);
+    fps_min = fps_min < 0 ? fps : std::min(fps_min, fps);
+    fps_sum += fps;
+    jitter_p95 = std::max(jitter_p95, percentile(s.jitter_us, 0.95));
+    jitter_p99 = std::max(jitter_p99, percentile(s.jitter_us, 0.99));
+    interval_p99 = std::max(interval_p99, percentile(s.interval_us, 0.99));
+    errors += s.errors;
+    frames += s.frames;
+  }
+  printf("  latência %s\n", synced ? "absoluta (relógios sincronizados)" : "relativa ao menor atraso (relógio da placa sem SNTP)");
+  m["streams"] = streams.size();
+  m["frames"] = frames;
+  m["stream_fps_min"] = std::max(fps_min, 0.0);
+  m["stream_fps_avg"] = streams.empty() ? 0 : fps_sum / streams.size();
+  m["stream_errors"] = errors;
+  m["interval_p99"] = ms(interval_p99);
+  m["jitter_p95"] = ms(jitter_p95);
+  m["jitter_p99"] = ms(jitter_p99);
+  m["latency_p50"] = ms(percentile(latencies, 0.5));
+  m["latency_p95"] = ms(percentile(latencies, 0.95));
+  m["latency_p99"] = ms(percentile(latencies, 0.99));
+
+  if (!requests.empty()) {
+    printf("  %-8s %7s %7s %9s %9s %9s\n", "fundo", "pedidos", "erros", "p50 ms", "p95 ms", "p99 ms");
+  }
+  uint64_t total_errors = errors;
+  for (size_t i = 0; i < requests.size(); i++) {
+    const RequestStats &r = requests[i];
+    const std::string &k = scenario.background[i].kind;
+    printf("  %-8s %7llu %7llu %9.1f %9.1f %9.1f\n", k.c_str(), (unsigned long long)r.count, (unsigned long long)r.errors,
+           ms(percentile(r.latency_us, 0.5)), ms(percentile(r.latency_us, 0.95)), ms(percentile(r.latency_us, 0.99)));
+    m[k + "_count"] += r.count;
+    m[k + "_errors"] += r.errors;
+    m[k + "_p95"] = ms(percentile(r.latency_us, 0.95));
+    m[k + "_p99"] = ms(percentile(r.latency_us, 0.99));
+    total_errors += r.errors;
+  }
+  m["errors"] = total_errors;
+
+  bool all_ok = true;
+  std::vector<bool> results;
+  for (const Expectation &e : scenario.expects) {
+    auto it = m.find(e.metric);
+    bool ok = false;
+    if (it != m.end() && it->second >= 0) {
+      double v = it->second;
+      ok = (e.op == "<" && v < e.value) || (e.op == "<=" && v <= e.value) || (e.op == ">" && v > e.value) || (e.op == ">=" && v >= e.value) ||
+           (e.op == "==" && v == e.value);
+    }
+    results.push_back(ok);
+    all_ok = all_ok && ok;
+    printf("  %s  expect %s (obtido %s)\n", ok ? "ok  " : "FAIL", e.text.c_str(),
+           it == m.end() ? "n/a" : std::to_string(it->second).c_str());
+  }
+
+  if (!report_path.empty()) {
+    FILE *f = fopen(report_path.c_str(), "w");
+    if (f) {
+      fprintf(f, "{\"scenario\":\"%s\",\"target\":\"%s\",\"seconds\":%.3f,\"latency_synced\":%s,\"metrics\":{", scenario_path.c_str(),
+              scenario.target.c_str(), seconds, synced ? "true" : "false");
+      bool first = true;
+      for (const auto &kv : m) {
+        fprintf(f, "%s\"%s\":%.3f", first ? "" : ",", kv.first.c_str(), kv.second);
+        first = false;
+      }
+      fprintf(f, "},\"streams\":[");
+      for (size_t i = 0; i < streams.size(); i++) {
+        const StreamStats &s = streams[i];
+        fprintf(f, "%s{\"frames\":%llu,\"fps\":%.3f,\"first_frame_ms\":%.1f,\"interval_p50_ms\":%.3f,\"interval_p99_ms\":%.3f,"
+                   "\"jitter_p95_ms\":%.3f,\"jitter_p99_ms\":%.3f,\"errors\":%llu}",
+                i ? "," : "", (unsigned long long)s.frames, s.frames / seconds, ms(s.first_frame_us), ms(percentile(s.interval_us, 0.5)),
+                ms(percentile(s.interval_us, 0.99)), ms(percentile(s.jitter_us, 0.95)), ms(percentile(s.jitter_us, 0.99)),
+                (unsigned long long)s.errors);
+      }
+      fprintf(f, "],\"expectations\":[");
+      for (size_t i = 0; i < scenario.expects.size(); i++) {
+        fprintf(f, "%s{\"expect\":\"%s\",\"ok\":%s}", i ? "," : "", scenario.expects[i].text.c_str(), results[i] ? "true" : "false");
+      }
+      fprintf(f, "]}\n");
+      fclose(f);
+    }
+  }
+  return all_ok ? 0 : 1;
+}
@@ -0,0 +1,245 @@
+// Monta, confere e lista o arquivo de páginas gravado na partição "fr"
+// (formato em CameraWebServer/webfs.h).
+//
+//   mkwebfs pack [-o webfs.bin] [--max bytes] [dir]   (padrão: CameraWebServer/web)
+//   mkwebfs check [--max bytes] webfs.bin
+//   mkwebfs list webfs.bin
+//
+// Cada página é comprimida com gzip (nível 9, sem data no cabeçalho, então
+// o resultado é reprodutível) e recebe um ETag derivado dos bytes gravados.
+// Gravação: esptool.py write_flash 0x3d0000 webfs.bin, ou
+// curl --data-binary @webfs.bin http://<ip>/webfs com a câmera rodando.
+
+#include <dirent.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "webfs.h"
+
+namespace {
+
+// Tamanho da partição "fr" em CameraWebServer/partitions.csv
+const size_t kDefaultMax = 0x20000;
+
+struct Page {
+  std::string name;
+  const char *content_type;
+  std::vector<uint8_t> gz;
+};
+
+const char *content_type_for(const std::string &name) {
+  static const struct {
+    const char *ext;
+    const char *type;
+  } kTypes[] = {
+    {".html", "text/html"},        {".css", "text/css"},        {".js", "application/javascript"},
+    {".json", "application/json"}, {".svg", "image/svg+xml"},   {".ico", "image/x-icon"},
+    {".png", "image/png"},
+  };
+  size_t dot = name.rfind('.');
+  if (dot == std::string::npos) {
+    return nullptr;
+  }
+  for (const auto &t : kTypes) {
+    if (name.compare(dot, std::string::npos, t.ext) == 0) {
+      return t.type;
+    }
+  }
+  return nullptr;
+}
+
+bool read_file(const std::string &path, std::vector<uint8_t> &out) {
+  FILE *f = fopen(path.c_str(), "rb");
+  if (!f) {
+    return false;
+  }
+  uint8_t buf[4096];
+  size_t n;
+  out.clear();
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) {
+    out.insert(out.end(), buf, buf + n);
+  }
+  fclose(f);
+  return true;
+}
+
+bool gzip(const std::vector<uint8_t> &in, std::vector<uint8_t> &out) {
+  z_stream zs;
+  memset(&zs, 0, sizeof(zs));
+  // 15 + 16 = janela de 32 KB com cabeçalho gzip (mtime = 0)
+  if (deflateInit2(&zs, 9, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY) != Z_OK) {
+    return false;
+  }
+  out.resize(deflateBound(&zs, in.size()) + 32);
+  zs.next_in = const_cast<Bytef *>(in.data());
+  zs.avail_in = in.size();
+  zs.next_out = out.data();
+  zs.avail_out = out.size();
+  int rc = deflate(&zs, Z_FINISH);
+  out.resize(zs.total_out);
+  deflateEnd(&zs);
+  return rc == Z_STREAM_END;
+}
+
+std::string etag_for(const std::vector<uint8_t> &data) {
+  uint64_t h = 0xcbf29ce484222325ULL;
+  for (uint8_t b : data) {
+    h = (h ^ b) * 0x100000001b3ULL;
+  }
+  char buf[WEBFS_ETAG_LEN];
+  snprintf(buf, sizeof(buf), "\"%016llx\"", (unsigned long long)h);
+  return buf;
+}
+
+int pack(const std::string &dir, const std::string &out_path, size_t max) {
+  DIR *d = opendir(dir.c_str());
+  if (!d) {
+    fprintf(stderr, "mkwebfs: não foi possível abrir %s\n", dir.c_str());
+    return 1;
+  }
+  std::vector<Page> pages;
+  while (dirent *de = readdir(d)) {
+    std::string name = de->d_name;
+    const char *type = content_type_for(name);
+    if (!type) {
+      continue;
+    }
+    if (name.size() >= WEBFS_NAME_LEN || strlen(type) >= WEBFS_TYPE_LEN) {
+      fprintf(stderr, "mkwebfs: nome longo demais: %s\n", name.c_str());
+      closedir(d);
+      return 1;
+    }
+    std::vector<uint8_t> raw;
+    Page p{name, type, {}};
+    if (!read_file(dir + "/" + name, raw) || !gzip(raw, p.gz)) {
+      fprintf(stderr, "mkwebfs: falha ao ler/comprimir %s\n", name.c_str());
+      closedir(d);
+      return 1;
+    }
+    pages.push_back(std::move(p));
+  }
+  closedir(d);
+  std::sort(pages.begin(), pages.end(), [](const Page &a, const Page &b) { return a.name < b.name; });
+  if (pages.empty() || pages.size() > WEBFS_MAX_ENTRIES) {
+    fprintf(stderr, "mkwebfs: %zu páginas (1 a %d)\n", pages.size(), WEBFS_MAX_ENTRIES);
+    return 1;
+  }
+
+  // O formato é little endian, igual ao ESP32 e ao x86 do host
+  size_t offset = sizeof(webfs_header_t) + pages.size() * sizeof(webfs_entry_t);
+  std::vector<webfs_entry_t> entries(pages.size());
+  std::vector<uint8_t> image(offset, 0);
+  for (size_t i = 0; i < pages.size(); i++) {
+    webfs_entry_t &e = entries[i];
+    memset(&e, 0, sizeof(e));
+    strncpy(e.name, pages[i].name.c_str(), WEBFS_NAME_LEN - 1);
+    strncpy(e.content_type, pages[i].content_type, WEBFS_TYPE_LEN - 1);
+    strncpy(e.etag, etag_for(pages[i].gz).c_str(), WEBFS_ETAG_LEN - 1);
+    e.offset = image.size();
+    e.len = pages[i].gz.size();
+    e.flags = WEBFS_FLAG_GZIP;
+    image.insert(image.end(), pages[i].gz.begin(), pages[i].gz.end());
+    image.resize((image.size() + 3) & ~(size_t)3, 0);
+  }
+  memcpy(image.data() + sizeof(webfs_header_t), entries.data(), entries.size() * sizeof(webfs_entry_t));
+
+  webfs_header_t h;
+  memcpy(h.magic, WEBFS_MAGIC, 4);
+  h.version = WEBFS_VERSION;
+  h.count = pages.size();
+  h.size = image.size();
+  h.crc32 = webfs_crc32(0, image.data() + sizeof(h), image.size() - sizeof(h));
+  memcpy(image.data(), &h, sizeof(h));
+
+  for (const auto &e : entries) {
+    printf("%-22s %7u B gzip  ETag %s\n", e.name, e.len, e.etag);
+  }
+  printf("total %zu de %zu bytes\n", image.size(), max);
+  if (image.size() > max) {
+    fprintf(stderr, "mkwebfs: arquivo não cabe na partição\n");
+    return 1;
+  }
+  FILE *f = fopen(out_path.c_str(), "wb");
+  if (!f || fwrite(image.data(), 1, image.size(), f) != image.size()) {
+    fprintf(stderr, "mkwebfs: falha ao gravar %s\n", out_path.c_str());
+    if (f) {
+      fclose(f);
+    }
+    return 1;
+  }
+  fclose(f);
+  return 0;
+}
+
+int check(const std::string &path, size_t max, bool list) {
+  std::vector<uint8_t> image;
+  if (!read_file(path, image)) {
+    fprintf(stderr, "mkwebfs: não foi possível ler %s\n", path.c_str());
+    return 1;
+  }
+  const char *err = webfs_validate(image.data(), image.size());
+  if (err) {
+    fprintf(stderr, "mkwebfs: %s: %s\n", path.c_str(), err);
+    return 1;
+  }
+  const webfs_header_t *h = (const webfs_header_t *)image.data();
+  if (h->size > max) {
+    fprintf(stderr, "mkwebfs: %u bytes não cabem na partição (%zu)\n", h->size, max);
+    return 1;
+  }
+  if (list) {
+    const webfs_entry_t *e = webfs_entries(image.data());
+    for (int i = 0; i < h->count; i++) {
+      printf("%-22s %-24s %7u B  ETag %s\n", e[i].name, e[i].content_type, e[i].len, e[i].etag);
+    }
+  }
+  printf("%s: %d páginas, %u bytes, CRC %08x ok\n", path.c_str(), h->count, h->size, h->crc32);
+  return 0;
+}
+
+void usage() {
+  fprintf(stderr,
+          "uso: mkwebfs pack [-o webfs.bin] [--max bytes] [dir]\n"
+          "     mkwebfs check [--max bytes] webfs.bin\n"
+          "     mkwebfs list webfs.bin\n");
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    usage();
+    return 2;
+  }
+  std::string mode = argv[1];
+  std::string out = "webfs.bin";
+  std::string path;
+  size_t max = kDefaultMax;
+  for (int i = 2; i < argc; i++) {
+    std::string a = argv[i];
+    if (a == "-o" && i + 1 < argc) {
+      out = argv[++i];
+    } else if (a == "--max" && i + 1 < argc) {
+      max = strtoul(argv[++i], nullptr, 0);
+    } else if (a[0] == '-') {
+      usage();
+      return 2;
+    } else {
+      path = a;
+    }
+  }
+  if (mode == "pack") {
+    return pack(path.empty() ? std::string(FIRMWARE_DIR "/web") : path, out, max);
+  }
+  if ((mode == "check" || mode == "list") && !path.empty()) {
+    return check(path, max, mode == "list");
+  }
+  usage();
+  return 2;
+}
@@ -0,0 +1,188 @@
+// Cliente de referência do servidor RTSP (RTP/JPEG, RFC 2435), para conferir
+// o firmware sem ffmpeg por perto.
+//
+//   rtsp_client [--tcp | --multicast] [-n quadros] [-o dir] rtsp://host[:porta]/mjpeg
+//   rtsp_client [-n quadros] [-o dir] [--iface ip] --listen grupo:porta
+//   rtsp_client [--packet N] --roundtrip a.jpg b.jpg ...
+//
+// No modo de rede cada quadro sai com o tamanho, o timestamp RTP e o atraso
+// da captura até a chegada, pelo relógio de parede do último RTCP SR (só faz
+// sentido com os relógios sincronizados, ou no mesmo host); no fim, os
+// quadros e pacotes perdidos. Com --listen o cliente só entra no grupo
+// multicast, sem RTSP: recebe enquanto outro espectador mantém o grupo. No modo
+// --roundtrip cada JPEG passa pelo remetente e pelo receptor do firmware em
+// pacotes de até N bytes e o scan remontado é conferido byte a byte com o
+// original.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "jpeg_mcu.h"
+#include "rtp_jpeg.h"
+#include "rtsp_client.h"
+
+namespace {
+
+void usage() {
+  fprintf(stderr,
+          "uso: rtsp_client [--tcp | --multicast] [-n quadros] [-o dir] rtsp://host[:porta]/mjpeg\n"
+          "     rtsp_client [-n quadros] [-o dir] [--iface ip] --listen grupo:porta\n"
+          "     rtsp_client [--packet N] --roundtrip a.jpg b.jpg ...\n");
+}
+
+bool write_file(const std::string &path, const uint8_t *data, size_t len) {
+  FILE *f = fopen(path.c_str(), "wb");
+  if (!f) {
+    return false;
+  }
+  bool ok = fwrite(data, 1, len, f) == len;
+  return fclose(f) == 0 && ok;
+}
+
+// Scan sem o EOI final (o que o RTP/JPEG transporta)
+std::string scan_of(const jpeg_info_t &info) {
+  size_t len = info.scan_len;
+  while (len >= 2 && !(info.scan[len - 2] == 0xFF && info.scan[len - 1] == 0xD9)) {
+    len--;
+  }
+  return std::string((const char *)info.scan, len >= 2 ? len - 2 : info.scan_len);
+}
+
+struct Collector {
+  rtp_jpeg_receiver_t *receiver;
+  size_t jpeg_len = 0;
+  int packets = 0;
+};
+
+bool collect(void *ctx, const uint8_t *packet, size_t len) {
+  Collector *c = (Collector *)ctx;
+  c->packets++;
+  size_t n = rtp_jpeg_receive(c->receiver, packet, len);
+  if (n) {
+    c->jpeg_len = n;
+  }
+  return true;
+}
+
+int run_roundtrip(const std::vector<const char *> &files, size_t max_packet, const std::string &outdir) {
+  std::vector<uint8_t> buf(max_packet), out(512 * 1024);
+  rtp_jpeg_sender_t sender;
+  rtp_jpeg_receiver_t receiver;
+  rtp_jpeg_sender_init(&sender, 0x1234, 0);
+  rtp_jpeg_receiver_init(&receiver, out.data(), out.size());
+  int failures = 0;
+  uint32_t timestamp = 0;
+
+  for (const char *file : files) {
+    std::ifstream in(file, std::ios::binary);
+    std::vector<uint8_t> jpeg((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    Collector c;
+    c.receiver = &receiver;
+    int packets = rtp_jpeg_send_frame(&sender, jpeg.data(), jpeg.size(), timestamp += 3000, buf.data(), buf.size(), collect, &c);
+    jpeg_info_t a, b;
+    const char *problem = NULL;
+    if (packets < 0) {
+      problem = "JPEG não suportado pelo RFC 2435";
+    } else if (!c.jpeg_len || !jpeg_parse_header(out.data(), c.jpeg_len, &b)) {
+      problem = "quadro não remontado";
+    } else if (!jpeg_parse_header(jpeg.data(), jpeg.size(), &a) || a.width != b.width || a.height != b.height) {
+      problem = "dimensões diferentes";
+    } else if (scan_of(a) != scan_of(b)) {
+      problem = "scan diferente";
+    }
+    printf("%s: %zu B em %d pacotes -> %zu B%s%s\n", file, jpeg.size(), packets, c.jpeg_len, problem ? ": " : "", problem ? problem : "");
+    failures += problem != NULL;
+    if (!outdir.empty() && c.jpeg_len) {
+      std::string name = file;
+      name = name.substr(name.find_last_of('/') + 1);
+      write_file(outdir + "/" + name, out.data(), c.jpeg_len);
+    }
+  }
+  return failures ? 1 : 0;
+}
+
+int run_stream(const std::string &url, rtsp::Transport transport, const std::string &listen, const std::string &iface, int count,
+               const std::string &outdir) {
+  rtsp::Client client;
+  std::string error;
+  bool ok = listen.empty() ? client.open(url, transport, &error)
+                           : client.listen(listen.substr(0, listen.find(':')), atoi(listen.substr(listen.find(':') + 1).c_str()), iface, &error);
+  if (!ok) {
+    fprintf(stderr, "%s: %s\n", listen.empty() ? url.c_str() : listen.c_str(), error.c_str());
+    return 1;
+  }
+  rtsp::Frame frame;
+  int n = 0;
+  while ((count <= 0 || n < count) && client.next_frame(&frame, 5000)) {
+    char latency[32] = "sem SR";
+    if (frame.wall_us) {
+      snprintf(latency, sizeof(latency), "%.1f ms", (frame.received_us - frame.wall_us) / 1000.0);
+    }
+    printf("quadro %d: %zu B ts=%u atraso %s\n", n, frame.len, frame.timestamp, latency);
+    if (!outdir.empty()) {
+      char name[32];
+      snprintf(name, sizeof(name), "/%06d.jpg", n);
+      write_file(outdir + name, frame.jpeg, frame.len);
+    }
+    n++;
+  }
+  client.teardown();
+  const rtsp::Stats &s = client.stats();
+  printf("%u quadros, %u perdidos, %u pacotes (%u perdidos), %u inválidos, %u SR (%u incoerentes)\n", s.frames, s.lost, s.packets,
+         s.packets_lost, s.errors, s.sender_reports, s.bad_reports);
+  return n > 0 && !s.bad_reports ? 0 : 1;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  std::string outdir, url, listen, iface = "0.0.0.0";
+  rtsp::Transport transport = rtsp::kUdp;
+  bool roundtrip = false;
+  int count = 0;
+  size_t max_packet = 1400;
+  std::vector<const char *> files;
+
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    bool has_value = i + 1 < argc;
+    if (a == "--tcp") {
+      transport = rtsp::kTcp;
+    } else if (a == "--multicast") {
+      transport = rtsp::kMulticast;
+    } else if (a == "--listen" && has_value) {
+      listen = argv[++i];
+    } else if (a == "--iface" && has_value) {
+      iface = argv[++i];
+    } else if (a == "-n" && has_value) {
+      count = atoi(argv[++i]);
+    } else if (a == "-o" && has_value) {
+      outdir = argv[++i];
+    } else if (a == "--packet" && has_value) {
+      max_packet = strtoul(argv[++i], NULL, 10);
+    } else if (a == "--roundtrip") {
+      roundtrip = true;
+    } else if (roundtrip) {
+      files.push_back(argv[i]);
+    } else if (url.empty() && a[0] != '-') {
+      url = a;
+    } else {
+      usage();
+      return 2;
+    }
+  }
+
+  if (roundtrip) {
+    return run_roundtrip(files, max_packet, outdir);
+  }
+  if (listen.empty() == (url.find("rtsp://") != 0)) {
+    usage();
+    return 2;
+  }
+  return run_stream(url, transport, listen, iface, count, outdir);
+}